@@ -121,6 +121,7 @@ cpack_add_component(core-socket DEPENDS core)
 cpack_add_component(core-socket-stream DEPENDS core-socket)
 cpack_add_component(core-socket-stream-legacy DEPENDS core-socket-stream)
 cpack_add_component(core-socket-stream-tls DEPENDS core-socket-stream)
+cpack_add_component(core-socket-dgram DEPENDS core-socket)
 
 cpack_add_component(net)
 
@@ -168,6 +169,8 @@ cpack_add_component(
     net-un-stream-tls DEPENDS net-un-stream core-socket-stream-tls
 )
 
+cpack_add_component(net-in-dgram DEPENDS net-in)
+cpack_add_component(net-in6-dgram DEPENDS net-in6)
 cpack_add_component(net-un-dgram DEPENDS net-un)
 
 cpack_add_component(http)
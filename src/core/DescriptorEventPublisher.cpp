@@ -42,6 +42,8 @@
 #include "core/DescriptorEventPublisher.h"
 
 #include "core/DescriptorEventReceiver.h"
+#include "core/EventLoop.h"
+#include "core/EventMultiplexer.h"
 
 #ifndef DOXYGEN_SHOULD_SKIP_THIS
 
@@ -136,9 +138,19 @@ namespace core {
         }
 
         if (descriptorEventReceiver->isSuspended()) {
-            muxOff(descriptorEventReceiver);
+            interestOff(descriptorEventReceiver);
         }
-        descriptorEventReceiver->setEnabled(utils::Timeval::currentTime());
+
+        const utils::Timeval currentTime = EventLoop::instance().getEventMultiplexer().getCurrentTime();
+
+        descriptorEventReceiver->setEnabled(currentTime);
+
+        // Only the front receiver of a descriptor is observed for inactivity
+        if (eventReceivers->second.size() > 1) {
+            timeoutWheel.disarm(*std::next(eventReceivers->second.begin()));
+        }
+        timeoutWheel.arm(descriptorEventReceiver, currentTime);
+
         return true;
     }
 
@@ -149,22 +161,39 @@ namespace core {
     }
 
     void DescriptorEventPublisher::suspend(DescriptorEventReceiver* descriptorEventReceiver) {
-        muxOff(descriptorEventReceiver);
+        interestOff(descriptorEventReceiver);
     }
 
     void DescriptorEventPublisher::resume(DescriptorEventReceiver* descriptorEventReceiver) {
+        interestOn(descriptorEventReceiver);
+    }
+
+    void DescriptorEventPublisher::rearmTimeout(DescriptorEventReceiver* descriptorEventReceiver, const utils::Timeval& currentTime) {
+        const auto eventReceivers = observedEventReceiverLists.find(descriptorEventReceiver->getRegisteredFd());
+
+        if (eventReceivers != observedEventReceiverLists.end() && eventReceivers->second.front() == descriptorEventReceiver) {
+            timeoutWheel.arm(descriptorEventReceiver, currentTime);
+        }
+    }
+
+    void DescriptorEventPublisher::interestOn(DescriptorEventReceiver* descriptorEventReceiver) {
+        interestUpdateCounter++;
         muxOn(descriptorEventReceiver);
     }
 
+    void DescriptorEventPublisher::interestOff(DescriptorEventReceiver* descriptorEventReceiver) {
+        interestUpdateCounter++;
+        muxOff(descriptorEventReceiver);
+    }
+
     void DescriptorEventPublisher::checkTimedOutEvents(const utils::Timeval& currentTime) {
-        for (auto& [fd, eventReceivers] : observedEventReceiverLists) {
-            eventReceivers.front()->checkTimeout(currentTime);
-        }
+        timeoutWheel.expire(currentTime);
     }
 
     void DescriptorEventPublisher::releaseDisabledEvents(const utils::Timeval& currentTime) {
         for (auto& [dirtyDescriptEventReceiverList, disabledDescriptorEventReceivers] : dirtyEventReceiverLists) {
             for (DescriptorEventReceiver* disabledDescriptorEventReceiver : disabledDescriptorEventReceivers) {
+                timeoutWheel.disarm(disabledDescriptorEventReceiver);
                 dirtyDescriptEventReceiverList->remove(disabledDescriptorEventReceiver);
 
                 if (dirtyDescriptEventReceiverList->empty()) {
@@ -176,10 +205,11 @@ namespace core {
                     DescriptorEventReceiver* activeDescriptorEventReceiver = dirtyDescriptEventReceiverList->front();
 
                     activeDescriptorEventReceiver->triggered(currentTime);
+                    timeoutWheel.arm(activeDescriptorEventReceiver, currentTime);
                     if (!activeDescriptorEventReceiver->isSuspended()) {
-                        muxOn(activeDescriptorEventReceiver);
+                        interestOn(activeDescriptorEventReceiver);
                     } else {
-                        muxOff(activeDescriptorEventReceiver);
+                        interestOff(activeDescriptorEventReceiver);
                     }
                 }
 
@@ -194,6 +224,10 @@ namespace core {
         return static_cast<int>(observedEventReceiverLists.size());
     }
 
+    unsigned long DescriptorEventPublisher::getInterestUpdateCount() const {
+        return interestUpdateCounter;
+    }
+
     int DescriptorEventPublisher::maxFd() const {
         int maxFd = -1;
 
@@ -208,9 +242,7 @@ namespace core {
         utils::Timeval nextTimeout = DescriptorEventReceiver::TIMEOUT::MAX;
 
         if (dirtyEventReceiverLists.empty()) {
-            for (const auto& [fd, eventReceivers] : observedEventReceiverLists) {
-                nextTimeout = std::min(eventReceivers.front()->getTimeout(currentTime), nextTimeout);
-            }
+            nextTimeout = timeoutWheel.getNextTimeout(currentTime);
         } else {
             nextTimeout = 0;
         }
@@ -42,6 +42,8 @@
 #ifndef CORE_DESCRIPTOREVENTPUBLISHER_H
 #define CORE_DESCRIPTOREVENTPUBLISHER_H
 
+#include "core/TimeoutWheel.h"
+
 namespace core {
     class DescriptorEventReceiver;
     struct ShutdownContext;
@@ -78,6 +80,7 @@ namespace core {
         void disable(DescriptorEventReceiver* descriptorEventReceiver);
         void suspend(DescriptorEventReceiver* descriptorEventReceiver);
         void resume(DescriptorEventReceiver* descriptorEventReceiver);
+        void rearmTimeout(DescriptorEventReceiver* descriptorEventReceiver, const utils::Timeval& currentTime);
 
         virtual void spanActiveEvents() = 0;
         void checkTimedOutEvents(const utils::Timeval& currentTime);
@@ -86,6 +89,9 @@ namespace core {
         int getObservedEventReceiverCount() const;
         int maxFd() const;
 
+        // Number of interest updates (muxOn/muxOff) issued to the multiplexer backend. For epoll each one is an EPOLL_CTL_MOD.
+        unsigned long getInterestUpdateCount() const;
+
         utils::Timeval getNextTimeout(const utils::Timeval& currentTime) const;
 
         void shutdown(const ShutdownContext& context);
@@ -103,7 +109,12 @@ namespace core {
         virtual void muxOn(DescriptorEventReceiver* descriptorEventReceiver) = 0;
         virtual void muxOff(DescriptorEventReceiver* descriptorEventReceiver) = 0;
 
+        void interestOn(DescriptorEventReceiver* descriptorEventReceiver);
+        void interestOff(DescriptorEventReceiver* descriptorEventReceiver);
+
         std::string name;
+        unsigned long interestUpdateCounter = 0;
+        TimeoutWheel timeoutWheel;
         std::map<std::list<DescriptorEventReceiver*>*, std::list<DescriptorEventReceiver*>> dirtyEventReceiverLists;
     };
 
@@ -42,6 +42,8 @@
 #include "core/DescriptorEventReceiver.h"
 
 #include "core/DescriptorEventPublisher.h"
+#include "core/EventLoop.h"
+#include "core/EventMultiplexer.h"
 
 #ifndef DOXYGEN_SHOULD_SKIP_THIS
 
@@ -152,7 +154,7 @@ namespace core {
         if (enabled) {
             if (suspended) {
                 suspended = false;
-                lastTriggered = utils::Timeval::currentTime();
+                lastTriggered = EventLoop::instance().getEventMultiplexer().getCurrentTime();
                 descriptorEventPublisher.resume(this);
             } else {
                 log().warn("{}: Double resume", getName());
@@ -169,7 +171,10 @@ namespace core {
             this->maxInactivity = timeout;
         }
 
-        triggered(utils::Timeval::currentTime());
+        const utils::Timeval currentTime = EventLoop::instance().getEventMultiplexer().getCurrentTime();
+
+        triggered(currentTime);
+        descriptorEventPublisher.rearmTimeout(this, currentTime);
     }
 
     utils::Timeval DescriptorEventReceiver::getTimeout(const utils::Timeval& currentTime) const {
@@ -44,6 +44,7 @@
 
 #include "core/EventReceiver.h" // IWYU pragma: export
 #include "core/Shutdown.h"      // IWYU pragma: export
+#include "core/TimeoutWheel.h"
 #include "log/LogScopeOwner.h"
 
 namespace core {
@@ -141,9 +142,12 @@ namespace core {
         utils::Timeval maxInactivity;
         const utils::Timeval initialTimeout;
 
+        TimeoutWheel::Link timeoutLink{this};
+
         int eventCounter = 0;
 
         friend class DescriptorEventPublisher;
+        friend class TimeoutWheel;
     };
 
 } // namespace core
@@ -57,6 +57,7 @@ namespace core {
     std::map<std::string, DynamicLoader::Library> DynamicLoader::dlOpenedLibraries;
     std::map<void*, std::string> DynamicLoader::dlOpenedLibrariesByHandle;
     std::list<std::string> DynamicLoader::closeQueue;
+    std::mutex DynamicLoader::dlOpenedLibrariesMutex;
 
     std::string DynamicLoader::canonicalizePath(const std::string& libFile) {
         std::string result = libFile;
@@ -76,6 +77,8 @@ namespace core {
     }
 
     void* DynamicLoader::dlOpen(const std::string& libFile, int flags) {
+        const std::lock_guard<std::mutex> guard(dlOpenedLibrariesMutex);
+
         void* handle = nullptr;
 
         const std::string canonicalFile = canonicalizePath(libFile);
@@ -115,6 +118,8 @@ namespace core {
     }
 
     void DynamicLoader::dlCloseDelayed(void* handle) {
+        const std::lock_guard<std::mutex> guard(dlOpenedLibrariesMutex);
+
         if (handle == nullptr) {
             snode::semantic::coreSystemLog().trace() << "DynLoader dlCloseDelayed: handle is nullptr";
         } else {
@@ -147,6 +152,8 @@ namespace core {
     }
 
     int DynamicLoader::dlClose(void* handle) {
+        const std::lock_guard<std::mutex> guard(dlOpenedLibrariesMutex);
+
         int ret = 0;
 
         if (handle == nullptr) {
@@ -214,6 +221,8 @@ namespace core {
     }
 
     void DynamicLoader::execDlCloseDeleyed() {
+        const std::lock_guard<std::mutex> guard(dlOpenedLibrariesMutex);
+
         if (!closeQueue.empty()) {
             for (const std::string& canonicalFile : closeQueue) {
                 auto it = dlOpenedLibraries.find(canonicalFile);
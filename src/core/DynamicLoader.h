@@ -49,6 +49,7 @@
 #include <cstddef>
 #include <list>
 #include <map>
+#include <mutex>
 #include <string>
 
 #endif /* DOXYGEN_SHOULD_SKIP_THIS */
@@ -86,6 +87,8 @@ namespace core {
         static std::map<void*, std::string> dlOpenedLibrariesByHandle;
         static std::list<std::string> closeQueue;
 
+        static std::mutex dlOpenedLibrariesMutex; // Libraries are shared among all event loops
+
         friend class EventLoop;
         friend class EventMultiplexer;
     };
@@ -88,4 +88,8 @@ namespace core {
         return eventReceiver;
     }
 
+    Event::QueueLink::QueueLink(Event* event)
+        : event(event) {
+    }
+
 } // namespace core
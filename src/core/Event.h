@@ -74,13 +74,30 @@ namespace core {
 
         EventReceiver* getEventReceiver() const;
 
+        class QueueLink {
+        public:
+            explicit QueueLink(Event* event = nullptr);
+
+        private:
+            Event* event;
+
+            QueueLink* prev = nullptr;
+            QueueLink* next = nullptr;
+
+            friend class EventMultiplexer;
+        };
+
     private:
         std::string name;
 
         EventReceiver* eventReceiver;
         EventMultiplexer& eventMultiplexer;
 
+        QueueLink queueLink{this};
+
         bool published = false;
+
+        friend class EventMultiplexer;
     };
 
 } // namespace core
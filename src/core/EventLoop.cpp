@@ -42,6 +42,7 @@
 #include "core/EventLoop.h"
 
 #include "core/EventMultiplexer.h"
+#include "core/PostQueue.h"
 #include "core/Shutdown.h"
 
 #ifndef DOXYGEN_SHOULD_SKIP_THIS
@@ -54,6 +55,8 @@
 #include <algorithm>
 #include <cerrno>
 #include <chrono>
+#include <csignal>
+#include <system_error>
 #include <utility>
 
 #endif /* DOXYGEN_SHOULD_SKIP_THIS */
@@ -61,11 +64,22 @@
 namespace core {
 
     int EventLoop::stopsig = 0;
-    unsigned long EventLoop::tickCounter = 0;
-    core::State EventLoop::eventLoopState = State::LOADED;
+    thread_local unsigned long EventLoop::tickCounter = 0;
+    thread_local core::State EventLoop::eventLoopState = State::LOADED;
+    thread_local std::size_t EventLoop::eventLoopIndex = 0;
+    std::atomic<bool> EventLoop::stopRequested = false;
+    std::vector<std::function<void()>> EventLoop::eventLoopStartInitializers;
+    std::vector<std::thread> EventLoop::secondaryEventLoops;
+    std::mutex EventLoop::runningEventLoopsMutex;
+    std::vector<EventLoop*> EventLoop::runningEventLoops;
+    WorkerPool EventLoop::workerPool;
 
     namespace {
 
+        // Poll interval of a secondary loop without observers in case its post queue could not be observed. Otherwise a stop
+        // requested by one loop is posted to all the others and wakes them immediately.
+        const utils::Timeval crossLoopStopInterval({0, 100000});
+
         std::string signalName(int signum) {
             std::string signal = "SIG" + utils::system::sigabbrev_np(signum);
             if (signal == "SIGUNKNOWN") {
@@ -123,7 +137,7 @@ namespace core {
     }
 
     EventLoop& EventLoop::instance() {
-        static EventLoop eventLoop;
+        thread_local EventLoop eventLoop;
 
         return eventLoop;
     }
@@ -158,6 +172,54 @@ namespace core {
         return eventLoopState;
     }
 
+    std::size_t EventLoop::getEventLoopCount() {
+        return eventLoopState == State::LOADED ? 1 : static_cast<std::size_t>(utils::Config::getEventLoops());
+    }
+
+    std::size_t EventLoop::getEventLoopIndex() {
+        return eventLoopIndex;
+    }
+
+    std::size_t EventLoop::getWorkerThreadCount() {
+        return eventLoopState == State::LOADED ? 1 : static_cast<std::size_t>(utils::Config::getWorkerThreads());
+    }
+
+    bool EventLoop::post(const std::function<void()>& task) {
+        return eventMultiplexer.getPostQueue().post(task);
+    }
+
+    void EventLoop::offload(const std::function<void()>& job, const std::function<void()>& continuation) {
+        PostQueue& postQueue = eventMultiplexer.getPostQueue();
+
+        postQueue.hold();
+        offloadsInFlight.fetch_add(1, std::memory_order_relaxed);
+
+        const std::function<void()> offloaded = [this, &postQueue, job, continuation]() {
+            job();
+
+            if (!post(continuation)) {
+                logScope.logger(logger::Logger::semanticSink()).error("Core::EventLoop: Continuation of an offloaded job lost");
+            }
+
+            postQueue.release();
+            offloadsInFlight.fetch_sub(1, std::memory_order_release);
+        };
+
+        if (!workerPool.submit(offloaded, getWorkerThreadCount())) {
+            log().warn("Core::EventLoop: No worker thread available - running offloaded job on the event loop");
+
+            offloaded();
+        }
+    }
+
+    void EventLoop::atEventLoopStart(const std::function<void()>& initializer) {
+        if (secondaryEventLoops.empty() && eventLoopIndex == 0) {
+            eventLoopStartInitializers.push_back(initializer);
+        } else {
+            EventLoop::instance().log().debug("Core::EventLoop: Secondary event loops already running - initializer not registered");
+        }
+    }
+
     // NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays, hicpp-avoid-c-arrays, modernize-avoid-c-arrays)
     bool EventLoop::init(int argc, char* argv[]) {
         struct sigaction sact{};
@@ -276,13 +338,25 @@ namespace core {
         if (eventLoopState == State::INITIALIZED) {
             if (utils::Config::bootstrap()) {
                 eventLoopState = State::RUNNING;
+                stopRequested = false;
                 core::TickStatus tickStatus = TickStatus::SUCCESS;
 
                 EventLoop::instance().log().trace("Core::EventLoop: started");
 
+                registerRunningEventLoop(&EventLoop::instance());
+
+                startSecondaryEventLoops(timeOut);
+
                 do {
                     tickStatus = EventLoop::instance()._tick(timeOut);
-                } while ((tickStatus == TickStatus::SUCCESS || tickStatus == TickStatus::INTERRUPTED) && eventLoopState == State::RUNNING);
+                } while ((tickStatus == TickStatus::SUCCESS || tickStatus == TickStatus::INTERRUPTED) && eventLoopState == State::RUNNING &&
+                         !stopRequested);
+
+                unregisterRunningEventLoop(&EventLoop::instance());
+
+                if (stopRequested) {
+                    eventLoopState = State::STOPPING;
+                }
 
                 switch (tickStatus) {
                     case TickStatus::SUCCESS:
@@ -320,6 +394,110 @@ namespace core {
 
     void EventLoop::stop() {
         eventLoopState = State::STOPPING;
+        stopRequested = true;
+
+        wakeRunningEventLoops();
+    }
+
+    void EventLoop::startSecondaryEventLoops(const utils::Timeval& timeOut) {
+        const std::size_t eventLoopCount = getEventLoopCount();
+
+        if (eventLoopCount > 1) {
+            // Secondary loops must never receive the process signals - those are handled by the primary loop only
+            sigset_t allSet{};
+            logSignalFailure(sigfillset(&allSet), "sigfillset", "spawn-block-mask");
+
+            sigset_t oldSet{};
+            if (logSignalFailure(pthread_sigmask(SIG_BLOCK, &allSet, &oldSet), "pthread_sigmask", "spawn-block")) {
+                for (std::size_t index = 1; index < eventLoopCount; ++index) {
+                    try {
+                        secondaryEventLoops.emplace_back(runSecondaryEventLoop, index, timeOut);
+                    } catch (const std::system_error& error) {
+                        EventLoop::instance().log().error("Core::EventLoop: Starting event loop {} failed: {}", index, error.what());
+                        break;
+                    }
+                }
+
+                logSignalFailure(pthread_sigmask(SIG_SETMASK, &oldSet, nullptr), "pthread_sigmask", "spawn-restore");
+            }
+
+            EventLoop::instance().log().trace("Core::EventLoop: {} event loops running", secondaryEventLoops.size() + 1);
+        }
+    }
+
+    void EventLoop::runSecondaryEventLoop(std::size_t index, const utils::Timeval& timeOut) {
+        eventLoopIndex = index;
+        eventLoopState = State::RUNNING;
+
+        EventLoop& eventLoop = EventLoop::instance();
+        eventLoop.log().trace("Core::EventLoop[{}]: started", index);
+
+        for (const std::function<void()>& initializer : eventLoopStartInitializers) {
+            initializer();
+        }
+
+        // A secondary loop stays alive without observers until the whole runtime is stopped
+        registerRunningEventLoop(&eventLoop);
+        eventLoop.eventMultiplexer.getPostQueue().hold();
+
+        while (eventLoopState == State::RUNNING && !stopRequested) {
+            const TickStatus tickStatus = eventLoop._tick(timeOut);
+
+            if (tickStatus == TickStatus::NOOBSERVER) {
+                std::this_thread::sleep_for(std::chrono::milliseconds(crossLoopStopInterval.getMs()));
+            } else if (tickStatus == TickStatus::TRACE) {
+                const int errnum = errno;
+                eventLoop.log().sysError(logger::LogLevel::Critical, errnum, "Core::EventLoop[{}]: _tick()", index);
+                break;
+            }
+        }
+
+        eventLoop.eventMultiplexer.getPostQueue().release();
+        unregisterRunningEventLoop(&eventLoop);
+
+        eventLoopState = State::STOPPING;
+
+        shutdown({stopsig > 0 ? ShutdownReason::Signal : ShutdownReason::Requested, stopsig > 0 ? stopsig : 0});
+
+        // Workers must not post into the post queue of this loop once the thread has ended
+        eventLoop.awaitOffloads();
+
+        eventLoop.log().trace("Core::EventLoop[{}]: stopped", index);
+    }
+
+    void EventLoop::joinSecondaryEventLoops() {
+        for (std::thread& secondaryEventLoop : secondaryEventLoops) {
+            secondaryEventLoop.join();
+        }
+
+        secondaryEventLoops.clear();
+    }
+
+    void EventLoop::registerRunningEventLoop(EventLoop* eventLoop) {
+        const std::lock_guard<std::mutex> runningEventLoopsLock(runningEventLoopsMutex);
+
+        runningEventLoops.push_back(eventLoop);
+    }
+
+    void EventLoop::unregisterRunningEventLoop(EventLoop* eventLoop) {
+        const std::lock_guard<std::mutex> runningEventLoopsLock(runningEventLoopsMutex);
+
+        runningEventLoops.erase(std::remove(runningEventLoops.begin(), runningEventLoops.end(), eventLoop), runningEventLoops.end());
+    }
+
+    void EventLoop::wakeRunningEventLoops() {
+        const std::lock_guard<std::mutex> runningEventLoopsLock(runningEventLoopsMutex);
+
+        for (EventLoop* eventLoop : runningEventLoops) {
+            eventLoop->post([]() {
+            });
+        }
+    }
+
+    void EventLoop::awaitOffloads() {
+        while (offloadsInFlight.load(std::memory_order_acquire) > 0) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
     }
 
     void EventLoop::free() {
@@ -334,6 +512,9 @@ namespace core {
 
         EventLoop& eventLoop = EventLoop::instance();
         eventLoopState = State::STOPPING;
+        stopRequested = true;
+
+        wakeRunningEventLoops();
 
         if (reason == ShutdownReason::Signal) {
             eventLoop.log().trace("Core: Graceful shutdown after signal {}", signal);
@@ -341,7 +522,26 @@ namespace core {
             eventLoop.log().trace("Core: Graceful shutdown");
         }
 
-        eventLoop.eventMultiplexer.shutdown({reason, stopsig > 0 ? stopsig : 0});
+        shutdown({reason, stopsig > 0 ? stopsig : 0});
+
+        joinSecondaryEventLoops();
+
+        eventLoop.awaitOffloads();
+        workerPool.stop();
+
+        eventLoop.log().trace("Core: Shutdown config system");
+
+        utils::Config::terminate();
+
+        eventLoop.log().trace("Core: All resources released");
+
+        eventLoop.log().trace("SNode.C: Ended ... BYE");
+    }
+
+    void EventLoop::shutdown(const ShutdownContext& context) {
+        EventLoop& eventLoop = EventLoop::instance();
+
+        eventLoop.eventMultiplexer.shutdown(context);
 
         utils::Timeval timeout = 2;
         TickStatus tickStatus = TickStatus::SUCCESS;
@@ -360,14 +560,6 @@ namespace core {
         eventLoop.log().trace("Core: Terminate remaining DescriptorEventReceivers and timers");
         eventLoop.eventMultiplexer.terminate();
         eventLoop.eventMultiplexer.clearEventQueue();
-
-        eventLoop.log().trace("Core: Shutdown config system");
-
-        utils::Config::terminate();
-
-        eventLoop.log().trace("Core: All resources released");
-
-        eventLoop.log().trace("SNode.C: Ended ... BYE");
     }
 
     void EventLoop::stoponsig(int sig) {
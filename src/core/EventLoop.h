@@ -44,11 +44,24 @@
 
 #include "core/State.h" // IWYU pragma: export
 #include "core/TickStatus.h"
+#include "core/WorkerPool.h"
 #include "log/LogScopeOwner.h"
 #include "log/SemanticLogger.h"
 
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#endif /* DOXYGEN_SHOULD_SKIP_THIS */
+
 namespace core {
     class EventMultiplexer;
+    struct ShutdownContext;
 } // namespace core
 
 #ifndef DOXYGEN_SHOULD_SKIP_THIS
@@ -84,6 +97,17 @@ namespace core {
 
         static core::State getEventLoopState();
 
+        static std::size_t getEventLoopCount();
+        static std::size_t getEventLoopIndex();
+        static std::size_t getWorkerThreadCount();
+
+        static void atEventLoopStart(const std::function<void()>& initializer);
+
+        // Thread safe: runs task on this event loop during one of its next ticks. Returns false if the task could not be queued
+        bool post(const std::function<void()>& task);
+
+        // Runs the blocking job on a worker thread and afterwards continuation on this event loop, which stays alive in between
+        void offload(const std::function<void()>& job, const std::function<void()>& continuation);
 
     private:
         // NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays, hicpp-avoid-c-arrays, modernize-avoid-c-arrays)
@@ -96,16 +120,39 @@ namespace core {
 
         static void stoponsig(int sig);
 
+        static void startSecondaryEventLoops(const utils::Timeval& timeOut);
+        static void runSecondaryEventLoop(std::size_t index, const utils::Timeval& timeOut);
+        static void joinSecondaryEventLoops();
+        static void registerRunningEventLoop(EventLoop* eventLoop);
+        static void unregisterRunningEventLoop(EventLoop* eventLoop);
+        static void wakeRunningEventLoops();
+        void awaitOffloads();
+        static void shutdown(const ShutdownContext& context);
+
         core::EventMultiplexer& eventMultiplexer;
         logger::LogScopeOwner logScope;
         mutable std::optional<logger::BoundaryLogger> cachedLog_;
         mutable unsigned long cachedLogGeneration_ = 0;
 
+        std::atomic<std::size_t> offloadsInFlight = 0;
+
         static int stopsig;
 
-        static unsigned long tickCounter;
+        static thread_local unsigned long tickCounter;
+
+        static thread_local core::State eventLoopState;
+
+        static thread_local std::size_t eventLoopIndex;
+
+        static std::atomic<bool> stopRequested;
+
+        static std::vector<std::function<void()>> eventLoopStartInitializers;
+        static std::vector<std::thread> secondaryEventLoops;
+
+        static std::mutex runningEventLoopsMutex;
+        static std::vector<EventLoop*> runningEventLoops;
 
-        static core::State eventLoopState;
+        static WorkerPool workerPool;
 
         friend class SNodeC;
     };
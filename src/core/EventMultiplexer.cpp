@@ -81,6 +81,10 @@ namespace core {
         return *timerEventPublisher;
     }
 
+    PostQueue& EventMultiplexer::getPostQueue() {
+        return postQueue;
+    }
+
     void EventMultiplexer::span(Event* event) {
         eventQueue.insert(event);
     }
@@ -90,22 +94,31 @@ namespace core {
     }
 
     TickStatus EventMultiplexer::tick(const utils::Timeval& tickTimeOut, const sigset_t& sigMask) {
-        const utils::Timeval currentTime = utils::Timeval::currentTime();
+        postQueue.observe();
 
         int activeDescriptorCount = 0;
 
-        const TickStatus tickStatus = waitForEvents(tickTimeOut, currentTime, sigMask, activeDescriptorCount);
+        const TickStatus tickStatus = waitForEvents(tickTimeOut, utils::Timeval::currentTime(), sigMask, activeDescriptorCount);
 
         if (tickStatus == TickStatus::SUCCESS) {
-            spanActiveEvents(currentTime, activeDescriptorCount);
-            executeEventQueue(currentTime);
-            checkTimedOutEvents(currentTime);
-            releaseExpiredResources(currentTime);
+            tickTime = utils::Timeval::currentTime(); // After the wait: timers which woke us up are due now
+            dispatching = true;
+
+            spanActiveEvents(tickTime, activeDescriptorCount);
+            executeEventQueue(tickTime);
+            checkTimedOutEvents(tickTime);
+            releaseExpiredResources(tickTime);
+
+            dispatching = false;
         }
 
         return tickStatus;
     }
 
+    utils::Timeval EventMultiplexer::getCurrentTime() const {
+        return dispatching ? tickTime : utils::Timeval::currentTime();
+    }
+
     void EventMultiplexer::shutdown(const ShutdownContext& context) {
         for (DescriptorEventPublisher* const descriptorEventPublisher : descriptorEventPublishers) {
             descriptorEventPublisher->shutdown(context);
@@ -129,7 +142,9 @@ namespace core {
     }
 
     bool EventMultiplexer::hasPendingResources() {
-        return observedEventReceiverCount() > 0 || !timerEventPublisher->empty() || !eventQueue.empty();
+        // The eventfd of the post queue alone does not keep the loop alive, outstanding posts and holds do
+        return observedEventReceiverCount() > (postQueue.isObserved() ? 1 : 0) || !timerEventPublisher->empty() || !eventQueue.empty() ||
+               (postQueue.isObserved() && postQueue.keepsLoopAlive());
     }
 
     TickStatus EventMultiplexer::waitForEvents(const utils::Timeval& tickTimeOut,
@@ -215,45 +230,75 @@ namespace core {
     }
 
     EventMultiplexer::EventQueue::EventQueue()
-        : executeQueue(new std::list<Event*>())
-        , publishQueue(new std::list<Event*>()) {
+        : executeQueue(&queues[0])
+        , publishQueue(&queues[1]) {
+        for (Event::QueueLink& head : queues) {
+            head.prev = &head;
+            head.next = &head;
+        }
     }
 
     EventMultiplexer::EventQueue::~EventQueue() {
-        delete executeQueue;
-        delete publishQueue;
+        for (Event::QueueLink& head : queues) {
+            while (head.next != &head) {
+                Event* event = head.next->event;
+
+                unlink(event->queueLink);
+                event->published = false;
+            }
+        }
     }
 
     void EventMultiplexer::EventQueue::insert(Event* event) {
-        publishQueue->push_back(event); // do not allow two or more same events in one tick
+        link(*publishQueue, event->queueLink); // do not allow two or more same events in one tick
     }
 
     void EventMultiplexer::EventQueue::remove(Event* event) {
-        publishQueue->remove(event); // in case of erase remove the event from the published queue
+        unlink(event->queueLink); // in case of erase remove the event from the published or the executing queue
     }
 
     void EventMultiplexer::EventQueue::execute(const utils::Timeval& currentTime) {
         std::swap(executeQueue, publishQueue);
 
-        for (Event* event : *executeQueue) {
+        while (executeQueue->next != executeQueue) {
+            Event* event = executeQueue->next->event;
+
+            unlink(event->queueLink);
             event->dispatch(currentTime);
         }
-
-        executeQueue->clear();
     }
 
     bool EventMultiplexer::EventQueue::empty() const {
-        return publishQueue->empty();
+        return publishQueue->next == publishQueue;
     }
 
     void EventMultiplexer::EventQueue::clear() {
         std::swap(executeQueue, publishQueue);
 
-        for (const Event* event : *executeQueue) {
+        while (executeQueue->next != executeQueue) {
+            Event* event = executeQueue->next->event;
+
+            unlink(event->queueLink);
+            event->published = false;
             event->getEventReceiver()->destruct();
         }
+    }
 
-        executeQueue->clear();
+    void EventMultiplexer::EventQueue::link(Event::QueueLink& head, Event::QueueLink& queueLink) {
+        queueLink.prev = head.prev;
+        queueLink.next = &head;
+        head.prev->next = &queueLink;
+        head.prev = &queueLink;
+    }
+
+    void EventMultiplexer::EventQueue::unlink(Event::QueueLink& queueLink) {
+        if (queueLink.prev != nullptr) {
+            queueLink.prev->next = queueLink.next;
+            queueLink.next->prev = queueLink.prev;
+
+            queueLink.prev = nullptr;
+            queueLink.next = nullptr;
+        }
     }
 
 } // namespace core
@@ -42,25 +42,22 @@
 #ifndef CORE_EVENTMULTIPLEXER_H
 #define CORE_EVENTMULTIPLEXER_H
 
+#include "core/Event.h"
+#include "core/PostQueue.h"
 #include "core/TickStatus.h"
 
 namespace core {
-    class Event;
     class DescriptorEventPublisher;
     struct ShutdownContext;
     class TimerEventPublisher;
 } // namespace core
 
-namespace utils {
-    class Timeval;
-} // namespace utils
-
 #ifndef DOXYGEN_SHOULD_SKIP_THIS
 
+#include "utils/Timeval.h"
 #include "utils/system/signal.h"
 
 #include <array>
-#include <list>
 
 #endif /* DOXYGEN_SHOULD_SKIP_THIS */
 
@@ -96,8 +93,14 @@ namespace core {
             void clear();
 
         private:
-            std::list<Event*>* executeQueue;
-            std::list<Event*>* publishQueue;
+            // Intrusive circular lists: the links live in the events, span and relax never allocate
+            static void link(Event::QueueLink& head, Event::QueueLink& queueLink);
+            static void unlink(Event::QueueLink& queueLink);
+
+            std::array<Event::QueueLink, 2> queues;
+
+            Event::QueueLink* executeQueue;
+            Event::QueueLink* publishQueue;
         };
 
     public:
@@ -107,6 +110,7 @@ namespace core {
 
         DescriptorEventPublisher& getDescriptorEventPublisher(DISP_TYPE dispType);
         TimerEventPublisher& getTimerEventPublisher();
+        PostQueue& getPostQueue();
 
         void span(core::Event* event);
         void relax(core::Event* event);
@@ -118,6 +122,9 @@ namespace core {
 
         TickStatus tick(const utils::Timeval& tickTimeOut, const sigset_t& sigMask);
 
+        // Monotonic time of the current tick, sampled once when the tick starts dispatching. Outside of a tick the clock is read
+        utils::Timeval getCurrentTime() const;
+
     private:
         TickStatus waitForEvents(const utils::Timeval& tickTimeOut,
                                  const utils::Timeval& currentTime,
@@ -146,6 +153,11 @@ namespace core {
         core::TimerEventPublisher* const timerEventPublisher;
 
         EventQueue eventQueue;
+
+        PostQueue postQueue;
+
+        utils::Timeval tickTime;
+        bool dispatching = false;
     };
 
 } // namespace core
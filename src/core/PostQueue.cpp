@@ -0,0 +1,222 @@
+/*
+ * SNode.C - A Slim Toolkit for Network Communication
+ * Copyright (C) Volker Christian <me@vchrist.at>
+ *               2020, 2021, 2022, 2023, 2024, 2025, 2026
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "core/PostQueue.h"
+
+#include "core/Shutdown.h"
+#include "core/State.h"
+#include "core/eventreceiver/ReadEventReceiver.h"
+#include "core/system/unistd.h"
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+
+#include "log/LogScopeOwner.h"
+#include "log/Logger.h"
+
+#include <cerrno>
+#include <cstdint>
+
+#endif /* DOXYGEN_SHOULD_SKIP_THIS */
+
+namespace core {
+
+    namespace {
+        const logger::LogScopeOwner& postQueueLogScope() {
+            static const logger::LogScopeOwner scope(logger::LogOrigin::Framework, logger::LogBoundary::System, "core.postqueue", "eventfd");
+            return scope;
+        }
+
+        logger::BoundaryLogger postQueueLog() {
+            return postQueueLogScope().logger(logger::Logger::semanticSink());
+        }
+    } // namespace
+
+    class PostQueue::Receiver final : public eventreceiver::ReadEventReceiver {
+    public:
+        Receiver(PostQueue* postQueue, int eventFd)
+            : ReadEventReceiver("PostQueue", TIMEOUT::DISABLE)
+            , postQueue(postQueue) {
+            enable(eventFd);
+        }
+
+        void detach() {
+            postQueue = nullptr;
+        }
+
+        void destroy() {
+            delete this;
+        }
+
+    private:
+        ~Receiver() override = default;
+
+        void readEvent() override {
+            // Reset the eventfd before taking the tasks: a post racing with the drain signals again
+            std::uint64_t signalCount = 0;
+            static_cast<void>(core::system::read(getRegisteredFd(), &signalCount, sizeof(signalCount)));
+
+            if (postQueue != nullptr) {
+                postQueue->drain();
+            }
+        }
+
+        void shutdownEvent([[maybe_unused]] const ShutdownContext& context) override {
+            // Stay observed during a graceful shutdown: outstanding offloads still post their continuations
+        }
+
+        void unobservedEvent() override {
+            if (postQueue != nullptr) {
+                postQueue->unobserved();
+            }
+
+            delete this;
+        }
+
+        PostQueue* postQueue;
+    };
+
+    PostQueue::PostQueue()
+        : eventFd(core::system::eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC)) {
+        if (eventFd < 0) {
+            const int errnum = errno;
+            postQueueLog().sysError(logger::LogLevel::Error, errnum, "Core::PostQueue eventfd failed");
+        }
+    }
+
+    PostQueue::~PostQueue() {
+        if (receiver != nullptr) {
+            receiver->detach();
+        }
+
+        Task* tasks = head.exchange(nullptr);
+        while (tasks != nullptr) {
+            Task* next = tasks->next;
+            delete tasks;
+            tasks = next;
+        }
+
+        if (eventFd >= 0) {
+            core::system::close(eventFd);
+        }
+    }
+
+    bool PostQueue::post(const std::function<void()>& task) {
+        bool posted = false;
+
+        if (eventFd >= 0) {
+            Task* newTask = new Task{task, head.load(std::memory_order_relaxed)};
+            while (!head.compare_exchange_weak(newTask->next, newTask, std::memory_order_release, std::memory_order_relaxed)) {
+            }
+
+            // Only the post which finds the queue empty needs to wake the loop
+            if (newTask->next == nullptr) {
+                signal();
+            }
+
+            posted = true;
+        }
+
+        return posted;
+    }
+
+    void PostQueue::hold() {
+        holds.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    void PostQueue::release() {
+        // The last release lets the loop re-evaluate whether anything keeps it alive
+        if (holds.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            signal();
+        }
+    }
+
+    void PostQueue::observe() {
+        if (receiver == nullptr && eventFd >= 0 && core::eventLoopState() != core::State::STOPPING) {
+            receiver = new Receiver(this, eventFd);
+
+            if (!receiver->isEnabled()) {
+                receiver->destroy();
+                receiver = nullptr;
+            }
+        }
+    }
+
+    bool PostQueue::isObserved() const {
+        return receiver != nullptr;
+    }
+
+    bool PostQueue::keepsLoopAlive() const {
+        return holds.load(std::memory_order_acquire) > 0 || head.load(std::memory_order_acquire) != nullptr;
+    }
+
+    std::size_t PostQueue::drain() {
+        Task* tasks = head.exchange(nullptr, std::memory_order_acquire);
+
+        Task* ordered = nullptr;
+        while (tasks != nullptr) {
+            Task* next = tasks->next;
+            tasks->next = ordered;
+            ordered = tasks;
+            tasks = next;
+        }
+
+        std::size_t count = 0;
+        while (ordered != nullptr) {
+            Task* next = ordered->next;
+            ordered->task();
+            delete ordered;
+            ordered = next;
+            count++;
+        }
+
+        return count;
+    }
+
+    void PostQueue::signal() const {
+        const std::uint64_t one = 1;
+        static_cast<void>(core::system::write(eventFd, &one, sizeof(one)));
+    }
+
+    void PostQueue::unobserved() {
+        receiver = nullptr;
+    }
+
+} // namespace core
@@ -0,0 +1,100 @@
+/*
+ * SNode.C - A Slim Toolkit for Network Communication
+ * Copyright (C) Volker Christian <me@vchrist.at>
+ *               2020, 2021, 2022, 2023, 2024, 2025, 2026
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef CORE_POSTQUEUE_H
+#define CORE_POSTQUEUE_H
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+
+#include <atomic>
+#include <cstddef>
+#include <functional>
+
+#endif /* DOXYGEN_SHOULD_SKIP_THIS */
+
+namespace core {
+
+    // Hands tasks from arbitrary threads over to the event loop owning the queue. Producers push onto a lock-free stack; only the
+    // push which finds the stack empty signals the eventfd, so posts racing before the loop wakes up cost no syscall. The loop
+    // takes the whole stack with one exchange per wake-up and runs the tasks in posting order.
+    class PostQueue {
+    public:
+        PostQueue();
+        ~PostQueue();
+
+        PostQueue(const PostQueue&) = delete;
+        PostQueue& operator=(const PostQueue&) = delete;
+
+        // Any thread
+        bool post(const std::function<void()>& task);
+
+        // Any thread: keep the owning loop alive while work whose completion will be posted is still outstanding
+        void hold();
+        void release();
+
+        // Owning loop only
+        void observe();
+        bool isObserved() const;
+        bool keepsLoopAlive() const;
+        std::size_t drain();
+
+    private:
+        class Receiver;
+
+        struct Task {
+            std::function<void()> task;
+            Task* next = nullptr;
+        };
+
+        void signal() const;
+        void unobserved();
+
+        std::atomic<Task*> head = nullptr;
+        std::atomic<std::size_t> holds = 0;
+
+        int eventFd;
+
+        Receiver* receiver = nullptr;
+    };
+
+} // namespace core
+
+#endif // CORE_POSTQUEUE_H
@@ -77,4 +77,16 @@ namespace core {
         return EventLoop::getEventLoopState();
     }
 
+    std::size_t SNodeC::eventLoopCount() {
+        return EventLoop::getEventLoopCount();
+    }
+
+    std::size_t SNodeC::eventLoopIndex() {
+        return EventLoop::getEventLoopIndex();
+    }
+
+    void SNodeC::atEventLoopStart(const std::function<void()>& initializer) {
+        EventLoop::atEventLoopStart(initializer);
+    }
+
 } // namespace core
@@ -51,6 +51,7 @@
 
 #include <climits>
 #include <cstddef>
+#include <functional>
 
 #endif /* DOXYGEN_SHOULD_SKIP_THIS */
 
@@ -70,6 +71,10 @@ namespace core {
         static void free();
 
         static State state();
+
+        static std::size_t eventLoopCount();
+        static std::size_t eventLoopIndex();
+        static void atEventLoopStart(const std::function<void()>& initializer);
     };
 
 } // namespace core
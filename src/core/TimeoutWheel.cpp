@@ -0,0 +1,319 @@
+/*
+ * SNode.C - A Slim Toolkit for Network Communication
+ * Copyright (C) Volker Christian <me@vchrist.at>
+ *               2020, 2021, 2022, 2023, 2024, 2025, 2026
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "core/TimeoutWheel.h"
+
+#include "core/DescriptorEventReceiver.h"
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+
+#include "utils/Timeval.h"
+
+#include <algorithm>
+#include <bit>
+#include <ctime>
+#include <limits>
+#include <sys/time.h>
+
+#endif /* DOXYGEN_SHOULD_SKIP_THIS */
+
+namespace core {
+
+    namespace {
+        constexpr std::uint64_t MAX_RANGE = (std::uint64_t{1} << 32) - 1;
+
+        constexpr unsigned levelShift(std::size_t level) {
+            return level == 0 ? 0 : static_cast<unsigned>(8 + (6 * (level - 1)));
+        }
+
+        std::uint64_t toJiffies(const utils::Timeval& time) {
+            const timeval* tv = &time;
+
+            return tv->tv_sec < 0 ? 0 : (static_cast<std::uint64_t>(tv->tv_sec) * 1000) + (static_cast<std::uint64_t>(tv->tv_usec) / 1000);
+        }
+
+        // Rounds up, a timeout must never expire early
+        std::uint64_t durationToJiffies(const utils::Timeval& duration) {
+            const timeval* tv = &duration;
+
+            std::uint64_t jiffies = 0;
+            if (tv->tv_sec >= static_cast<time_t>(MAX_RANGE / 1000)) {
+                jiffies = MAX_RANGE;
+            } else if (tv->tv_sec >= 0) {
+                jiffies = (static_cast<std::uint64_t>(tv->tv_sec) * 1000) + ((static_cast<std::uint64_t>(tv->tv_usec) + 999) / 1000);
+            }
+
+            return jiffies;
+        }
+    } // namespace
+
+    TimeoutWheel::Link::Link(DescriptorEventReceiver* eventReceiver)
+        : eventReceiver(eventReceiver) {
+    }
+
+    TimeoutWheel::TimeoutWheel() {
+        for (Link& head : slots) {
+            head.prev = &head;
+            head.next = &head;
+        }
+    }
+
+    void TimeoutWheel::arm(DescriptorEventReceiver* eventReceiver, const utils::Timeval& currentTime) {
+        Link& timeoutLink = eventReceiver->timeoutLink;
+
+        if (eventReceiver->maxInactivity > 0) {
+            if (timeoutLink.prev != nullptr) {
+                unlink(timeoutLink);
+            }
+
+            const std::uint64_t currentJiffies = toJiffies(currentTime);
+            if (empty()) {
+                currentJiffy = std::max(currentJiffy, currentJiffies);
+            }
+
+            timeoutLink.armed = true;
+            link(timeoutLink,
+                 currentJiffies + durationToJiffies(eventReceiver->maxInactivity - (currentTime - eventReceiver->lastTriggered)));
+        } else {
+            disarm(eventReceiver);
+        }
+    }
+
+    void TimeoutWheel::disarm(DescriptorEventReceiver* eventReceiver) {
+        Link& timeoutLink = eventReceiver->timeoutLink;
+
+        if (timeoutLink.prev != nullptr) {
+            unlink(timeoutLink);
+        }
+        timeoutLink.armed = false;
+    }
+
+    void TimeoutWheel::expire(const utils::Timeval& currentTime) {
+        const std::uint64_t currentJiffies = toJiffies(currentTime);
+
+        while (currentJiffy <= currentJiffies && !empty()) {
+            if ((currentJiffy & 255) == 0) {
+                for (std::size_t level = 1; level < LEVELS; level++) {
+                    cascade(level);
+
+                    if (((currentJiffy >> levelShift(level)) & 63) != 0) {
+                        break;
+                    }
+                }
+            }
+
+            if (firstLevelEmpty()) {
+                currentJiffy = std::min((currentJiffy | 255) + 1, currentJiffies + 1);
+            } else {
+                Link detached;
+                detach(currentJiffy & 255, detached);
+
+                currentJiffy++;
+
+                while (detached.next != &detached) {
+                    Link& timeoutLink = *detached.next;
+                    unlink(timeoutLink);
+
+                    DescriptorEventReceiver* eventReceiver = timeoutLink.eventReceiver;
+                    const utils::Timeval inactivity = currentTime - eventReceiver->lastTriggered;
+
+                    if (inactivity < eventReceiver->maxInactivity) { // Triggered since armed
+                        link(timeoutLink, currentJiffies + durationToJiffies(eventReceiver->maxInactivity - inactivity));
+                    } else {
+                        eventReceiver->checkTimeout(currentTime);
+
+                        if (timeoutLink.armed && timeoutLink.prev == nullptr) { // Still inactive, report again next tick
+                            link(timeoutLink, currentJiffies + 1);
+                        }
+                    }
+                }
+            }
+        }
+
+        if (currentJiffy <= currentJiffies) {
+            currentJiffy = currentJiffies + 1;
+        }
+    }
+
+    utils::Timeval TimeoutWheel::getNextTimeout(const utils::Timeval& currentTime) const {
+        utils::Timeval nextTimeout = DescriptorEventReceiver::TIMEOUT::MAX;
+
+        if (!empty()) {
+            const std::uint64_t currentJiffies = toJiffies(currentTime);
+            const std::uint64_t nextJiffy = nextExpiry();
+
+            nextTimeout = 0;
+            if (nextJiffy > currentJiffies) {
+                const std::uint64_t ms = nextJiffy - currentJiffies;
+                nextTimeout = utils::Timeval({static_cast<time_t>(ms / 1000), static_cast<time_t>((ms % 1000) * 1000)});
+            }
+        }
+
+        return nextTimeout;
+    }
+
+    void TimeoutWheel::link(Link& timeoutLink, std::uint64_t expires) {
+        expires = std::clamp(expires, currentJiffy, currentJiffy + MAX_RANGE);
+        const std::uint64_t delta = expires - currentJiffy;
+
+        std::size_t slot = expires & 255;
+        for (std::size_t level = 1; level < LEVELS && delta >= (std::uint64_t{1} << levelShift(level)); level++) {
+            slot = 256 + ((level - 1) * 64) + ((expires >> levelShift(level)) & 63);
+        }
+
+        Link& head = slots[slot];
+
+        timeoutLink.prev = head.prev;
+        timeoutLink.next = &head;
+        head.prev->next = &timeoutLink;
+        head.prev = &timeoutLink;
+
+        timeoutLink.expires = expires;
+        timeoutLink.slot = static_cast<std::uint16_t>(slot);
+
+        occupied[slot / 64] |= std::uint64_t{1} << (slot % 64);
+    }
+
+    void TimeoutWheel::unlink(Link& timeoutLink) {
+        timeoutLink.prev->next = timeoutLink.next;
+        timeoutLink.next->prev = timeoutLink.prev;
+
+        if (timeoutLink.slot != DETACHED && slots[timeoutLink.slot].next == &slots[timeoutLink.slot]) {
+            occupied[timeoutLink.slot / 64] &= ~(std::uint64_t{1} << (timeoutLink.slot % 64));
+        }
+
+        timeoutLink.prev = nullptr;
+        timeoutLink.next = nullptr;
+    }
+
+    void TimeoutWheel::detach(std::size_t slot, Link& detached) {
+        Link& head = slots[slot];
+
+        detached.prev = &detached;
+        detached.next = &detached;
+
+        if (head.next != &head) {
+            detached.next = head.next;
+            detached.prev = head.prev;
+            detached.next->prev = &detached;
+            detached.prev->next = &detached;
+
+            head.prev = &head;
+            head.next = &head;
+
+            occupied[slot / 64] &= ~(std::uint64_t{1} << (slot % 64));
+
+            for (Link* timeoutLink = detached.next; timeoutLink != &detached; timeoutLink = timeoutLink->next) {
+                timeoutLink->slot = DETACHED;
+            }
+        }
+    }
+
+    void TimeoutWheel::cascade(std::size_t level) {
+        Link detached;
+        detach(256 + ((level - 1) * 64) + ((currentJiffy >> levelShift(level)) & 63), detached);
+
+        while (detached.next != &detached) {
+            Link& timeoutLink = *detached.next;
+            unlink(timeoutLink);
+
+            link(timeoutLink, timeoutLink.expires);
+        }
+    }
+
+    bool TimeoutWheel::empty() const {
+        return std::all_of(occupied.begin(), occupied.end(), [](std::uint64_t bits) {
+            return bits == 0;
+        });
+    }
+
+    bool TimeoutWheel::firstLevelEmpty() const {
+        return std::all_of(occupied.begin(), occupied.begin() + 4, [](std::uint64_t bits) {
+            return bits == 0;
+        });
+    }
+
+    std::uint64_t TimeoutWheel::nextExpiry() const {
+        std::uint64_t nextJiffy = std::numeric_limits<std::uint64_t>::max();
+
+        // First level: exact, all entries expire within the next 256 jiffies
+        const std::size_t index = currentJiffy & 255;
+        for (std::size_t n = 0; n <= 4; n++) {
+            const std::size_t word = ((index / 64) + n) % 4;
+
+            std::uint64_t bits = occupied[word];
+            if (n == 0) {
+                bits &= ~std::uint64_t{0} << (index % 64);
+            } else if (n == 4) {
+                bits &= (std::uint64_t{1} << (index % 64)) - 1;
+            }
+
+            if (bits != 0) {
+                const std::size_t slot = (word * 64) + static_cast<std::size_t>(std::countr_zero(bits));
+                nextJiffy = currentJiffy + ((slot - index) & 255);
+                break;
+            }
+        }
+
+        // Upper levels: the time their next occupied slot is cascaded is a lower bound for its entries
+        for (std::size_t level = 1; level < LEVELS; level++) {
+            const std::uint64_t bits = occupied[3 + level];
+
+            if (bits != 0) {
+                const unsigned shift = levelShift(level);
+                const int current = static_cast<int>((currentJiffy >> shift) & 63);
+                const bool cascadePending = (currentJiffy & ((std::uint64_t{1} << shift) - 1)) == 0;
+
+                const std::uint64_t rotated = std::rotr(bits, current);
+
+                std::uint64_t distance = 64;
+                if (cascadePending || (rotated & ~std::uint64_t{1}) != 0) {
+                    distance = static_cast<std::uint64_t>(std::countr_zero(cascadePending ? rotated : rotated & ~std::uint64_t{1}));
+                }
+
+                nextJiffy = std::min(nextJiffy, ((currentJiffy >> shift) + distance) << shift);
+            }
+        }
+
+        return nextJiffy;
+    }
+
+} // namespace core
@@ -0,0 +1,126 @@
+/*
+ * SNode.C - A Slim Toolkit for Network Communication
+ * Copyright (C) Volker Christian <me@vchrist.at>
+ *               2020, 2021, 2022, 2023, 2024, 2025, 2026
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef CORE_TIMEOUTWHEEL_H
+#define CORE_TIMEOUTWHEEL_H
+
+namespace core {
+    class DescriptorEventReceiver;
+} // namespace core
+
+namespace utils {
+    class Timeval;
+} // namespace utils
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#endif /* DOXYGEN_SHOULD_SKIP_THIS */
+
+namespace core {
+
+    // Hierarchical timing wheel with millisecond resolution holding the inactivity timeouts of the active receivers of one
+    // DescriptorEventPublisher. The first level covers the next 256 ms slot by slot, each of the four upper levels covers 64 times
+    // the range of the level below. Entries cascade towards the first level as time advances, thus a tick only touches the slots
+    // which come due. Re-triggering a receiver only records the time of the trigger. An entry whose receiver has been triggered
+    // since it was armed is re-armed lazily once its slot comes due.
+    class TimeoutWheel {
+    public:
+        class Link {
+        public:
+            explicit Link(DescriptorEventReceiver* eventReceiver = nullptr);
+
+            Link(const Link&) = delete;
+            Link& operator=(const Link&) = delete;
+
+        private:
+            DescriptorEventReceiver* eventReceiver;
+
+            Link* prev = nullptr;
+            Link* next = nullptr;
+
+            std::uint64_t expires = 0;
+            std::uint16_t slot = 0;
+            bool armed = false;
+
+            friend class TimeoutWheel;
+        };
+
+        TimeoutWheel();
+
+        TimeoutWheel(const TimeoutWheel&) = delete;
+        TimeoutWheel& operator=(const TimeoutWheel&) = delete;
+
+        void arm(DescriptorEventReceiver* eventReceiver, const utils::Timeval& currentTime);
+        void disarm(DescriptorEventReceiver* eventReceiver);
+
+        void expire(const utils::Timeval& currentTime);
+
+        utils::Timeval getNextTimeout(const utils::Timeval& currentTime) const;
+
+    private:
+        static constexpr std::size_t LEVELS = 5;
+        static constexpr std::size_t SLOTS = 256 + ((LEVELS - 1) * 64);
+        static constexpr std::uint16_t DETACHED = SLOTS;
+
+        void link(Link& link, std::uint64_t expires);
+        void unlink(Link& link);
+        void detach(std::size_t slot, Link& detached);
+
+        void cascade(std::size_t level);
+
+        bool empty() const;
+        bool firstLevelEmpty() const;
+
+        std::uint64_t nextExpiry() const;
+
+        std::array<Link, SLOTS> slots;
+        std::array<std::uint64_t, SLOTS / 64> occupied{};
+
+        std::uint64_t currentJiffy = 0;
+    };
+
+} // namespace core
+
+#endif // CORE_TIMEOUTWHEEL_H
@@ -55,60 +55,154 @@ namespace core {
     utils::Timeval TimerEventPublisher::getNextTimeout(const utils::Timeval& currentTime) {
         utils::Timeval nextTimeout({LONG_MAX, 0});
 
-        if (!timerList.empty()) {
-            nextTimeout = (*(timerList.begin()))->getTimeoutRelative(currentTime);
+        if (!timerHeap.empty()) {
+            nextTimeout = timerHeap.front()->getTimeoutRelative(currentTime);
         }
 
         return nextTimeout;
     }
 
     void TimerEventPublisher::spanActiveEvents(const utils::Timeval& currentTime) {
-        for (TimerEventReceiver* timerEventReceiver : timerList) {
-            if (timerEventReceiver->getTimeoutAbsolut() <= currentTime) {
-                timerEventReceiver->span();
-            } else {
-                break;
+        // Only expired timers and their direct children are visited, the rest of the heap stays untouched
+        std::size_t visited = 0;
+        if (!timerHeap.empty() && timerHeap.front()->getTimeoutAbsolut() <= currentTime) {
+            expiredList.push_back(timerHeap.front());
+        }
+
+        while (visited < expiredList.size()) {
+            const std::size_t firstChild = expiredList[visited++]->heapIndex * ARITY + 1;
+
+            for (std::size_t child = firstChild; child < std::min(firstChild + ARITY, timerHeap.size()); child++) {
+                if (timerHeap[child]->getTimeoutAbsolut() <= currentTime) {
+                    expiredList.push_back(timerHeap[child]);
+                }
             }
         }
+
+        std::sort(expiredList.begin(), expiredList.end(), earlier);
+
+        for (TimerEventReceiver* timerEventReceiver : expiredList) {
+            timerEventReceiver->span();
+        }
+        expiredList.clear();
     }
 
     void TimerEventPublisher::unobserveDisableEvents() {
-        for (TimerEventReceiver* timerEventReceiver : removedList) {
-            timerList.erase(timerEventReceiver);
+        for (std::size_t i = 0; i < removedList.size(); i++) {
+            TimerEventReceiver* timerEventReceiver = removedList[i];
+
+            erase(timerEventReceiver);
             timerEventReceiver->unobservedEvent();
         }
         removedList.clear();
     }
 
     void TimerEventPublisher::remove(TimerEventReceiver* timer) {
-        if (std::find(timerList.begin(), timerList.end(), timer) != timerList.end() &&
-            std::find(removedList.begin(), removedList.end(), timer) == removedList.end()) {
+        if (timer->heapIndex != TimerEventReceiver::NOT_SCHEDULED && !timer->removed) {
+            timer->removed = true;
             removedList.push_back(timer);
         }
     }
 
     void TimerEventPublisher::erase(TimerEventReceiver* timer) {
-        timerList.erase(timer);
+        const std::size_t index = timer->heapIndex;
+
+        if (index != TimerEventReceiver::NOT_SCHEDULED) {
+            TimerEventReceiver* last = timerHeap.back();
+            timerHeap.pop_back();
+
+            if (last != timer) {
+                place(last, index);
+                siftUp(index);
+                siftDown(last->heapIndex);
+            }
+
+            timer->heapIndex = TimerEventReceiver::NOT_SCHEDULED;
+        }
     }
 
     void TimerEventPublisher::insert(TimerEventReceiver* timer) {
-        timerList.insert(timer);
+        if (timer->heapIndex == TimerEventReceiver::NOT_SCHEDULED) {
+            timer->sequence = sequence++;
+
+            timerHeap.push_back(timer);
+            place(timer, timerHeap.size() - 1);
+            siftUp(timer->heapIndex);
+        } else {
+            reschedule(timer);
+        }
+    }
+
+    void TimerEventPublisher::reschedule(TimerEventReceiver* timer) {
+        if (timer->heapIndex != TimerEventReceiver::NOT_SCHEDULED) {
+            timer->sequence = sequence++;
+
+            siftUp(timer->heapIndex);
+            siftDown(timer->heapIndex);
+        } else {
+            insert(timer);
+        }
     }
 
     bool TimerEventPublisher::empty() const {
-        return timerList.empty();
+        return timerHeap.empty();
     }
 
     void TimerEventPublisher::stop() {
-        for (TimerEventReceiver* timer : timerList) {
+        for (TimerEventReceiver* timer : timerHeap) {
             remove(timer);
         }
 
         unobserveDisableEvents();
     }
 
-    bool TimerEventPublisher::timernode_lt::operator()(const TimerEventReceiver* t1, const TimerEventReceiver* t2) const {
-        return t1->getTimeoutAbsolut() < t2->getTimeoutAbsolut();
+    bool TimerEventPublisher::earlier(const TimerEventReceiver* t1, const TimerEventReceiver* t2) {
+        return t1->getTimeoutAbsolut() < t2->getTimeoutAbsolut() ||
+               (!(t2->getTimeoutAbsolut() < t1->getTimeoutAbsolut()) && t1->sequence < t2->sequence);
+    }
+
+    void TimerEventPublisher::siftUp(std::size_t index) {
+        TimerEventReceiver* timer = timerHeap[index];
+
+        while (index > 0) {
+            const std::size_t parent = (index - 1) / ARITY;
+
+            if (!earlier(timer, timerHeap[parent])) {
+                break;
+            }
+
+            place(timerHeap[parent], index);
+            index = parent;
+        }
+
+        place(timer, index);
+    }
+
+    void TimerEventPublisher::siftDown(std::size_t index) {
+        TimerEventReceiver* timer = timerHeap[index];
+
+        for (std::size_t firstChild = index * ARITY + 1; firstChild < timerHeap.size(); firstChild = index * ARITY + 1) {
+            std::size_t earliest = firstChild;
+            for (std::size_t child = firstChild + 1; child < std::min(firstChild + ARITY, timerHeap.size()); child++) {
+                if (earlier(timerHeap[child], timerHeap[earliest])) {
+                    earliest = child;
+                }
+            }
+
+            if (!earlier(timerHeap[earliest], timer)) {
+                break;
+            }
+
+            place(timerHeap[earliest], index);
+            index = earliest;
+        }
+
+        place(timer, index);
+    }
+
+    void TimerEventPublisher::place(TimerEventReceiver* timer, std::size_t index) {
+        timerHeap[index] = timer;
+        timer->heapIndex = index;
     }
 
 } // namespace core
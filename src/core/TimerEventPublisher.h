@@ -50,8 +50,9 @@ namespace core {
 
 #include "utils/Timeval.h"
 
-#include <list>
-#include <set>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
 
 #endif /* DOXYGEN_SHOULD_SKIP_THIS */
 
@@ -70,19 +71,27 @@ namespace core {
 
         void erase(TimerEventReceiver* timer);
         void insert(TimerEventReceiver* timer);
+        void reschedule(TimerEventReceiver* timer);
 
         bool empty() const;
 
         void stop();
 
     private:
-        class timernode_lt {
-        public:
-            bool operator()(const TimerEventReceiver* t1, const TimerEventReceiver* t2) const;
-        };
+        // Indexed 4-ary min-heap: every timer knows its own position, so cancel, reschedule and erase never search
+        static constexpr std::size_t ARITY = 4;
 
-        std::set<TimerEventReceiver*, timernode_lt> timerList;
-        std::list<TimerEventReceiver*> removedList;
+        static bool earlier(const TimerEventReceiver* t1, const TimerEventReceiver* t2);
+
+        void siftUp(std::size_t index);
+        void siftDown(std::size_t index);
+        void place(TimerEventReceiver* timer, std::size_t index);
+
+        std::vector<TimerEventReceiver*> timerHeap;
+        std::vector<TimerEventReceiver*> removedList;
+        std::vector<TimerEventReceiver*> expiredList;
+
+        std::uint64_t sequence = 0;
     };
 
 } // namespace core
@@ -60,14 +60,13 @@ namespace core {
         : EventReceiver(name)
         , timerEventPublisher(EventLoop::instance().getEventMultiplexer().getTimerEventPublisher())
         , logScope(logger::LogOrigin::Framework, logger::LogBoundary::System, "core.timer", name)
-        , absoluteTimeout(utils::Timeval::currentTime() + delay)
+        , absoluteTimeout(EventLoop::instance().getEventMultiplexer().getCurrentTime() + delay)
         , delay(delay) {
     }
 
     void TimerEventReceiver::restart() {
-        timerEventPublisher.erase(this);
-        absoluteTimeout = utils::Timeval::currentTime() + delay;
-        timerEventPublisher.insert(this);
+        absoluteTimeout = EventLoop::instance().getEventMultiplexer().getCurrentTime() + delay;
+        timerEventPublisher.reschedule(this);
     }
 
     TimerEventReceiver::~TimerEventReceiver() {
@@ -103,9 +102,8 @@ namespace core {
     }
 
     void TimerEventReceiver::update() {
-        timerEventPublisher.erase(this);
         absoluteTimeout += delay;
-        timerEventPublisher.insert(this);
+        timerEventPublisher.reschedule(this);
     }
 
     void TimerEventReceiver::cancel() {
@@ -113,9 +111,12 @@ namespace core {
     }
 
     void TimerEventReceiver::onEvent(const utils::Timeval& currentTime) {
-        log().trace("TimerEventReceiver: Dispatch delta = {} ms", (currentTime - getTimeoutAbsolut()).getMsd());
+        // Cancelled or restarted after the expiry has been queued for this tick
+        if (!removed && getTimeoutAbsolut() <= currentTime) {
+            log().trace("TimerEventReceiver: Dispatch delta = {} ms", (currentTime - getTimeoutAbsolut()).getMsd());
 
-        dispatchEvent();
+            dispatchEvent();
+        }
     }
 
     void TimerEventReceiver::setTimer(Timer* timer) {
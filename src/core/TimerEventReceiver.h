@@ -54,6 +54,9 @@ namespace core {
     class TimerEventPublisher;
 } // namespace core
 
+#include <cstddef>
+#include <cstdint>
+#include <limits>
 #include <string>
 
 #endif /* DOXYGEN_SHOULD_SKIP_THIS */
@@ -92,6 +95,8 @@ namespace core {
 
         void setTimer(Timer* timer);
 
+        static constexpr std::size_t NOT_SCHEDULED = std::numeric_limits<std::size_t>::max();
+
         TimerEventPublisher& timerEventPublisher;
         logger::LogScopeOwner logScope;
 
@@ -99,6 +104,10 @@ namespace core {
         utils::Timeval absoluteTimeout;
         utils::Timeval delay;
 
+        std::size_t heapIndex = NOT_SCHEDULED;
+        std::uint64_t sequence = 0;
+        bool removed = false;
+
         friend class Timer;
         friend class TimerEventPublisher;
     };
@@ -0,0 +1,149 @@
+/*
+ * SNode.C - A Slim Toolkit for Network Communication
+ * Copyright (C) Volker Christian <me@vchrist.at>
+ *               2020, 2021, 2022, 2023, 2024, 2025, 2026
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "core/WorkerPool.h"
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+
+#include "log/LogScopeOwner.h"
+#include "log/Logger.h"
+
+#include <cerrno>
+#include <csignal>
+#include <system_error>
+#include <utility>
+
+#endif /* DOXYGEN_SHOULD_SKIP_THIS */
+
+namespace core {
+
+    namespace {
+        const logger::LogScopeOwner& workerPoolLogScope() {
+            static const logger::LogScopeOwner scope(logger::LogOrigin::Framework, logger::LogBoundary::System, "core.worker-pool");
+            return scope;
+        }
+
+        logger::BoundaryLogger workerPoolLog() {
+            return workerPoolLogScope().logger(logger::Logger::semanticSink());
+        }
+    } // namespace
+
+    WorkerPool::~WorkerPool() {
+        stop();
+    }
+
+    bool WorkerPool::submit(const std::function<void()>& job, std::size_t workerCount) {
+        std::unique_lock<std::mutex> jobsLock(jobsMutex);
+
+        if (workers.empty() && !stopping) {
+            sigset_t allSet{};
+            sigfillset(&allSet);
+
+            sigset_t oldSet{};
+            if (pthread_sigmask(SIG_BLOCK, &allSet, &oldSet) == 0) {
+                for (std::size_t index = 0; index < workerCount; ++index) {
+                    try {
+                        workers.emplace_back(&WorkerPool::work, this);
+                    } catch (const std::system_error& error) {
+                        workerPoolLog().error("Core::WorkerPool: Starting worker {} failed: {}", index, error.what());
+                        break;
+                    }
+                }
+
+                pthread_sigmask(SIG_SETMASK, &oldSet, nullptr);
+            } else {
+                const int errnum = errno;
+                workerPoolLog().sysError(logger::LogLevel::Error, errnum, "Core::WorkerPool pthread_sigmask failed");
+            }
+        }
+
+        const bool submitted = !workers.empty() && !stopping;
+        if (submitted) {
+            jobs.push_back(job);
+
+            jobsLock.unlock();
+            jobsCondition.notify_one();
+        }
+
+        return submitted;
+    }
+
+    void WorkerPool::stop() {
+        std::vector<std::thread> stoppingWorkers;
+
+        {
+            const std::lock_guard<std::mutex> jobsLock(jobsMutex);
+
+            stopping = true;
+            stoppingWorkers.swap(workers);
+        }
+        jobsCondition.notify_all();
+
+        for (std::thread& worker : stoppingWorkers) {
+            worker.join();
+        }
+
+        const std::lock_guard<std::mutex> jobsLock(jobsMutex);
+        stopping = false;
+    }
+
+    void WorkerPool::work() {
+        std::unique_lock<std::mutex> jobsLock(jobsMutex);
+
+        for (;;) {
+            jobsCondition.wait(jobsLock, [this]() {
+                return stopping || !jobs.empty();
+            });
+
+            if (jobs.empty()) {
+                break;
+            }
+
+            std::function<void()> job = std::move(jobs.front());
+            jobs.pop_front();
+
+            jobsLock.unlock();
+            job();
+            jobsLock.lock();
+        }
+    }
+
+} // namespace core
@@ -41,21 +41,41 @@
 
 #include "core/file/FileReader.h"
 
+#include "core/EventLoop.h"
 #include "core/State.h"
 
 #ifndef DOXYGEN_SHOULD_SKIP_THIS
 
 #include "core/system/unistd.h"
 
+#include <algorithm>
 #include <cerrno>
+#include <memory>
 #include <vector>
 
 #endif /* DOXYGEN_SHOULD_SKIP_THIS */
 
 constexpr int MF_READSIZE = 16384;
+constexpr std::size_t MF_SENDFILESIZE = 262144;
 
 namespace core::file {
 
+    // A duplicate of the descriptor, kept open by queued file ranges which may outlive the reader
+    struct FileReader::FileHandle {
+        explicit FileHandle(int fd)
+            : fd(fd) {
+        }
+
+        FileHandle(const FileHandle&) = delete;
+        FileHandle& operator=(const FileHandle&) = delete;
+
+        ~FileHandle() {
+            core::system::close(fd);
+        }
+
+        int fd;
+    };
+
     FileReader::FileReader(int fd, const std::string& name, std::size_t pufferSize, int openErrno)
         : core::Descriptor(fd)
         , EventReceiver(name)
@@ -78,32 +98,105 @@ namespace core::file {
     }
 
     void FileReader::onEvent([[maybe_unused]] const utils::Timeval& currentTime) {
-        if (running && core::eventLoopState() != core::State::STOPPING) {
-            if (!suspended) {
-                std::vector<char> puffer(pufferSize);
+        // While a read is in flight its continuation still refers to this reader and spans it again once done
+        if (!reading) {
+            if (running && core::eventLoopState() != core::State::STOPPING) {
+                if (!suspended && (copying || !sendRange())) {
+                    read();
+                }
+            } else {
+                delete this;
+            }
+        }
+    }
 
-                const ssize_t ret = core::system::read(getFd(), puffer.data(), puffer.capacity());
-                if (ret > 0) {
-                    if (this->send(puffer.data(), static_cast<std::size_t>(ret)) < 0) {
-                        running = false;
+    bool FileReader::sendRange() {
+        if (fileHandle == nullptr) {
+            struct stat fileStat {};
+            if (core::system::fstat(getFd(), &fileStat) == 0 && S_ISREG(fileStat.st_mode)) {
+                const int sendFd = core::system::dup(getFd());
 
-                        this->error(errno);
-                    }
-                } else {
+                if (sendFd >= 0) {
+                    fileHandle = std::make_shared<FileHandle>(sendFd);
+                    fileSize = fileStat.st_size;
+                }
+            }
+        }
+
+        bool sent = fileHandle != nullptr;
+
+        if (sent) {
+            const std::size_t rangeLen = std::min(static_cast<std::size_t>(fileSize - sendOffset), MF_SENDFILESIZE);
+
+            if (rangeLen == 0 || this->sendFile(fileHandle, fileHandle->fd, sendOffset, rangeLen) >= 0) {
+                sendOffset += static_cast<off_t>(rangeLen);
+
+                if (sendOffset == fileSize) {
                     running = false;
 
-                    if (ret == 0) {
-                        this->eof();
-                    } else {
-                        this->error(errno);
-                    }
+                    this->eof();
                 }
+            } else if (errno != EOPNOTSUPP || sendOffset > 0) {
+                running = false;
 
-                span();
+                this->error(errno);
+            } else {
+                sent = false;
             }
+        }
+
+        if (sent) {
+            span();
         } else {
-            delete this;
+            // The sink needs the data itself, e.g. to encrypt it
+            copying = true;
+            fileHandle.reset();
         }
+
+        return sent;
+    }
+
+    void FileReader::read() {
+        struct Chunk {
+            std::vector<char> puffer;
+            ssize_t ret = 0;
+            int errnum = 0;
+        };
+
+        const std::shared_ptr<Chunk> chunk = std::make_shared<Chunk>();
+        chunk->puffer.resize(pufferSize);
+
+        reading = true;
+
+        // A regular file never blocks in the sense of poll(), a slow disk stalls the read nevertheless
+        core::EventLoop::instance().offload(
+            [fd = getFd(), chunk]() {
+                chunk->ret = core::system::read(fd, chunk->puffer.data(), chunk->puffer.size());
+                chunk->errnum = errno;
+            },
+            [this, chunk]() {
+                reading = false;
+
+                if (running && core::eventLoopState() != core::State::STOPPING) {
+                    if (chunk->ret > 0) {
+                        if (this->send(chunk->puffer.data(), static_cast<std::size_t>(chunk->ret)) < 0) {
+                            running = false;
+
+                            this->error(errno);
+                        }
+                    } else {
+                        running = false;
+
+                        if (chunk->ret == 0) {
+                            this->eof();
+                        } else {
+                            this->error(chunk->errnum);
+                        }
+                    }
+                }
+
+                span();
+            });
     }
 
     void FileReader::start() {
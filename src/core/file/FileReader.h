@@ -50,7 +50,9 @@
 
 #include <cstddef>
 #include <functional>
+#include <memory>
 #include <string>
+#include <sys/types.h>
 
 #endif /* DOXYGEN_SHOULD_SKIP_THIS */
 
@@ -75,10 +77,21 @@ namespace core::file {
 
     private:
         void onEvent(const utils::Timeval& currentTime) override;
+        bool sendRange();
+        void read();
+
+        struct FileHandle;
 
         std::size_t pufferSize = 0;
 
+        // Set while the sink takes file ranges (sendfile) instead of data
+        std::shared_ptr<FileHandle> fileHandle;
+        off_t fileSize = 0;
+        off_t sendOffset = 0;
+        bool copying = false;
+
         bool suspended = false;
+        bool reading = false;
 
     protected:
         int openErrno = 0;
@@ -42,184 +42,45 @@
 #include "core/multiplexer/epoll/DescriptorEventPublisher.h"
 
 #include "core/DescriptorEventReceiver.h"
+#include "core/multiplexer/epoll/EventMultiplexer.h"
 
 #ifndef DOXYGEN_SHOULD_SKIP_THIS
 
-#include "log/LogScopeOwner.h"
-#include "log/Logger.h"
-#include "utils/PreserveErrno.h"
-
-#include <cerrno>
-
 #endif /* DOXYGEN_SHOULD_SKIP_THIS */
 
 namespace core::multiplexer::epoll {
 
-    namespace {
-        const logger::LogScopeOwner& muxLogScope() {
-            static const logger::LogScopeOwner scope(logger::LogOrigin::Framework, logger::LogBoundary::System, "core.mux", "epoll");
-            return scope;
-        }
-
-        logger::BoundaryLogger muxLog() {
-            return muxLogScope().logger(logger::Logger::semanticSink());
-        }
-    } // namespace
-
-    DescriptorEventPublisher::EPollEvents::EPollEvents(int& epfd, uint32_t events)
-        : epfd(epfd)
-        , events(events) {
-        epfd = core::system::epoll_create1(EPOLL_CLOEXEC);
-        if (epfd < 0) {
-            const int errnum = errno;
-            muxLog().sysError(logger::LogLevel::Error, errnum, "core.mux epoll_create1 failed");
-        }
-        ePollEvents.resize(1);
-    }
-
-    bool DescriptorEventPublisher::EPollEvents::muxAdd(core::DescriptorEventReceiver* eventReceiver) {
-        if (epfd < 0) {
-            errno = EBADF;
-            return false;
-        }
-
-        if (interestCount >= ePollEvents.size()) {
-            try {
-                ePollEvents.resize(ePollEvents.size() * 2);
-            } catch (...) {
-                errno = ENOMEM;
-                return false;
-            }
-        }
-
-        epoll_event ePollEvent{};
-
-        ePollEvent.data.ptr = eventReceiver;
-        ePollEvent.events = events;
-
-        const int fd = eventReceiver->getRegisteredFd();
-        if (core::system::epoll_ctl(epfd, EPOLL_CTL_ADD, fd, &ePollEvent) == 0) {
-            interestCount++;
-            return true;
-        } else {
-            const int errnum = errno;
-            if (errnum == EEXIST) {
-                return muxMod(fd, events, eventReceiver);
-            } else {
-                muxLog().sysError(logger::LogLevel::Error, errnum, "core.mux epoll_ctl ADD failed: fd={}", fd);
-                errno = errnum;
-                return false;
-            }
-        }
-    }
-
-    void DescriptorEventPublisher::EPollEvents::muxDel(int fd) {
-        const utils::PreserveErrno preserveErrno;
-
-        if (epfd < 0) {
-            return;
-        }
-
-        if (core::system::epoll_ctl(epfd, EPOLL_CTL_DEL, fd, nullptr) == 0) {
-            if (interestCount > 0) {
-                interestCount--;
-            }
-        } else {
-            const int errnum = errno;
-            if (errnum == EBADF) {
-                if (interestCount > 0) {
-                    interestCount--;
-                }
-            } else {
-                muxLog().sysError(logger::LogLevel::Error, errnum, "core.mux epoll_ctl DEL failed: fd={}", fd);
-                return;
-            }
-        }
-
-        if (ePollEvents.size() > (interestCount * 2) + 1) {
-            ePollEvents.resize(ePollEvents.size() / 2);
-            ePollEvents.shrink_to_fit();
-        }
-    }
-
-    bool DescriptorEventPublisher::EPollEvents::muxMod(int fd, uint32_t events, core::DescriptorEventReceiver* eventReceiver) const {
-        if (epfd < 0) {
-            errno = EBADF;
-            return false;
-        }
-
-        epoll_event ePollEvent{events, {eventReceiver}};
-
-        if (core::system::epoll_ctl(epfd, EPOLL_CTL_MOD, fd, &ePollEvent) != 0) {
-            const int errnum = errno;
-            muxLog().sysError(logger::LogLevel::Error, errnum, "core.mux epoll_ctl MOD failed: fd={}", fd);
-            errno = errnum;
-            return false;
-        }
-        return true;
-    }
-
-    void DescriptorEventPublisher::EPollEvents::muxOn(core::DescriptorEventReceiver* eventReceiver) {
-        muxMod(eventReceiver->getRegisteredFd(), events, eventReceiver);
-    }
-
-    void DescriptorEventPublisher::EPollEvents::muxOff(DescriptorEventReceiver* eventReceiver) {
-        muxMod(eventReceiver->getRegisteredFd(), 0, eventReceiver);
-    }
-
-    int DescriptorEventPublisher::EPollEvents::getEPFd() const {
-        return epfd;
-    }
-
-    epoll_event* DescriptorEventPublisher::EPollEvents::getEvents() {
-        return ePollEvents.data();
-    }
-
-    int DescriptorEventPublisher::EPollEvents::getInterestCount() const {
-        return static_cast<int>(interestCount);
-    }
-
-    DescriptorEventPublisher::DescriptorEventPublisher(const std::string& name, int& epfd, uint32_t events, uint32_t revents)
+    DescriptorEventPublisher::DescriptorEventPublisher(const std::string& name,
+                                                       EPollFdsManager& ePollFds,
+                                                       std::uint32_t events,
+                                                       std::uint32_t revents)
         : core::DescriptorEventPublisher(name)
-        , ePollEvents(epfd, events)
+        , ePollFds(ePollFds)
+        , events(events)
         , revents(revents) {
     }
 
     bool DescriptorEventPublisher::muxAdd(core::DescriptorEventReceiver* eventReceiver) {
-        return ePollEvents.muxAdd(eventReceiver);
+        return ePollFds.muxAdd(eventReceiver, events);
     }
 
     void DescriptorEventPublisher::muxDel(int fd) {
-        ePollEvents.muxDel(fd);
+        ePollFds.muxDel(fd, events);
     }
 
     void DescriptorEventPublisher::muxOn(core::DescriptorEventReceiver* eventReceiver) {
-        ePollEvents.muxOn(eventReceiver);
+        ePollFds.muxOn(eventReceiver, events);
     }
 
     void DescriptorEventPublisher::muxOff(core::DescriptorEventReceiver* eventReceiver) {
-        ePollEvents.muxOff(eventReceiver);
+        ePollFds.muxOff(eventReceiver, events);
     }
 
     void DescriptorEventPublisher::spanActiveEvents() {
-        if (ePollEvents.getEPFd() < 0) {
-            return;
-        }
-
-        const int count = core::system::epoll_wait(ePollEvents.getEPFd(), ePollEvents.getEvents(), ePollEvents.getInterestCount(), 0);
-        if (count < 0) {
-            const int errnum = errno;
-            if (errnum != EINTR) {
-                muxLog().sysError(
-                    logger::LogLevel::Error, errnum, "core.mux epoll_wait failed: interestCount={}", ePollEvents.getInterestCount());
-            }
-            return;
-        }
+        for (const epoll_event& ePollEvent : ePollFds.getActiveEvents()) {
+            core::DescriptorEventReceiver* eventReceiver = ePollFds.getEventReceiver(ePollEvent, events, revents);
 
-        for (int i = 0; i < count; i++) {
-            const epoll_event& ev = ePollEvents.getEvents()[i];
-            core::DescriptorEventReceiver* eventReceiver = static_cast<core::DescriptorEventReceiver*>(ev.data.ptr);
-            if (eventReceiver != nullptr && (ev.events & revents) != 0) {
+            if (eventReceiver != nullptr) {
                 eventCounter++;
                 eventReceiver->span();
             }
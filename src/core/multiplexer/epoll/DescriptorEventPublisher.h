@@ -44,52 +44,25 @@
 
 #include "core/DescriptorEventPublisher.h" // IWYU pragma: export
 
-namespace core {
-    class DescriptorEventReceiver;
-} // namespace core
+namespace core::multiplexer::epoll {
+    class EPollFdsManager;
+} // namespace core::multiplexer::epoll
 
 #ifndef DOXYGEN_SHOULD_SKIP_THIS
 
-#include "core/system/epoll.h"
-
 #include <cstdint>
 #include <string>
-#include <vector>
 
 #endif /* DOXYGEN_SHOULD_SKIP_THIS */
 
 namespace core::multiplexer::epoll {
 
     class DescriptorEventPublisher : public core::DescriptorEventPublisher {
-    private:
-        class EPollEvents {
-        public:
-            explicit EPollEvents(int& epfd, uint32_t event);
-
-        private:
-            bool muxMod(int fd, uint32_t events, core::DescriptorEventReceiver* eventReceiver) const;
-
-        public:
-            bool muxAdd(core::DescriptorEventReceiver* eventReceiver);
-            void muxDel(int fd);
-
-            void muxOn(core::DescriptorEventReceiver* eventReceiver);
-            void muxOff(core::DescriptorEventReceiver* eventReceiver);
-
-            int getEPFd() const;
-            epoll_event* getEvents();
-            int getInterestCount() const;
-
-        private:
-            int& epfd;
-            uint32_t events;
-
-            std::vector<epoll_event> ePollEvents;
-            std::vector<epoll_event>::size_type interestCount = 0;
-        };
-
     public:
-        DescriptorEventPublisher(const std::string& name, int& epfd, uint32_t events, uint32_t revents);
+        DescriptorEventPublisher(const std::string& name,
+                                 core::multiplexer::epoll::EPollFdsManager& ePollFds,
+                                 std::uint32_t events,
+                                 std::uint32_t revents);
 
     private:
         bool muxAdd(core::DescriptorEventReceiver* eventReceiver) override;
@@ -99,8 +72,9 @@ namespace core::multiplexer::epoll {
 
         void spanActiveEvents() override;
 
-        EPollEvents ePollEvents;
-        uint32_t revents;
+        core::multiplexer::epoll::EPollFdsManager& ePollFds;
+        std::uint32_t events;
+        std::uint32_t revents;
     };
 
 } // namespace core::multiplexer::epoll
@@ -41,22 +41,26 @@
 
 #include "core/multiplexer/epoll/EventMultiplexer.h"
 
+#include "core/DescriptorEventReceiver.h"
 #include "core/multiplexer/epoll/DescriptorEventPublisher.h"
 
 #ifndef DOXYGEN_SHOULD_SKIP_THIS
 
+#include "core/system/unistd.h"
 #include "log/LogScopeOwner.h"
 #include "log/Logger.h"
+#include "utils/PreserveErrno.h"
 #include "utils/Timeval.h"
 
-#include <array>
 #include <cerrno>
 #include <string>
+#include <tuple>
+#include <utility>
 
 #endif /* DOXYGEN_SHOULD_SKIP_THIS */
 
 core::EventMultiplexer& EventMultiplexer() {
-    static core::multiplexer::epoll::EventMultiplexer eventMultiplexer;
+    thread_local core::multiplexer::epoll::EventMultiplexer eventMultiplexer;
 
     return eventMultiplexer;
 }
@@ -72,65 +76,247 @@ namespace core::multiplexer::epoll {
         logger::BoundaryLogger muxLog() {
             return muxLogScope().logger(logger::Logger::semanticSink());
         }
+    } // namespace
+
+    EPollFdsManager::EPollFdsManager()
+        : epfd(core::system::epoll_create1(EPOLL_CLOEXEC)) {
+        ePollEvents.resize(1);
+
+        if (epfd < 0) {
+            const int errnum = errno;
+            muxLog().sysError(logger::LogLevel::Critical, errnum, "Core::multiplexer epoll_create1 failed");
+            return;
+        }
+    }
+
+    EPollFdsManager::~EPollFdsManager() {
+        if (epfd >= 0) {
+            core::system::close(epfd);
+        }
+    }
 
-        bool addPublisherToOuterEpoll(int epfd, int publisherFd, core::DescriptorEventPublisher* publisher, const char* publisherName) {
-            epoll_event event{};
-            event.events = EPOLLIN;
-            event.data.ptr = publisher;
+    bool EPollFdsManager::muxAdd(core::DescriptorEventReceiver* eventReceiver, std::uint32_t event) {
+        if (epfd < 0) {
+            errno = EBADF;
+            return false;
+        }
+
+        const int fd = eventReceiver->getRegisteredFd();
+
+        decltype(ePollFds)::iterator it;
+        bool inserted = false;
+        try {
+            std::tie(it, inserted) = ePollFds.try_emplace(fd);
+        } catch (...) {
+            errno = ENOMEM;
+            return false;
+        }
+
+        EPollFd& ePollFd = it->second;
+        const EPollFd previousEPollFd = ePollFd;
+
+        ePollFd.registeredEvents |= event;
+        ePollFd.eventReceivers[slot(event)] = eventReceiver;
 
-            if (core::system::epoll_ctl(epfd, EPOLL_CTL_ADD, publisherFd, &event) == 0) {
-                return true;
+        bool registered = false;
+        if (inserted) {
+            ePollFd.enabledEvents = event;
+
+            epoll_event ePollEvent{};
+            ePollEvent.events = ePollFd.enabledEvents;
+            ePollEvent.data.ptr = &ePollFd;
+
+            if (core::system::epoll_ctl(epfd, EPOLL_CTL_ADD, fd, &ePollEvent) == 0) {
+                registered = true;
+            } else {
+                const int errnum = errno;
+                if (errnum == EEXIST) {
+                    registered = muxMod(fd, ePollFd);
+                } else {
+                    muxLog().sysError(logger::LogLevel::Error, errnum, "core.mux epoll_ctl ADD failed: fd={}", fd);
+                    errno = errnum;
+                }
             }
+        } else {
+            registered = setEnabledEvents(fd, ePollFd, ePollFd.enabledEvents | event);
+        }
+
+        if (!registered) {
+            const utils::PreserveErrno preserveErrno;
+
+            if (inserted) {
+                ePollFds.erase(it);
+            } else {
+                ePollFd = previousEPollFd;
+            }
+        } else if (inserted && ePollFds.size() > ePollEvents.size()) {
+            try {
+                ePollEvents.resize(ePollEvents.size() * 2);
+            } catch (...) { // A too small event array only delays reporting of ready descriptors to the next tick
+            }
+        }
+
+        return registered;
+    }
+
+    void EPollFdsManager::muxDel(int fd, std::uint32_t event) {
+        const utils::PreserveErrno preserveErrno;
+
+        const auto it = ePollFds.find(fd);
+        if (it == ePollFds.end()) {
+            return;
+        }
+
+        EPollFd& ePollFd = it->second;
+
+        ePollFd.registeredEvents &= ~event;
+        ePollFd.eventReceivers[slot(event)] = nullptr;
+
+        if (ePollFd.registeredEvents != 0) {
+            setEnabledEvents(fd, ePollFd, ePollFd.enabledEvents & ~event);
+        } else {
+            ePollFd.enabledEvents = 0;
+
+            if (core::system::epoll_ctl(epfd, EPOLL_CTL_DEL, fd, nullptr) != 0) {
+                const int errnum = errno;
+                if (errnum != EBADF) {
+                    // The kernel still references the entry - keep it, it is reused by a later muxAdd of this fd
+                    muxLog().sysError(logger::LogLevel::Error, errnum, "core.mux epoll_ctl DEL failed: fd={}", fd);
+                    return;
+                }
+            }
+
+            ePollFds.erase(it);
+
+            if (ePollEvents.size() > (ePollFds.size() * 2) + 1) {
+                ePollEvents.resize(ePollEvents.size() / 2);
+                ePollEvents.shrink_to_fit();
+            }
+        }
+    }
+
+    void EPollFdsManager::muxOn(core::DescriptorEventReceiver* eventReceiver, std::uint32_t event) {
+        const int fd = eventReceiver->getRegisteredFd();
+
+        const auto it = ePollFds.find(fd);
+        if (it != ePollFds.end()) {
+            EPollFd& ePollFd = it->second;
 
+            ePollFd.eventReceivers[slot(event)] = eventReceiver;
+            setEnabledEvents(fd, ePollFd, ePollFd.enabledEvents | event);
+        }
+    }
+
+    void EPollFdsManager::muxOff(core::DescriptorEventReceiver* eventReceiver, std::uint32_t event) {
+        const int fd = eventReceiver->getRegisteredFd();
+
+        const auto it = ePollFds.find(fd);
+        if (it != ePollFds.end()) {
+            EPollFd& ePollFd = it->second;
+
+            ePollFd.eventReceivers[slot(event)] = eventReceiver;
+            setEnabledEvents(fd, ePollFd, ePollFd.enabledEvents & ~event);
+        }
+    }
+
+    bool EPollFdsManager::muxMod(int fd, EPollFd& ePollFd) const {
+        if (epfd < 0) {
+            errno = EBADF;
+            return false;
+        }
+
+        epoll_event ePollEvent{ePollFd.enabledEvents, {&ePollFd}};
+
+        if (core::system::epoll_ctl(epfd, EPOLL_CTL_MOD, fd, &ePollEvent) != 0) {
             const int errnum = errno;
-            muxLog().sysError(
-                logger::LogLevel::Error, errnum, "Core::multiplexer epoll_ctl ADD failed: fd={} publisher={}", publisherFd, publisherName);
+            muxLog().sysError(logger::LogLevel::Error, errnum, "core.mux epoll_ctl MOD failed: fd={}", fd);
+            errno = errnum;
             return false;
         }
-    } // namespace
+        return true;
+    }
+
+    bool EPollFdsManager::setEnabledEvents(int fd, EPollFd& ePollFd, std::uint32_t enabledEvents) const {
+        bool success = true;
+
+        if (ePollFd.enabledEvents != enabledEvents) {
+            const std::uint32_t previousEnabledEvents = std::exchange(ePollFd.enabledEvents, enabledEvents);
+
+            success = muxMod(fd, ePollFd);
+            if (!success) {
+                ePollFd.enabledEvents = previousEnabledEvents;
+            }
+        }
+
+        return success;
+    }
+
+    int EPollFdsManager::getEPFd() const {
+        return epfd;
+    }
+
+    epoll_event* EPollFdsManager::getEvents() {
+        return ePollEvents.data();
+    }
+
+    int EPollFdsManager::getMaxEvents() const {
+        return static_cast<int>(ePollEvents.size());
+    }
+
+    void EPollFdsManager::setActiveEventCount(int activeEventCount) {
+        this->activeEventCount = activeEventCount;
+    }
+
+    std::span<const epoll_event> EPollFdsManager::getActiveEvents() const {
+        return {ePollEvents.data(), static_cast<std::size_t>(activeEventCount)};
+    }
+
+    core::DescriptorEventReceiver*
+    EPollFdsManager::getEventReceiver(const epoll_event& ePollEvent, std::uint32_t event, std::uint32_t revents) const {
+        const EPollFd& ePollFd = *static_cast<const EPollFd*>(ePollEvent.data.ptr);
+
+        // EPOLLHUP and EPOLLERR are reported by the kernel even for publishers which have switched their interest off
+        return (ePollEvent.events & (ePollFd.enabledEvents | EPOLLHUP | EPOLLERR) & revents) != 0 ? ePollFd.eventReceivers[slot(event)]
+                                                                                                  : nullptr;
+    }
+
+    std::size_t EPollFdsManager::slot(std::uint32_t event) {
+        return event == EPOLLIN ? core::EventMultiplexer::DISP_TYPE::RD
+                                : event == EPOLLOUT ? core::EventMultiplexer::DISP_TYPE::WR : core::EventMultiplexer::DISP_TYPE::EX;
+    }
 
     EventMultiplexer::EventMultiplexer()
         : core::EventMultiplexer(new core::multiplexer::epoll::DescriptorEventPublisher("READ", //
-                                                                                        epfds[core::EventMultiplexer::DISP_TYPE::RD],
+                                                                                        ePollFdsManager,
                                                                                         EPOLLIN,
                                                                                         EPOLLIN | EPOLLHUP | EPOLLRDHUP | EPOLLERR),
                                  new core::multiplexer::epoll::DescriptorEventPublisher("WRITE", //
-                                                                                        epfds[core::EventMultiplexer::DISP_TYPE::WR],
+                                                                                        ePollFdsManager,
                                                                                         EPOLLOUT,
                                                                                         EPOLLOUT),
                                  new core::multiplexer::epoll::DescriptorEventPublisher("EXCEPT", //
-                                                                                        epfds[core::EventMultiplexer::DISP_TYPE::EX],
+                                                                                        ePollFdsManager,
                                                                                         EPOLLPRI,
-                                                                                        EPOLLPRI))
-        , epfd(core::system::epoll_create1(EPOLL_CLOEXEC)) {
-        if (epfd < 0) {
-            const int errnum = errno;
-            muxLog().sysError(logger::LogLevel::Critical, errnum, "Core::multiplexer epoll_create1 failed");
-            return;
-        }
-
-        bool setupSucceeded = true;
-        setupSucceeded &= addPublisherToOuterEpoll(
-            epfd, epfds[core::EventMultiplexer::DISP_TYPE::RD], descriptorEventPublishers[core::EventMultiplexer::DISP_TYPE::RD], "READ");
-        setupSucceeded &= addPublisherToOuterEpoll(
-            epfd, epfds[core::EventMultiplexer::DISP_TYPE::WR], descriptorEventPublishers[core::EventMultiplexer::DISP_TYPE::WR], "WRITE");
-        setupSucceeded &= addPublisherToOuterEpoll(
-            epfd, epfds[core::EventMultiplexer::DISP_TYPE::EX], descriptorEventPublishers[core::EventMultiplexer::DISP_TYPE::EX], "EXCEPT");
-
-        if (setupSucceeded) {
+                                                                                        EPOLLPRI | EPOLLERR)) {
+        if (ePollFdsManager.getEPFd() >= 0) {
             muxLog().debug("Core::multiplexer: epoll");
         }
     }
 
     int EventMultiplexer::monitorDescriptors(utils::Timeval& tickTimeout, const sigset_t& sigMask) {
-        return core::system::epoll_pwait(epfd, ePollEvents, 3, tickTimeout.getMs(), &sigMask);
+        return core::system::epoll_pwait(
+            ePollFdsManager.getEPFd(), ePollFdsManager.getEvents(), ePollFdsManager.getMaxEvents(), tickTimeout.getMs(), &sigMask);
     }
 
     void EventMultiplexer::spanActiveEvents(int activeDescriptorCount) {
-        for (int i = 0; i < activeDescriptorCount; i++) {
-            if ((ePollEvents[i].events & EPOLLIN) != 0) {
-                static_cast<core::DescriptorEventPublisher*>(ePollEvents[i].data.ptr)->spanActiveEvents();
+        if (activeDescriptorCount > 0) {
+            ePollFdsManager.setActiveEventCount(activeDescriptorCount);
+
+            for (core::DescriptorEventPublisher* const descriptorEventPublisher : descriptorEventPublishers) {
+                descriptorEventPublisher->spanActiveEvents();
             }
+
+            ePollFdsManager.setActiveEventCount(0);
         }
     }
 
@@ -44,14 +44,68 @@
 
 #include "core/EventMultiplexer.h"
 
+namespace core {
+    class DescriptorEventReceiver;
+}
+
 #ifndef DOXYGEN_SHOULD_SKIP_THIS
 
 #include "core/system/epoll.h"
 
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <unordered_map>
+#include <vector>
+
 #endif /* DOXYGEN_SHOULD_SKIP_THIS */
 
 namespace core::multiplexer::epoll {
 
+    // All publishers share one epoll set. Each descriptor is registered once with the combined EPOLLIN|EPOLLOUT|EPOLLPRI mask of
+    // the publishers observing it and not switched off, thus a single epoll_pwait per tick reports every ready descriptor.
+    class EPollFdsManager {
+    public:
+        struct EPollFd {
+            std::uint32_t registeredEvents = 0;                             // Events of all publishers observing the descriptor
+            std::uint32_t enabledEvents = 0;                                // Registered events not switched off
+            std::array<core::DescriptorEventReceiver*, 3> eventReceivers{}; // Active receiver of each publisher
+        };
+
+        EPollFdsManager();
+        ~EPollFdsManager();
+
+        EPollFdsManager(const EPollFdsManager&) = delete;
+        EPollFdsManager& operator=(const EPollFdsManager&) = delete;
+
+        bool muxAdd(core::DescriptorEventReceiver* eventReceiver, std::uint32_t event);
+        void muxDel(int fd, std::uint32_t event);
+        void muxOn(core::DescriptorEventReceiver* eventReceiver, std::uint32_t event);
+        void muxOff(core::DescriptorEventReceiver* eventReceiver, std::uint32_t event);
+
+        int getEPFd() const;
+        epoll_event* getEvents();
+        int getMaxEvents() const;
+
+        void setActiveEventCount(int activeEventCount);
+        std::span<const epoll_event> getActiveEvents() const;
+
+        core::DescriptorEventReceiver* getEventReceiver(const epoll_event& ePollEvent, std::uint32_t event, std::uint32_t revents) const;
+
+    private:
+        bool muxMod(int fd, EPollFd& ePollFd) const;
+        bool setEnabledEvents(int fd, EPollFd& ePollFd, std::uint32_t enabledEvents) const;
+
+        static std::size_t slot(std::uint32_t event);
+
+        int epfd;
+
+        std::unordered_map<int, EPollFd> ePollFds;
+        std::vector<epoll_event> ePollEvents;
+        int activeEventCount = 0;
+    };
+
     class EventMultiplexer : public core::EventMultiplexer {
     public:
         EventMultiplexer();
@@ -61,10 +115,7 @@ namespace core::multiplexer::epoll {
         int monitorDescriptors(utils::Timeval& tickTimeout, const sigset_t& sigMask) override;
         void spanActiveEvents(int activeDescriptorCount) override;
 
-        int epfd;
-
-        int epfds[3];
-        epoll_event ePollEvents[3]{};
+        EPollFdsManager ePollFdsManager;
     };
 
 } // namespace core::multiplexer::epoll
@@ -0,0 +1,96 @@
+/*
+ * SNode.C - A Slim Toolkit for Network Communication
+ * Copyright (C) Volker Christian <me@vchrist.at>
+ *               2020, 2021, 2022, 2023, 2024, 2025, 2026
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+#include "core/multiplexer/io_uring/DescriptorEventPublisher.h"
+
+#include "core/DescriptorEventReceiver.h"
+#include "core/multiplexer/io_uring/EventMultiplexer.h"
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+
+#include <list>
+#include <map>
+#include <vector>
+
+#endif /* DOXYGEN_SHOULD_SKIP_THIS */
+
+namespace core::multiplexer::io_uring {
+
+    DescriptorEventPublisher::DescriptorEventPublisher(const std::string& name,
+                                                       RingFdsManager& ringFds,
+                                                       std::uint32_t events,
+                                                       std::uint32_t revents)
+        : core::DescriptorEventPublisher(name)
+        , ringFds(ringFds)
+        , events(events)
+        , revents(revents) {
+    }
+
+    bool DescriptorEventPublisher::muxAdd(core::DescriptorEventReceiver* eventReceiver) {
+        return ringFds.muxAdd(eventReceiver, events);
+    }
+
+    void DescriptorEventPublisher::muxDel(int fd) {
+        ringFds.muxDel(fd, events);
+    }
+
+    void DescriptorEventPublisher::muxOn(core::DescriptorEventReceiver* eventReceiver) {
+        ringFds.muxOn(eventReceiver, events);
+    }
+
+    void DescriptorEventPublisher::muxOff(core::DescriptorEventReceiver* eventReceiver) {
+        ringFds.muxOff(eventReceiver, events);
+    }
+
+    void DescriptorEventPublisher::spanActiveEvents() {
+        for (const RingFdsManager::ActiveFd& activeFd : ringFds.getActiveFds()) {
+            if ((activeFd.revents & revents) != 0 && ringFds.isEnabled(activeFd.fd, events)) {
+                const auto it = observedEventReceiverLists.find(activeFd.fd);
+
+                if (it != observedEventReceiverLists.end()) {
+                    core::DescriptorEventReceiver* eventReceiver = it->second.front();
+                    eventCounter++;
+                    eventReceiver->span();
+                }
+            }
+        }
+    }
+
+} // namespace core::multiplexer::io_uring
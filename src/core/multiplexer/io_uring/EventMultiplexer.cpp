@@ -0,0 +1,452 @@
+/*
+ * SNode.C - A Slim Toolkit for Network Communication
+ * Copyright (C) Volker Christian <me@vchrist.at>
+ *               2020, 2021, 2022, 2023, 2024, 2025, 2026
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+#include "core/multiplexer/io_uring/EventMultiplexer.h"
+
+#include "core/DescriptorEventReceiver.h"
+#include "core/multiplexer/io_uring/DescriptorEventPublisher.h"
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+
+#include "log/LogScopeOwner.h"
+#include "log/Logger.h"
+#include "utils/Timeval.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#endif /* DOXYGEN_SHOULD_SKIP_THIS */
+
+core::EventMultiplexer& EventMultiplexer() {
+    thread_local core::multiplexer::io_uring::EventMultiplexer eventMultiplexer;
+
+    return eventMultiplexer;
+}
+
+namespace core::multiplexer::io_uring {
+
+    namespace {
+        constexpr unsigned ringEntries = 4096;
+
+        const logger::LogScopeOwner& muxLogScope() {
+            static const logger::LogScopeOwner scope(logger::LogOrigin::Framework, logger::LogBoundary::System, "core.mux", "io_uring");
+            return scope;
+        }
+
+        logger::BoundaryLogger muxLog() {
+            return muxLogScope().logger(logger::Logger::semanticSink());
+        }
+
+        unsigned loadAcquire(unsigned* value) {
+            return std::atomic_ref<unsigned>(*value).load(std::memory_order_acquire);
+        }
+
+        void storeRelease(unsigned* value, unsigned newValue) {
+            std::atomic_ref<unsigned>(*value).store(newValue, std::memory_order_release);
+        }
+
+        template <typename T>
+        T* ringPointer(void* ring, std::uint32_t offset) {
+            return reinterpret_cast<T*>(static_cast<char*>(ring) + offset);
+        }
+
+        std::uint64_t userData(int fd, std::uint32_t token) {
+            return (static_cast<std::uint64_t>(token) << 32) | static_cast<std::uint32_t>(fd);
+        }
+    } // namespace
+
+    RingFdsManager::RingFdsManager() {
+        io_uring_params params{};
+
+        ringFd = core::system::io_uring_setup(ringEntries, &params);
+        if (ringFd < 0) {
+            const int errnum = errno;
+            muxLog().sysError(logger::LogLevel::Error, errnum, "core.mux io_uring_setup failed");
+            return;
+        }
+
+        if ((params.features & IORING_FEAT_EXT_ARG) == 0) {
+            muxLog().error("core.mux io_uring: kernel lacks IORING_FEAT_EXT_ARG");
+            ::close(ringFd);
+            ringFd = -1;
+            return;
+        }
+
+        sqRingSize = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+        cqRingSize = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+        sqesSize = params.sq_entries * sizeof(io_uring_sqe);
+
+        if ((params.features & IORING_FEAT_SINGLE_MMAP) != 0) {
+            sqRingSize = cqRingSize = std::max(sqRingSize, cqRingSize);
+        }
+
+        sqRing = ::mmap(nullptr, sqRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ringFd, IORING_OFF_SQ_RING);
+        cqRing = (params.features & IORING_FEAT_SINGLE_MMAP) != 0
+                     ? sqRing
+                     : ::mmap(nullptr, cqRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ringFd, IORING_OFF_CQ_RING);
+        void* sqesMap = ::mmap(nullptr, sqesSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ringFd, IORING_OFF_SQES);
+
+        if (sqRing == MAP_FAILED || cqRing == MAP_FAILED || sqesMap == MAP_FAILED) {
+            const int errnum = errno;
+            muxLog().sysError(logger::LogLevel::Error, errnum, "core.mux io_uring mmap failed");
+
+            if (sqesMap != MAP_FAILED) {
+                ::munmap(sqesMap, sqesSize);
+            }
+            if (cqRing != MAP_FAILED && cqRing != sqRing) {
+                ::munmap(cqRing, cqRingSize);
+            }
+            if (sqRing != MAP_FAILED) {
+                ::munmap(sqRing, sqRingSize);
+            }
+            sqRing = cqRing = nullptr;
+
+            ::close(ringFd);
+            ringFd = -1;
+            return;
+        }
+
+        sqes = static_cast<io_uring_sqe*>(sqesMap);
+
+        sqHead = ringPointer<unsigned>(sqRing, params.sq_off.head);
+        sqTail = ringPointer<unsigned>(sqRing, params.sq_off.tail);
+        sqArray = ringPointer<unsigned>(sqRing, params.sq_off.array);
+        sqMask = *ringPointer<unsigned>(sqRing, params.sq_off.ring_mask);
+        sqEntries = *ringPointer<unsigned>(sqRing, params.sq_off.ring_entries);
+
+        cqHead = ringPointer<unsigned>(cqRing, params.cq_off.head);
+        cqTail = ringPointer<unsigned>(cqRing, params.cq_off.tail);
+        cqes = ringPointer<io_uring_cqe>(cqRing, params.cq_off.cqes);
+        cqMask = *ringPointer<unsigned>(cqRing, params.cq_off.ring_mask);
+
+        sqeTail = *sqTail;
+    }
+
+    RingFdsManager::~RingFdsManager() {
+        if (ringFd >= 0) {
+            ::munmap(sqes, sqesSize);
+            if (cqRing != sqRing) {
+                ::munmap(cqRing, cqRingSize);
+            }
+            ::munmap(sqRing, sqRingSize);
+            ::close(ringFd);
+        }
+    }
+
+    bool RingFdsManager::muxAdd(core::DescriptorEventReceiver* eventReceiver, std::uint32_t event) {
+        const int fd = eventReceiver->getRegisteredFd();
+
+        if (ringFd < 0) {
+            errno = ENOSYS;
+            return false;
+        }
+
+        int descriptorFlags = -1;
+        do {
+            descriptorFlags = ::fcntl(fd, F_GETFD);
+        } while (descriptorFlags < 0 && errno == EINTR);
+        if (descriptorFlags < 0) {
+            return false;
+        }
+
+        try {
+            RingFd& ringFdEntry = ringFds[fd];
+
+            ringFdEntry.registeredEvents |= event;
+            ringFdEntry.enabledEvents |= event;
+            markDirty(fd, ringFdEntry);
+        } catch (...) {
+            errno = ENOMEM;
+            return false;
+        }
+
+        return true;
+    }
+
+    void RingFdsManager::muxDel(int fd, std::uint32_t event) {
+        const auto it = ringFds.find(fd);
+
+        if (it != ringFds.end()) {
+            RingFd& ringFdEntry = it->second;
+
+            ringFdEntry.registeredEvents &= ~event;
+            ringFdEntry.enabledEvents &= ~event;
+
+            if (ringFdEntry.registeredEvents == 0) {
+                // The descriptor number may be reused before the next tick - the in-flight poll refers to the old file
+                disarm(fd, ringFdEntry);
+                ringFds.erase(it);
+            } else {
+                markDirty(fd, ringFdEntry);
+            }
+        }
+    }
+
+    void RingFdsManager::muxOn(const DescriptorEventReceiver* eventReceiver, std::uint32_t event) {
+        const int fd = eventReceiver->getRegisteredFd();
+        RingFd& ringFdEntry = ringFds.find(fd)->second;
+
+        ringFdEntry.enabledEvents |= event;
+        markDirty(fd, ringFdEntry);
+    }
+
+    void RingFdsManager::muxOff(const DescriptorEventReceiver* eventReceiver, std::uint32_t event) {
+        const int fd = eventReceiver->getRegisteredFd();
+        RingFd& ringFdEntry = ringFds.find(fd)->second;
+
+        ringFdEntry.enabledEvents &= ~event;
+        markDirty(fd, ringFdEntry);
+    }
+
+    void RingFdsManager::markDirty(int fd, RingFd& ringFdEntry) {
+        if (!ringFdEntry.dirty) {
+            ringFdEntry.dirty = true;
+            dirtyFds.push_back(fd);
+        }
+    }
+
+    void RingFdsManager::arm(int fd, RingFd& ringFdEntry) {
+        // An in-flight poll covering all enabled events is kept - spurious completions for switched off events are filtered
+        if (ringFdEntry.token != 0 && (ringFdEntry.enabledEvents == 0 || (ringFdEntry.armedEvents & ringFdEntry.enabledEvents) !=
+                                                                               ringFdEntry.enabledEvents)) {
+            disarm(fd, ringFdEntry);
+        }
+
+        if (ringFdEntry.token == 0 && ringFdEntry.enabledEvents != 0) {
+            io_uring_sqe* sqe = nextSqe();
+
+            if (sqe != nullptr) {
+                if (++nextToken == 0) {
+                    ++nextToken;
+                }
+
+                sqe->opcode = IORING_OP_POLL_ADD;
+                sqe->fd = fd;
+                sqe->poll32_events = ringFdEntry.enabledEvents;
+                sqe->user_data = userData(fd, nextToken);
+
+                ringFdEntry.token = nextToken;
+                ringFdEntry.armedEvents = ringFdEntry.enabledEvents;
+            }
+        }
+    }
+
+    void RingFdsManager::disarm(int fd, RingFd& ringFdEntry) {
+        if (ringFdEntry.token != 0) {
+            io_uring_sqe* sqe = nextSqe();
+
+            if (sqe != nullptr) {
+                sqe->opcode = IORING_OP_POLL_REMOVE;
+                sqe->fd = -1;
+                sqe->addr = userData(fd, ringFdEntry.token);
+                sqe->user_data = 0; // Completions of removals are not of interest
+            }
+
+            // Also the completion of the removed poll (-ECANCELED or a late result) does not match any more
+            ringFdEntry.token = 0;
+            ringFdEntry.armedEvents = 0;
+        }
+    }
+
+    io_uring_sqe* RingFdsManager::nextSqe() {
+        if (sqeTail - loadAcquire(sqHead) >= sqEntries && !flushSqes()) {
+            return nullptr;
+        }
+
+        const unsigned index = sqeTail & sqMask;
+        io_uring_sqe* sqe = &sqes[index];
+
+        std::memset(sqe, 0, sizeof(io_uring_sqe));
+        sqArray[index] = index;
+
+        ++sqeTail;
+        ++pendingSqes;
+
+        return sqe;
+    }
+
+    bool RingFdsManager::flushSqes() {
+        storeRelease(sqTail, sqeTail);
+
+        while (pendingSqes > 0) {
+            const int submitted = core::system::io_uring_enter(ringFd, pendingSqes, 0, 0, nullptr, 0);
+
+            if (submitted < 0) {
+                if (errno == EINTR) {
+                    continue;
+                }
+                const int errnum = errno;
+                muxLog().sysError(logger::LogLevel::Error, errnum, "core.mux io_uring_enter submit failed: pending={}", pendingSqes);
+                return false;
+            }
+
+            pendingSqes -= std::min(pendingSqes, static_cast<unsigned>(submitted));
+
+            if (submitted == 0) {
+                break;
+            }
+        }
+
+        return true;
+    }
+
+    int RingFdsManager::submitAndWait(const utils::Timeval& timeOut, const sigset_t& sigMask) {
+        activeFds.clear();
+
+        if (ringFd < 0) {
+            errno = ENOSYS;
+            return -1;
+        }
+
+        for (const int fd : dirtyFds) {
+            const auto it = ringFds.find(fd);
+
+            if (it != ringFds.end()) {
+                it->second.dirty = false;
+                arm(fd, it->second);
+            }
+        }
+        dirtyFds.clear();
+
+        storeRelease(sqTail, sqeTail);
+
+        const timespec timeSpec = timeOut.getTimespec();
+        __kernel_timespec kernelTimeSpec{timeSpec.tv_sec, timeSpec.tv_nsec};
+
+        io_uring_getevents_arg arg{};
+        arg.sigmask = reinterpret_cast<std::uint64_t>(&sigMask);
+        arg.sigmask_sz = _NSIG / 8;
+        arg.ts = reinterpret_cast<std::uint64_t>(&kernelTimeSpec);
+
+        // Submission of all interest changes of this tick and waiting for completions in one syscall
+        int ret = core::system::io_uring_enter(ringFd, pendingSqes, 1, IORING_ENTER_GETEVENTS | IORING_ENTER_EXT_ARG, &arg, sizeof(arg));
+
+        if (ret >= 0) {
+            pendingSqes -= std::min(pendingSqes, static_cast<unsigned>(ret));
+        } else if (errno == ETIME) {
+            ret = 0;
+        }
+
+        if (ret >= 0 || errno == EINTR) {
+            const int errnum = errno;
+            reapCompletions();
+            errno = errnum;
+        }
+
+        return ret < 0 ? ret : static_cast<int>(activeFds.size());
+    }
+
+    void RingFdsManager::reapCompletions() {
+        unsigned head = *cqHead;
+        const unsigned tail = loadAcquire(cqTail);
+
+        for (; head != tail; ++head) {
+            const io_uring_cqe& cqe = cqes[head & cqMask];
+
+            const auto token = static_cast<std::uint32_t>(cqe.user_data >> 32);
+            const auto fd = static_cast<int>(cqe.user_data & 0xFFFFFFFF);
+
+            if (token != 0) {
+                const auto it = ringFds.find(fd);
+
+                if (it != ringFds.end() && it->second.token == token) {
+                    RingFd& ringFdEntry = it->second;
+
+                    ringFdEntry.token = 0;
+                    ringFdEntry.armedEvents = 0;
+
+                    const std::uint32_t revents = cqe.res >= 0 ? static_cast<std::uint32_t>(cqe.res) : POLLERR;
+                    if (revents != 0) {
+                        activeFds.push_back({fd, revents});
+                    }
+
+                    markDirty(fd, ringFdEntry); // Rearm for the next tick
+                }
+            }
+        }
+
+        storeRelease(cqHead, head);
+    }
+
+    const std::vector<RingFdsManager::ActiveFd>& RingFdsManager::getActiveFds() const {
+        return activeFds;
+    }
+
+    bool RingFdsManager::isEnabled(int fd, std::uint32_t event) const {
+        const auto it = ringFds.find(fd);
+
+        return it != ringFds.end() && (it->second.enabledEvents & event) != 0;
+    }
+
+    EventMultiplexer::EventMultiplexer()
+        : core::EventMultiplexer(new core::multiplexer::io_uring::DescriptorEventPublisher("READ", //
+                                                                                           ringFdsManager,
+                                                                                           POLLIN,
+                                                                                           POLLIN | POLLHUP | POLLRDHUP | POLLERR),
+                                 new core::multiplexer::io_uring::DescriptorEventPublisher("WRITE", //
+                                                                                           ringFdsManager,
+                                                                                           POLLOUT,
+                                                                                           POLLOUT),
+                                 new core::multiplexer::io_uring::DescriptorEventPublisher("EXCEPT", //
+                                                                                           ringFdsManager,
+                                                                                           POLLPRI,
+                                                                                           POLLPRI | POLLERR)) {
+        muxLog().debug("Core::multiplexer: io_uring");
+    }
+
+    int EventMultiplexer::monitorDescriptors(utils::Timeval& tickTimeOut, const sigset_t& sigMask) {
+        return ringFdsManager.submitAndWait(tickTimeOut, sigMask);
+    }
+
+    void EventMultiplexer::spanActiveEvents(int activeDescriptorCount) {
+        if (activeDescriptorCount > 0) {
+            for (core::DescriptorEventPublisher* const descriptorEventPublisher : descriptorEventPublishers) {
+                descriptorEventPublisher->spanActiveEvents();
+            }
+        }
+    }
+
+} // namespace core::multiplexer::io_uring
@@ -0,0 +1,151 @@
+/*
+ * SNode.C - A Slim Toolkit for Network Communication
+ * Copyright (C) Volker Christian <me@vchrist.at>
+ *               2020, 2021, 2022, 2023, 2024, 2025, 2026
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+#ifndef CORE_IO_URING_EVENTDISPATCHER_H
+#define CORE_IO_URING_EVENTDISPATCHER_H
+
+#include "core/EventMultiplexer.h" // IWYU pragma: export
+
+namespace core {
+    class DescriptorEventReceiver;
+}
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+
+#include "core/system/io_uring.h" // IWYU pragma: export
+
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+#endif /* DOXYGEN_SHOULD_SKIP_THIS */
+
+namespace core::multiplexer::io_uring {
+
+    // Readiness is tracked with one-shot IORING_OP_POLL_ADD requests, one per descriptor with the combined interest mask of all
+    // publishers. Interest changes only touch the submission queue; all of them are handed to the kernel together with the wait
+    // for completions in a single io_uring_enter per tick. A one-shot poll checks the current readiness when armed, which gives
+    // the level-triggered semantics the publishers rely on.
+    class RingFdsManager {
+    public:
+        struct RingFd {
+            std::uint32_t registeredEvents = 0; // Events of all publishers observing the descriptor
+            std::uint32_t enabledEvents = 0;    // Registered events not switched off
+            std::uint32_t armedEvents = 0;      // Events of the poll request currently in flight
+            std::uint32_t token = 0;            // Identifies the poll request currently in flight (0 = none)
+            bool dirty = false;
+        };
+
+        struct ActiveFd {
+            int fd;
+            std::uint32_t revents;
+        };
+
+        RingFdsManager();
+        ~RingFdsManager();
+
+        RingFdsManager(const RingFdsManager&) = delete;
+        RingFdsManager& operator=(const RingFdsManager&) = delete;
+
+        bool muxAdd(core::DescriptorEventReceiver* eventReceiver, std::uint32_t event);
+        void muxDel(int fd, std::uint32_t event);
+        void muxOn(const core::DescriptorEventReceiver* eventReceiver, std::uint32_t event);
+        void muxOff(const core::DescriptorEventReceiver* eventReceiver, std::uint32_t event);
+
+        int submitAndWait(const utils::Timeval& timeOut, const sigset_t& sigMask);
+
+        const std::vector<ActiveFd>& getActiveFds() const;
+        bool isEnabled(int fd, std::uint32_t event) const;
+
+    private:
+        void markDirty(int fd, RingFd& ringFd);
+        void arm(int fd, RingFd& ringFd);
+        void disarm(int fd, RingFd& ringFd);
+        void reapCompletions();
+
+        io_uring_sqe* nextSqe();
+        bool flushSqes();
+
+        int ringFd = -1;
+
+        void* sqRing = nullptr;
+        void* cqRing = nullptr;
+        io_uring_sqe* sqes = nullptr;
+        std::size_t sqRingSize = 0;
+        std::size_t cqRingSize = 0;
+        std::size_t sqesSize = 0;
+
+        unsigned* sqHead = nullptr;
+        unsigned* sqTail = nullptr;
+        unsigned* sqArray = nullptr;
+        unsigned sqMask = 0;
+        unsigned sqEntries = 0;
+
+        unsigned* cqHead = nullptr;
+        unsigned* cqTail = nullptr;
+        io_uring_cqe* cqes = nullptr;
+        unsigned cqMask = 0;
+
+        unsigned sqeTail = 0;
+        unsigned pendingSqes = 0;
+
+        std::uint32_t nextToken = 0;
+
+        std::unordered_map<int, RingFd> ringFds;
+        std::vector<int> dirtyFds;
+        std::vector<ActiveFd> activeFds;
+    };
+
+    class EventMultiplexer : public core::EventMultiplexer {
+    public:
+        EventMultiplexer();
+        ~EventMultiplexer() override = default;
+
+    private:
+        int monitorDescriptors(utils::Timeval& tickTimeOut, const sigset_t& sigMask) override;
+        void spanActiveEvents(int activeDescriptorCount) override;
+
+        RingFdsManager ringFdsManager;
+    };
+
+} // namespace core::multiplexer::io_uring
+
+#endif // CORE_IO_URING_EVENTDISPATCHER_H
@@ -62,7 +62,7 @@
 #endif /* DOXYGEN_SHOULD_SKIP_THIS */
 
 core::EventMultiplexer& EventMultiplexer() {
-    static core::multiplexer::poll::EventMultiplexer eventMultiplexer;
+    thread_local core::multiplexer::poll::EventMultiplexer eventMultiplexer;
 
     return eventMultiplexer;
 }
@@ -194,7 +194,7 @@ namespace core::multiplexer::poll {
                                  new core::multiplexer::poll::DescriptorEventPublisher("EXCEPT", //
                                                                                        pollFdsManager,
                                                                                        POLLPRI,
-                                                                                       POLLPRI)) {
+                                                                                       POLLPRI | POLLERR)) {
         muxLog().debug("Core::multiplexer: poll");
     }
 
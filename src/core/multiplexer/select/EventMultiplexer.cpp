@@ -55,7 +55,7 @@
 #endif /* DOXYGEN_SHOULD_SKIP_THIS */
 
 core::EventMultiplexer& EventMultiplexer() {
-    static core::multiplexer::select::EventMultiplexer eventMultiplexer;
+    thread_local core::multiplexer::select::EventMultiplexer eventMultiplexer;
 
     return eventMultiplexer;
 }
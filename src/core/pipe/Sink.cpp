@@ -77,6 +77,17 @@ namespace core::pipe {
         onSourceData(chunk, chunkLen);
     }
 
+    bool Sink::streamFile(const std::shared_ptr<const void>& owner, int fd, off_t offset, std::size_t len) {
+        return onSourceFile(owner, fd, offset, len);
+    }
+
+    bool Sink::onSourceFile([[maybe_unused]] const std::shared_ptr<const void>& owner,
+                            [[maybe_unused]] int fd,
+                            [[maybe_unused]] off_t offset,
+                            [[maybe_unused]] std::size_t len) {
+        return false;
+    }
+
     void Sink::streamEof() {
         onSourceEof();
     }
@@ -49,6 +49,8 @@ namespace core::pipe {
 #ifndef DOXYGEN_SHOULD_SKIP_THIS
 
 #include <cstddef>
+#include <memory>
+#include <sys/types.h>
 
 #endif /* DOXYGEN_SHOULD_SKIP_THIS */
 
@@ -77,6 +79,7 @@ namespace core::pipe {
 
     private:
         void streamData(const char* chunk, std::size_t chunkLen);
+        bool streamFile(const std::shared_ptr<const void>& owner, int fd, off_t offset, std::size_t len);
         void streamEof();
         void streamError(int errnum);
 
@@ -84,6 +87,8 @@ namespace core::pipe {
 
         virtual void onSourceConnect(Source* source) = 0;
         virtual void onSourceData(const char* chunk, std::size_t chunkLen) = 0;
+        // A file range instead of data. Sinks able to pass it on without reading it return true. Declines by default
+        virtual bool onSourceFile(const std::shared_ptr<const void>& owner, int fd, off_t offset, std::size_t len);
         virtual void onSourceEof() = 0;
         virtual void onSourceError(int errnum) = 0;
 
@@ -94,6 +94,20 @@ namespace core::pipe {
         return ret;
     }
 
+    ssize_t Source::sendFile(const std::shared_ptr<const void>& owner, int fd, off_t offset, std::size_t len) {
+        ssize_t ret = static_cast<ssize_t>(len);
+
+        if (sink == nullptr) {
+            ret = -1;
+            errno = EPIPE;
+        } else if (!sink->streamFile(owner, fd, offset, len)) {
+            ret = -1;
+            errno = EOPNOTSUPP;
+        }
+
+        return ret;
+    }
+
     void Source::eof() {
         if (sink != nullptr) {
             sink->streamEof();
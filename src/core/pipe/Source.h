@@ -80,6 +80,8 @@ namespace core::pipe {
 
     protected:
         ssize_t send(const char* chunk, std::size_t chunkLen);
+        // Fails with EOPNOTSUPP if the sink wants the data itself
+        ssize_t sendFile(const std::shared_ptr<const void>& owner, int fd, off_t offset, std::size_t len);
         void eof();
         void error(int errnum);
 
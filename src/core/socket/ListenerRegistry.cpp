@@ -0,0 +1,236 @@
+/*
+ * SNode.C - A Slim Toolkit for Network Communication
+ * Copyright (C) Volker Christian <me@vchrist.at>
+ *               2020, 2021, 2022, 2023, 2024, 2025, 2026
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "core/socket/ListenerRegistry.h"
+
+#include "core/system/socket.h"
+#include "core/system/unistd.h"
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+
+#include "log/LogScopeOwner.h"
+#include "log/Logger.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <sstream>
+#include <sys/un.h>
+#include <unistd.h>
+
+#endif // DOXYGEN_SHOULD_SKIP_THIS
+
+namespace core::socket {
+
+    namespace {
+        constexpr int listenFdsStart = 3; // SD_LISTEN_FDS_START
+
+        logger::BoundaryLogger listenerRegistryLog() {
+            static const logger::LogScopeOwner scope(
+                logger::LogOrigin::Framework, logger::LogBoundary::System, "core.socket.listeners", "registry");
+            return scope.logger(logger::Logger::semanticSink());
+        }
+
+        bool isListening(int fd, int type) {
+            int socketType = 0;
+            int acceptConn = 0;
+            socklen_t optLen = sizeof(socketType);
+
+            const bool typeMatches = core::system::getsockopt(fd, SOL_SOCKET, SO_TYPE, &socketType, &optLen) == 0 && socketType == type;
+            optLen = sizeof(acceptConn);
+
+            return typeMatches && core::system::getsockopt(fd, SOL_SOCKET, SO_ACCEPTCONN, &acceptConn, &optLen) == 0 && acceptConn != 0;
+        }
+
+        std::string sunPath(const sockaddr* sockAddr, socklen_t sockAddrLen) {
+            const std::size_t pathOffset = offsetof(sockaddr_un, sun_path);
+            const std::size_t pathLen = sockAddrLen > pathOffset ? sockAddrLen - pathOffset : 0;
+
+            std::string path(reinterpret_cast<const sockaddr_un*>(sockAddr)->sun_path, pathLen);
+
+            // Abstract names may contain zero bytes, filesystem paths end at the first one
+            return !path.empty() && path[0] != '\0' ? std::string(path.c_str()) : path;
+        }
+
+        bool isBoundTo(int fd, const sockaddr* sockAddr, socklen_t sockAddrLen) {
+            sockaddr_storage boundSockAddr{};
+            socklen_t boundSockAddrLen = sizeof(boundSockAddr);
+
+            bool boundTo = core::system::getsockname(fd, reinterpret_cast<sockaddr*>(&boundSockAddr), &boundSockAddrLen) == 0 &&
+                           boundSockAddr.ss_family == sockAddr->sa_family;
+
+            if (boundTo) {
+                if (sockAddr->sa_family == AF_UNIX) {
+                    boundTo = sunPath(reinterpret_cast<const sockaddr*>(&boundSockAddr), boundSockAddrLen) == sunPath(sockAddr, sockAddrLen);
+                } else {
+                    boundTo = boundSockAddrLen == sockAddrLen && std::memcmp(&boundSockAddr, sockAddr, sockAddrLen) == 0;
+                }
+            }
+
+            return boundTo;
+        }
+    } // namespace
+
+    ListenerRegistry::ListenerRegistry() {
+        inheritSocketActivation();
+    }
+
+    ListenerRegistry::~ListenerRegistry() {
+        for (const Entry& entry : inherited) {
+            core::system::close(entry.fd);
+        }
+    }
+
+    ListenerRegistry& ListenerRegistry::instance() {
+        static ListenerRegistry listenerRegistry;
+
+        return listenerRegistry;
+    }
+
+    void ListenerRegistry::inheritSocketActivation() {
+        const char* listenPid = std::getenv("LISTEN_PID");
+        const char* listenFds = std::getenv("LISTEN_FDS");
+
+        if (listenPid != nullptr && listenFds != nullptr && std::strtol(listenPid, nullptr, 10) == ::getpid()) {
+            const char* listenFdNames = std::getenv("LISTEN_FDNAMES");
+            std::istringstream names(listenFdNames != nullptr ? listenFdNames : "");
+
+            const int count = static_cast<int>(std::strtol(listenFds, nullptr, 10));
+
+            for (int fd = listenFdsStart; fd < listenFdsStart + count; fd++) {
+                std::string name;
+                std::getline(names, name, ':');
+
+                ::fcntl(fd, F_SETFD, FD_CLOEXEC);
+                inherited.push_back({name, fd, nullptr});
+            }
+
+            listenerRegistryLog().info("{} socket(s) inherited via socket activation", count);
+        }
+
+        // Not meant for child processes
+        ::unsetenv("LISTEN_PID");
+        ::unsetenv("LISTEN_FDS");
+        ::unsetenv("LISTEN_FDNAMES");
+    }
+
+    void ListenerRegistry::inherit(int fd, const std::string& name) {
+        const std::lock_guard<std::mutex> lock(mutex);
+
+        inherited.push_back({name, fd, nullptr});
+
+        listenerRegistryLog().debug("Inherited socket {}: {}", name, fd);
+    }
+
+    int ListenerRegistry::claim(const std::string& name, const sockaddr* sockAddr, socklen_t sockAddrLen, int type) {
+        const std::lock_guard<std::mutex> lock(mutex);
+
+        auto entry = std::find_if(inherited.begin(), inherited.end(), [&name, type](const Entry& entry) {
+            return entry.name == name && isListening(entry.fd, type);
+        });
+
+        if (entry == inherited.end()) {
+            entry = std::find_if(inherited.begin(), inherited.end(), [sockAddr, sockAddrLen, type](const Entry& entry) {
+                return isListening(entry.fd, type) && isBoundTo(entry.fd, sockAddr, sockAddrLen);
+            });
+        }
+
+        int fd = -1;
+
+        if (entry != inherited.end()) {
+            fd = entry->fd;
+            inherited.erase(entry);
+        }
+
+        return fd;
+    }
+
+    std::size_t ListenerRegistry::getInheritedCount() const {
+        const std::lock_guard<std::mutex> lock(mutex);
+
+        return inherited.size();
+    }
+
+    void ListenerRegistry::add(const std::string& name, int fd, const std::function<void()>& onHandedOver) {
+        const std::lock_guard<std::mutex> lock(mutex);
+
+        listeners.push_back({name, fd, onHandedOver});
+    }
+
+    void ListenerRegistry::remove(int fd) {
+        const std::lock_guard<std::mutex> lock(mutex);
+
+        listeners.remove_if([fd](const Entry& entry) {
+            return entry.fd == fd;
+        });
+    }
+
+    std::vector<ListenerRegistry::Listener> ListenerRegistry::getListeners() const {
+        const std::lock_guard<std::mutex> lock(mutex);
+
+        std::vector<Listener> result;
+        for (const Entry& entry : listeners) {
+            result.push_back({entry.name, entry.fd});
+        }
+
+        return result;
+    }
+
+    void ListenerRegistry::handedOver() {
+        std::vector<std::function<void()>> onHandedOvers;
+
+        {
+            const std::lock_guard<std::mutex> lock(mutex);
+
+            for (Entry& entry : listeners) {
+                onHandedOvers.push_back(std::move(entry.onHandedOver));
+            }
+            listeners.clear();
+        }
+
+        for (const std::function<void()>& onHandedOver : onHandedOvers) {
+            if (onHandedOver) {
+                onHandedOver();
+            }
+        }
+    }
+
+} // namespace core::socket
@@ -0,0 +1,109 @@
+/*
+ * SNode.C - A Slim Toolkit for Network Communication
+ * Copyright (C) Volker Christian <me@vchrist.at>
+ *               2020, 2021, 2022, 2023, 2024, 2025, 2026
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef CORE_SOCKET_LISTENERREGISTRY_H
+#define CORE_SOCKET_LISTENERREGISTRY_H
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+
+#include <cstddef>
+#include <functional>
+#include <list>
+#include <mutex>
+#include <string>
+#include <sys/socket.h>
+#include <vector>
+
+#endif // DOXYGEN_SHOULD_SKIP_THIS
+
+namespace core::socket {
+
+    // Listening sockets that outlive a process. Descriptors inherited via systemd socket activation (LISTEN_FDS) or received
+    // from a predecessor wait here until a SocketAcceptor claims them instead of binding. Running listeners register
+    // themselves so that they can be handed to a successor.
+    class ListenerRegistry {
+    public:
+        struct Listener {
+            std::string name;
+            int fd;
+        };
+
+        ListenerRegistry(const ListenerRegistry&) = delete;
+        ListenerRegistry& operator=(const ListenerRegistry&) = delete;
+
+        static ListenerRegistry& instance();
+
+        void inherit(int fd, const std::string& name);
+
+        // Matched by name first, then by bound address. Returns -1 if no inherited listener matches
+        int claim(const std::string& name, const sockaddr* sockAddr, socklen_t sockAddrLen, int type);
+
+        std::size_t getInheritedCount() const;
+
+        void add(const std::string& name, int fd, const std::function<void()>& onHandedOver);
+        void remove(int fd);
+
+        std::vector<Listener> getListeners() const;
+
+        // The listeners are now served by a successor: stop accepting on them and keep their bound addresses
+        void handedOver();
+
+    private:
+        ListenerRegistry();
+        ~ListenerRegistry();
+
+        void inheritSocketActivation();
+
+        struct Entry {
+            std::string name;
+            int fd;
+            std::function<void()> onHandedOver;
+        };
+
+        std::list<Entry> inherited;
+        std::list<Entry> listeners;
+
+        mutable std::mutex mutex;
+    };
+
+} // namespace core::socket
+
+#endif // CORE_SOCKET_LISTENERREGISTRY_H
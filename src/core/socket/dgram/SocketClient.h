@@ -0,0 +1,149 @@
+/*
+ * SNode.C - A Slim Toolkit for Network Communication
+ * Copyright (C) Volker Christian <me@vchrist.at>
+ *               2020, 2021, 2022, 2023, 2024, 2025, 2026
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef CORE_SOCKET_DGRAM_SOCKETCLIENT_H
+#define CORE_SOCKET_DGRAM_SOCKETCLIENT_H
+
+#include "core/EventReceiver.h"
+#include "core/socket/Socket.h"         // IWYU pragma: export
+#include "core/socket/State.h"          // IWYU pragma: export
+#include "core/socket/dgram/Datagram.h" // IWYU pragma: export
+#include "log/LogScopeOwner.h"
+#include "log/SemanticLogger.h"
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+
+#include "log/Logger.h"
+
+#include <functional> // IWYU pragma: export
+#include <optional>
+#include <string>
+
+#endif /* DOXYGEN_SHOULD_SKIP_THIS */
+
+namespace core::socket::dgram {
+
+    // connect() binds an endpoint to the remote address, open() leaves it unconnected for sendTo() to any peer
+    template <typename SocketEndpointT>
+    class SocketClient : public core::socket::Socket<typename SocketEndpointT::Config> {
+    private:
+        using Super = core::socket::Socket<typename SocketEndpointT::Config>;
+
+    public:
+        using SocketEndpoint = SocketEndpointT;
+        using SocketAddress = typename SocketEndpoint::SocketAddress;
+        using Config = typename SocketEndpoint::Config;
+
+        SocketClient(const std::string& name,
+                     const std::function<void(SocketEndpoint*, const Datagram&)>& onDatagram,
+                     const std::function<void(SocketEndpoint*)>& onOpen = {},
+                     const std::function<void(SocketEndpoint*)>& onClose = {})
+            : Super(name)
+            , logScope(makeLogScope(name))
+            , onOpen(onOpen)
+            , onDatagram(onDatagram)
+            , onClose(onClose) {
+        }
+
+        explicit SocketClient(const std::function<void(SocketEndpoint*, const Datagram&)>& onDatagram)
+            : SocketClient("", onDatagram) {
+        }
+
+        const SocketClient& connect(const std::function<void(const SocketAddress&, core::socket::State)>& onStatus) const {
+            return start(onStatus, true);
+        }
+
+        const SocketClient& connect(const SocketAddress& remoteAddress,
+                                    const std::function<void(const SocketAddress&, core::socket::State)>& onStatus) const {
+            Super::config->Remote::setSocketAddress(remoteAddress);
+
+            return connect(onStatus);
+        }
+
+        const SocketClient& open(const std::function<void(const SocketAddress&, core::socket::State)>& onStatus) const {
+            return start(onStatus, false);
+        }
+
+        logger::BoundaryLogger log() const {
+            return logScope.logger(logger::Logger::semanticSink());
+        }
+
+    private:
+        const SocketClient& start(const std::function<void(const SocketAddress&, core::socket::State)>& onStatus,
+                                  bool connectRemote) const {
+            core::EventReceiver::atNextTick([config = this->config,
+                                             log = this->log(),
+                                             onOpen = this->onOpen,
+                                             onDatagram = this->onDatagram,
+                                             onClose = this->onClose,
+                                             onStatus,
+                                             connectRemote]() {
+                if (config->Instance::getParent() != nullptr || !config->Instance::getRequired()) {
+                    log.debug(connectRemote ? "Initiating connect" : "Initiating open");
+
+                    new SocketEndpoint(onOpen, onDatagram, onClose, onStatus, config, connectRemote);
+                } else {
+                    log.critical("required");
+                }
+            });
+
+            return *this;
+        }
+
+        static logger::LogScopeOwner makeLogScope(const std::string& instanceName) {
+            return logger::LogScopeOwner(logger::LogOrigin::Framework,
+                                         logger::LogBoundary::Instance,
+                                         "core.socket.dgram",
+                                         instanceName.empty() ? std::nullopt : std::optional<std::string>(instanceName),
+                                         logger::LogRole::Client,
+                                         std::nullopt);
+        }
+
+        logger::LogScopeOwner logScope;
+
+        std::function<void(SocketEndpoint*)> onOpen;
+        std::function<void(SocketEndpoint*, const Datagram&)> onDatagram;
+        std::function<void(SocketEndpoint*)> onClose;
+    };
+
+} // namespace core::socket::dgram
+
+#endif // CORE_SOCKET_DGRAM_SOCKETCLIENT_H
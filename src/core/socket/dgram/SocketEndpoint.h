@@ -0,0 +1,147 @@
+/*
+ * SNode.C - A Slim Toolkit for Network Communication
+ * Copyright (C) Volker Christian <me@vchrist.at>
+ *               2020, 2021, 2022, 2023, 2024, 2025, 2026
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef CORE_SOCKET_DGRAM_SOCKETENDPOINT_H
+#define CORE_SOCKET_DGRAM_SOCKETENDPOINT_H
+
+#include "core/socket/State.h"
+#include "core/socket/dgram/Datagram.h" // IWYU pragma: export
+#include "core/socket/dgram/SocketReader.h"
+#include "core/socket/dgram/SocketWriter.h"
+#include "log/LogScopeOwner.h"
+#include "log/Logger.h"
+#include "log/SemanticLogger.h"
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <string>
+
+#endif /* DOXYGEN_SHOULD_SKIP_THIS */
+
+namespace core::socket::dgram {
+
+    // One bound datagram socket. Servers bind the local address only, clients may also connect it to the remote address.
+    // Unlike a stream connection an endpoint lives until it is closed explicitly or the event loop stops.
+    template <typename PhysicalSocketT, typename ConfigT>
+    class SocketEndpoint
+        : protected SocketReader
+        , protected SocketWriter {
+    public:
+        using PhysicalSocket = PhysicalSocketT;
+        using Config = ConfigT;
+        using SocketAddress = typename PhysicalSocket::SocketAddress;
+
+        SocketEndpoint(const std::function<void(SocketEndpoint*)>& onOpen,
+                       const std::function<void(SocketEndpoint*, const Datagram&)>& onDatagram,
+                       const std::function<void(SocketEndpoint*)>& onClose,
+                       const std::function<void(const SocketAddress&, core::socket::State)>& onStatus,
+                       const std::shared_ptr<Config>& config,
+                       bool connectRemote);
+
+    private:
+        ~SocketEndpoint() override;
+
+    public:
+        // Queued and sent with the next write event, together with everything else queued until then
+        void sendTo(SocketAddress& peer, const char* data, std::size_t length);
+
+        // Answers the sender of a received datagram
+        void sendTo(const Datagram& datagram, const char* data, std::size_t length);
+
+        // Connected endpoints only
+        void send(const char* data, std::size_t length);
+
+        // Throws SocketAddress::BadSocketAddress for a datagram of an unnamed sender
+        SocketAddress getPeerAddress(const Datagram& datagram) const;
+
+        const SocketAddress& getLocalAddress() const;
+
+        Config& getConfig() const;
+
+        void close();
+
+        using SocketReader::getReadStats;
+        using SocketWriter::getQueuedDatagrams;
+        using SocketWriter::getWriteStats;
+
+        logger::BoundaryLogger log() const {
+            return logScope.logger(logger::Logger::semanticSink());
+        }
+
+    private:
+        void init();
+
+        void onDatagram(const Datagram& datagram) final;
+        void onReadError(int errnum) final;
+        void onWriteError(int errnum) final;
+
+        void unobservedEvent() final;
+
+        static logger::LogScopeOwner makeLogScope(const std::string& instanceName, bool connectRemote) {
+            return logger::LogScopeOwner(logger::LogOrigin::Framework,
+                                         logger::LogBoundary::Instance,
+                                         "core.socket.dgram",
+                                         instanceName.empty() ? std::nullopt : std::optional<std::string>(instanceName),
+                                         connectRemote ? logger::LogRole::Client : logger::LogRole::Server,
+                                         std::nullopt);
+        }
+
+        PhysicalSocket physicalSocket;
+
+        std::function<void(SocketEndpoint*)> onOpen;
+        std::function<void(SocketEndpoint*, const Datagram&)> onDatagramCallback;
+        std::function<void(SocketEndpoint*)> onClose;
+        std::function<void(const SocketAddress&, core::socket::State)> onStatus;
+
+        logger::LogScopeOwner logScope;
+        std::shared_ptr<Config> config;
+
+        bool connectRemote;
+        bool opened = false;
+    };
+
+} // namespace core::socket::dgram
+
+#endif // CORE_SOCKET_DGRAM_SOCKETENDPOINT_H
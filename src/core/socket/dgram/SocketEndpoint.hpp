@@ -0,0 +1,271 @@
+/*
+ * SNode.C - A Slim Toolkit for Network Communication
+ * Copyright (C) Volker Christian <me@vchrist.at>
+ *               2020, 2021, 2022, 2023, 2024, 2025, 2026
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "core/State.h"
+#include "core/socket/dgram/SocketEndpoint.h"
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+
+#include <algorithm>
+#include <cerrno>
+#include <concepts>
+#include <cstring>
+
+#endif // DOXYGEN_SHOULD_SKIP_THIS
+
+namespace core::socket::dgram {
+
+    template <typename PhysicalSocket, typename Config>
+    SocketEndpoint<PhysicalSocket, Config>::SocketEndpoint(const std::function<void(SocketEndpoint*)>& onOpen,
+                                                           const std::function<void(SocketEndpoint*, const Datagram&)>& onDatagram,
+                                                           const std::function<void(SocketEndpoint*)>& onClose,
+                                                           const std::function<void(const SocketAddress&, core::socket::State)>& onStatus,
+                                                           const std::shared_ptr<Config>& config,
+                                                           bool connectRemote)
+        : SocketReader(config->getInstanceName(), config->getBatchSize(), config->getDatagramSize())
+        , SocketWriter(config->getInstanceName(), config->getBatchSize())
+        , onOpen(onOpen)
+        , onDatagramCallback(onDatagram)
+        , onClose(onClose)
+        , onStatus(onStatus)
+        , logScope(makeLogScope(config->getInstanceName(), connectRemote))
+        , config(config)
+        , connectRemote(connectRemote) {
+        if (core::eventLoopState() == core::State::RUNNING) {
+            init();
+        } else {
+            delete this;
+        }
+    }
+
+    template <typename PhysicalSocket, typename Config>
+    SocketEndpoint<PhysicalSocket, Config>::~SocketEndpoint() {
+    }
+
+    template <typename PhysicalSocket, typename Config>
+    void SocketEndpoint<PhysicalSocket, Config>::init() {
+        if (config->getDisabled()) {
+            log().debug("disabled");
+
+            onStatus({}, core::socket::STATE_DISABLED);
+
+            delete this;
+            return;
+        }
+
+        if constexpr (requires { typename Config::Remote; }) {
+            if (connectRemote && config->Remote::resolve([this]() {
+                    if (core::eventLoopState() == core::State::RUNNING) {
+                        init();
+                    } else {
+                        delete this;
+                    }
+                })) {
+                log().debug("resolving remote host");
+
+                return;
+            }
+        }
+
+        core::socket::State state = core::socket::STATE_OK;
+        SocketAddress localAddress;
+
+        try {
+            localAddress = config->Local::getSocketAddress();
+
+            if (physicalSocket.open(config->getSocketOptions(), PhysicalSocket::Flags::NONBLOCK) < 0) {
+                const int errnum = errno;
+                log().sysError(logger::LogLevel::Error, errnum, "open {}", localAddress.toString());
+
+                state = errnum == EMFILE || errnum == ENFILE || errnum == ENOBUFS || errnum == ENOMEM ? core::socket::STATE_ERROR
+                                                                                                     : core::socket::STATE_FATAL;
+            } else if (physicalSocket.bind(localAddress) < 0) {
+                const int errnum = errno;
+                log().sysError(logger::LogLevel::Error, errnum, "bind {}", localAddress.toString());
+
+                state = errnum == EADDRINUSE ? core::socket::STATE_ERROR : core::socket::STATE_FATAL;
+            } else {
+                if constexpr (requires { typename Config::Remote; }) {
+                    if (connectRemote) {
+                        SocketAddress remoteAddress = config->Remote::getSocketAddress();
+
+                        if (physicalSocket.connect(remoteAddress) < 0) {
+                            const int errnum = errno;
+                            log().sysError(logger::LogLevel::Error, errnum, "connect {}", remoteAddress.toString());
+
+                            state = errnum == ENETUNREACH || errnum == EADDRNOTAVAIL || errnum == ECONNREFUSED || errnum == ENOENT
+                                        ? core::socket::STATE_ERROR
+                                        : core::socket::STATE_FATAL;
+                        }
+                    }
+                }
+
+                if (state == core::socket::STATE_OK) {
+                    if constexpr (requires(Config& config) {
+                                      { config.getGro() } -> std::convertible_to<bool>;
+                                  }) {
+                        SocketReader::setGro(config->getGro());
+                    }
+                    if constexpr (requires(Config& config) {
+                                      { config.getGso() } -> std::convertible_to<bool>;
+                                  }) {
+                        SocketWriter::setGso(config->getGso());
+                    }
+
+                    if (SocketReader::enable(physicalSocket.getFd())) {
+                        if (SocketWriter::enable(physicalSocket.getFd())) {
+                            // Resumed by the first queued datagram
+                            SocketWriter::suspend();
+
+                            opened = true;
+                        } else {
+                            SocketReader::disable();
+                        }
+                    }
+
+                    if (!opened) {
+                        log().error("enable {}: failed", physicalSocket.getBindAddress().toString());
+
+                        state = core::socket::STATE(core::socket::STATE_FATAL, ECANCELED, "SocketEndpoint not enabled");
+                    }
+                }
+            }
+        } catch (const typename SocketAddress::BadSocketAddress& badSocketAddress) {
+            log().error("{}", badSocketAddress.what());
+
+            state = core::socket::STATE(badSocketAddress.getState(), badSocketAddress.getErrnum(), badSocketAddress.what());
+        }
+
+        if (opened) {
+            log().info("endpoint opened: {}", physicalSocket.getBindAddress().toString());
+
+            onStatus(physicalSocket.getBindAddress(), state);
+            onOpen(this);
+        } else {
+            onStatus(localAddress, state);
+
+            if (!SocketReader::isEnabled()) {
+                delete this;
+            }
+        }
+    }
+
+    template <typename PhysicalSocket, typename Config>
+    void SocketEndpoint<PhysicalSocket, Config>::sendTo(SocketAddress& peer, const char* data, std::size_t length) {
+        SocketWriter::sendTo(&peer.getSockAddr(), peer.getSockAddrLen(), data, length);
+    }
+
+    template <typename PhysicalSocket, typename Config>
+    void SocketEndpoint<PhysicalSocket, Config>::sendTo(const Datagram& datagram, const char* data, std::size_t length) {
+        SocketWriter::sendTo(datagram.peer, datagram.peerLength, data, length);
+    }
+
+    template <typename PhysicalSocket, typename Config>
+    void SocketEndpoint<PhysicalSocket, Config>::send(const char* data, std::size_t length) {
+        SocketWriter::sendTo(nullptr, 0, data, length);
+    }
+
+    template <typename PhysicalSocket, typename Config>
+    typename SocketEndpoint<PhysicalSocket, Config>::SocketAddress
+    SocketEndpoint<PhysicalSocket, Config>::getPeerAddress(const Datagram& datagram) const {
+        typename SocketAddress::SockAddr sockAddr{};
+        const auto sockAddrLen = static_cast<typename SocketAddress::SockLen>(std::min<std::size_t>(datagram.peerLength, sizeof(sockAddr)));
+
+        if (datagram.peer != nullptr) {
+            std::memcpy(&sockAddr, datagram.peer, sockAddrLen);
+        }
+
+        return SocketAddress(sockAddr, sockAddrLen);
+    }
+
+    template <typename PhysicalSocket, typename Config>
+    const typename SocketEndpoint<PhysicalSocket, Config>::SocketAddress& SocketEndpoint<PhysicalSocket, Config>::getLocalAddress() const {
+        return physicalSocket.getBindAddress();
+    }
+
+    template <typename PhysicalSocket, typename Config>
+    Config& SocketEndpoint<PhysicalSocket, Config>::getConfig() const {
+        return *config;
+    }
+
+    template <typename PhysicalSocket, typename Config>
+    void SocketEndpoint<PhysicalSocket, Config>::close() {
+        if (SocketWriter::isEnabled()) {
+            SocketWriter::disable();
+        }
+        if (SocketReader::isEnabled()) {
+            SocketReader::disable();
+        }
+    }
+
+    template <typename PhysicalSocket, typename Config>
+    void SocketEndpoint<PhysicalSocket, Config>::onDatagram(const Datagram& datagram) {
+        if (onDatagramCallback) {
+            onDatagramCallback(this, datagram);
+        }
+    }
+
+    template <typename PhysicalSocket, typename Config>
+    void SocketEndpoint<PhysicalSocket, Config>::onReadError(int errnum) {
+        // Connected sockets report ICMP errors of earlier sends here. The endpoint stays usable.
+        log().sysError(logger::LogLevel::Debug, errnum, "receive");
+    }
+
+    template <typename PhysicalSocket, typename Config>
+    void SocketEndpoint<PhysicalSocket, Config>::onWriteError(int errnum) {
+        log().sysError(logger::LogLevel::Debug, errnum, "send: datagram dropped");
+    }
+
+    template <typename PhysicalSocket, typename Config>
+    void SocketEndpoint<PhysicalSocket, Config>::unobservedEvent() {
+        if (opened && onClose) {
+            onClose(this);
+        }
+
+        log().info("endpoint closed: datagrams received={} sent={} dropped={}",
+                   SocketReader::getReadStats().datagrams,
+                   SocketWriter::getWriteStats().datagrams,
+                   SocketWriter::getWriteStats().dropped);
+
+        delete this;
+    }
+
+} // namespace core::socket::dgram
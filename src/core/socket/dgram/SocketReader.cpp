@@ -0,0 +1,177 @@
+/*
+ * SNode.C - A Slim Toolkit for Network Communication
+ * Copyright (C) Volker Christian <me@vchrist.at>
+ *               2020, 2021, 2022, 2023, 2024, 2025, 2026
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "core/socket/dgram/SocketReader.h"
+
+#include "core/socket/dgram/Datagram.h"
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+
+#include "core/system/socket.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <netinet/in.h>
+#include <netinet/udp.h>
+
+#endif // DOXYGEN_SHOULD_SKIP_THIS
+
+namespace core::socket::dgram {
+
+    namespace {
+
+        // Bounds the time one busy socket holds the event loop
+        constexpr int MAX_BATCHES_PER_EVENT = 8;
+
+        constexpr std::size_t GRO_BUFFER_SIZE = 65535;
+        constexpr std::size_t CONTROL_SIZE = CMSG_SPACE(sizeof(int));
+
+    } // namespace
+
+    SocketReader::SocketReader(const std::string& instanceName, std::size_t batchSize, std::size_t datagramSize)
+        : core::eventreceiver::ReadEventReceiver(instanceName, core::DescriptorEventReceiver::TIMEOUT::DISABLE)
+        , batchSize(std::max<std::size_t>(batchSize, 1))
+        , datagramSize(std::max<std::size_t>(datagramSize, 1)) {
+    }
+
+    SocketReader::~SocketReader() {
+    }
+
+    const SocketReader::Stats& SocketReader::getReadStats() const {
+        return stats;
+    }
+
+    void SocketReader::setGro(bool gro) {
+        this->gro = gro;
+    }
+
+    void SocketReader::allocate() {
+        const std::size_t bufferSize = gro ? std::max(datagramSize, GRO_BUFFER_SIZE) : datagramSize;
+
+        buffers.resize(batchSize * bufferSize);
+        controls.resize(batchSize * CONTROL_SIZE);
+        peers.resize(batchSize);
+        iovecs.resize(batchSize);
+        headers.resize(batchSize);
+
+        for (std::size_t i = 0; i < batchSize; i++) {
+            iovecs[i] = iovec{.iov_base = buffers.data() + i * bufferSize, .iov_len = bufferSize};
+
+            headers[i] = mmsghdr{};
+            headers[i].msg_hdr.msg_name = &peers[i];
+            headers[i].msg_hdr.msg_iov = &iovecs[i];
+            headers[i].msg_hdr.msg_iovlen = 1;
+            headers[i].msg_hdr.msg_control = controls.data() + i * CONTROL_SIZE;
+        }
+    }
+
+    void SocketReader::readEvent() {
+        if (headers.empty()) {
+            allocate();
+        }
+
+        bool more = true;
+
+        for (int batch = 0; more && batch < MAX_BATCHES_PER_EVENT && isEnabled(); batch++) {
+            for (mmsghdr& header : headers) {
+                header.msg_hdr.msg_namelen = sizeof(sockaddr_storage);
+                header.msg_hdr.msg_controllen = CONTROL_SIZE;
+                header.msg_hdr.msg_flags = 0;
+                header.msg_len = 0;
+            }
+
+            const int count = core::system::recvmmsg(getRegisteredFd(), headers.data(), static_cast<unsigned int>(batchSize), MSG_DONTWAIT);
+
+            if (count > 0) {
+                stats.calls++;
+
+                for (std::size_t i = 0; i < static_cast<std::size_t>(count) && isEnabled(); i++) {
+                    msghdr& message = headers[i].msg_hdr;
+
+                    std::size_t segmentSize = headers[i].msg_len;
+
+                    for (cmsghdr* cmsg = CMSG_FIRSTHDR(&message); cmsg != nullptr; cmsg = CMSG_NXTHDR(&message, cmsg)) {
+                        if (cmsg->cmsg_level == IPPROTO_UDP && cmsg->cmsg_type == UDP_GRO) {
+                            int groSize = 0;
+                            std::memcpy(&groSize, CMSG_DATA(cmsg), sizeof(groSize));
+
+                            segmentSize = groSize > 0 ? static_cast<std::size_t>(groSize) : segmentSize;
+                        }
+                    }
+
+                    if ((message.msg_flags & MSG_TRUNC) != 0) {
+                        stats.truncated++;
+                    }
+
+                    // An unnamed unix domain socket reports nothing but the address family
+                    const bool named = message.msg_namelen > sizeof(sa_family_t);
+                    const char* data = static_cast<const char*>(message.msg_iov->iov_base);
+
+                    // Runs once for an empty datagram
+                    std::size_t offset = 0;
+                    do {
+                        const Datagram datagram{.data = data + offset,
+                                                .length = std::min<std::size_t>(segmentSize, headers[i].msg_len - offset),
+                                                .peer = named ? static_cast<const sockaddr*>(message.msg_name) : nullptr,
+                                                .peerLength = named ? message.msg_namelen : 0};
+
+                        stats.datagrams++;
+                        stats.bytes += datagram.length;
+
+                        onDatagram(datagram);
+
+                        offset += segmentSize;
+                    } while (offset < headers[i].msg_len && isEnabled());
+                }
+
+                more = static_cast<std::size_t>(count) == batchSize;
+            } else {
+                if (count < 0 && errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR) {
+                    onReadError(errno);
+                }
+
+                more = false;
+            }
+        }
+    }
+
+} // namespace core::socket::dgram
@@ -0,0 +1,107 @@
+/*
+ * SNode.C - A Slim Toolkit for Network Communication
+ * Copyright (C) Volker Christian <me@vchrist.at>
+ *               2020, 2021, 2022, 2023, 2024, 2025, 2026
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef CORE_SOCKET_DGRAM_SOCKETREADER_H
+#define CORE_SOCKET_DGRAM_SOCKETREADER_H
+
+#include "core/eventreceiver/ReadEventReceiver.h"
+
+namespace core::socket::dgram {
+    struct Datagram;
+}
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+
+#include "core/system/socket.h"
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#endif /* DOXYGEN_SHOULD_SKIP_THIS */
+
+namespace core::socket::dgram {
+
+    class SocketReader : public core::eventreceiver::ReadEventReceiver {
+    public:
+        struct Stats {
+            std::size_t datagrams = 0; // Datagrams delivered, GRO segments counted one by one
+            std::size_t bytes = 0;
+            std::size_t calls = 0;     // recvmmsg() calls which returned data
+            std::size_t truncated = 0; // Datagrams larger than the receive buffer
+        };
+
+        SocketReader() = delete;
+
+        const Stats& getReadStats() const;
+
+    protected:
+        SocketReader(const std::string& instanceName, std::size_t batchSize, std::size_t datagramSize);
+
+        ~SocketReader() override;
+
+        // The kernel coalesces datagrams of one flow (UDP_GRO), the receive buffers are sized for a coalesced batch
+        void setGro(bool gro);
+
+    private:
+        void readEvent() final;
+
+        void allocate();
+
+        virtual void onDatagram(const Datagram& datagram) = 0;
+        virtual void onReadError(int errnum) = 0;
+
+        std::size_t batchSize;
+        std::size_t datagramSize;
+        bool gro = false;
+
+        std::vector<char> buffers;
+        std::vector<char> controls;
+        std::vector<sockaddr_storage> peers;
+        std::vector<iovec> iovecs;
+        std::vector<mmsghdr> headers;
+
+        Stats stats;
+    };
+
+} // namespace core::socket::dgram
+
+#endif // CORE_SOCKET_DGRAM_SOCKETREADER_H
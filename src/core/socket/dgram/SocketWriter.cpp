@@ -0,0 +1,210 @@
+/*
+ * SNode.C - A Slim Toolkit for Network Communication
+ * Copyright (C) Volker Christian <me@vchrist.at>
+ *               2020, 2021, 2022, 2023, 2024, 2025, 2026
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "core/socket/dgram/SocketWriter.h"
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+
+#include "core/system/socket.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <netinet/in.h>
+#include <netinet/udp.h>
+
+#endif // DOXYGEN_SHOULD_SKIP_THIS
+
+namespace core::socket::dgram {
+
+    namespace {
+
+        // Limits of the kernel for one UDP_SEGMENT message
+        constexpr std::size_t MAX_GSO_SEGMENTS = 64;
+        constexpr std::size_t MAX_GSO_BYTES = 65507;
+
+        constexpr std::size_t CONTROL_SIZE = CMSG_SPACE(sizeof(std::uint16_t));
+
+    } // namespace
+
+    SocketWriter::SocketWriter(const std::string& instanceName, std::size_t batchSize)
+        : core::eventreceiver::WriteEventReceiver(instanceName, core::DescriptorEventReceiver::TIMEOUT::DISABLE)
+        , batchSize(std::max<std::size_t>(batchSize, 1))
+        , headers(this->batchSize)
+        , iovecs(this->batchSize)
+        , controls(this->batchSize * CONTROL_SIZE)
+        , segments(this->batchSize) {
+    }
+
+    SocketWriter::~SocketWriter() {
+    }
+
+    const SocketWriter::Stats& SocketWriter::getWriteStats() const {
+        return stats;
+    }
+
+    std::size_t SocketWriter::getQueuedDatagrams() const {
+        return pending.size() - next;
+    }
+
+    void SocketWriter::setGso(bool gso) {
+        this->gso = gso;
+    }
+
+    void SocketWriter::sendTo(const sockaddr* peer, socklen_t peerLength, const char* data, std::size_t length) {
+        const bool wasEmpty = next == pending.size();
+
+        Pending entry{.offset = payload.size(), .length = length, .peer = {}, .peerLength = 0};
+        if (peer != nullptr) {
+            entry.peerLength = std::min<socklen_t>(peerLength, sizeof(sockaddr_storage));
+            std::memcpy(&entry.peer, peer, entry.peerLength);
+        }
+
+        payload.insert(payload.end(), data, data + length);
+        pending.push_back(entry);
+
+        // Everything queued until the write event leaves with as few sendmmsg() calls as possible
+        if (wasEmpty && isEnabled() && isSuspended()) {
+            resume();
+        }
+    }
+
+    std::size_t SocketWriter::prepare(std::size_t first, mmsghdr& header, iovec& iov, char* control) {
+        const Pending& lead = pending[first];
+
+        std::size_t count = 1;
+        std::size_t bytes = lead.length;
+
+        if (gso && lead.length > 0) {
+            while (first + count < pending.size() && count < MAX_GSO_SEGMENTS) {
+                const Pending& candidate = pending[first + count];
+
+                if (candidate.length == 0 || candidate.length > lead.length || bytes + candidate.length > MAX_GSO_BYTES ||
+                    candidate.peerLength != lead.peerLength || std::memcmp(&candidate.peer, &lead.peer, lead.peerLength) != 0) {
+                    break;
+                }
+
+                bytes += candidate.length;
+                count++;
+
+                // Only the last segment may be shorter
+                if (candidate.length < lead.length) {
+                    break;
+                }
+            }
+        }
+
+        // Queued datagrams are adjacent in the payload, a segmented message needs one iovec only
+        iov = iovec{.iov_base = payload.data() + lead.offset, .iov_len = bytes};
+
+        header = mmsghdr{};
+        header.msg_hdr.msg_name = lead.peerLength > 0 ? const_cast<sockaddr_storage*>(&lead.peer) : nullptr;
+        header.msg_hdr.msg_namelen = lead.peerLength;
+        header.msg_hdr.msg_iov = &iov;
+        header.msg_hdr.msg_iovlen = 1;
+
+        if (count > 1) {
+            std::memset(control, 0, CONTROL_SIZE);
+
+            header.msg_hdr.msg_control = control;
+            header.msg_hdr.msg_controllen = CONTROL_SIZE;
+
+            cmsghdr* cmsg = CMSG_FIRSTHDR(&header.msg_hdr);
+            cmsg->cmsg_level = IPPROTO_UDP;
+            cmsg->cmsg_type = UDP_SEGMENT;
+            cmsg->cmsg_len = CMSG_LEN(sizeof(std::uint16_t));
+
+            const auto segmentSize = static_cast<std::uint16_t>(lead.length);
+            std::memcpy(CMSG_DATA(cmsg), &segmentSize, sizeof(segmentSize));
+        }
+
+        return count;
+    }
+
+    void SocketWriter::writeEvent() {
+        while (next < pending.size() && isEnabled()) {
+            std::size_t messages = 0;
+
+            for (std::size_t index = next; messages < batchSize && index < pending.size(); messages++) {
+                segments[messages] = prepare(index, headers[messages], iovecs[messages], controls.data() + messages * CONTROL_SIZE);
+                index += segments[messages];
+            }
+
+            const int sent = core::system::sendmmsg(getRegisteredFd(), headers.data(), static_cast<unsigned int>(messages), MSG_DONTWAIT);
+
+            if (sent > 0) {
+                stats.calls++;
+
+                for (std::size_t i = 0; i < static_cast<std::size_t>(sent); i++) {
+                    stats.datagrams += segments[i];
+                    stats.bytes += iovecs[i].iov_len;
+                    next += segments[i];
+                }
+            } else if (errno == EAGAIN || errno == EWOULDBLOCK) {
+                return;
+            } else if (errno == EINTR) {
+                continue;
+            } else if (segments[0] > 1 && (errno == EIO || errno == EINVAL)) {
+                // No segmentation offload on this path, the kernel does not fall back by itself
+                gso = false;
+            } else {
+                const int errnum = errno;
+
+                stats.dropped += segments[0];
+                next += segments[0];
+
+                onWriteError(errnum);
+            }
+        }
+
+        if (next == pending.size()) {
+            payload.clear();
+            pending.clear();
+            next = 0;
+
+            if (isEnabled()) {
+                suspend();
+            }
+        }
+    }
+
+} // namespace core::socket::dgram
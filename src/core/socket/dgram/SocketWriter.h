@@ -0,0 +1,117 @@
+/*
+ * SNode.C - A Slim Toolkit for Network Communication
+ * Copyright (C) Volker Christian <me@vchrist.at>
+ *               2020, 2021, 2022, 2023, 2024, 2025, 2026
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef CORE_SOCKET_DGRAM_SOCKETWRITER_H
+#define CORE_SOCKET_DGRAM_SOCKETWRITER_H
+
+#include "core/eventreceiver/WriteEventReceiver.h"
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+
+#include "core/system/socket.h"
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#endif /* DOXYGEN_SHOULD_SKIP_THIS */
+
+namespace core::socket::dgram {
+
+    class SocketWriter : public core::eventreceiver::WriteEventReceiver {
+    public:
+        struct Stats {
+            std::size_t datagrams = 0; // Datagrams handed to the kernel, GSO segments counted one by one
+            std::size_t bytes = 0;
+            std::size_t calls = 0;   // sendmmsg() calls which sent something
+            std::size_t dropped = 0; // Datagrams refused by the kernel, e.g. EMSGSIZE or ECONNREFUSED
+        };
+
+        SocketWriter() = delete;
+
+        const Stats& getWriteStats() const;
+
+        // Datagrams waiting for the next write event
+        std::size_t getQueuedDatagrams() const;
+
+    protected:
+        SocketWriter(const std::string& instanceName, std::size_t batchSize);
+
+        ~SocketWriter() override;
+
+        // Consecutive equally sized datagrams to the same peer leave as one UDP_SEGMENT message
+        void setGso(bool gso);
+
+        // A peer of nullptr sends on a connected socket
+        void sendTo(const sockaddr* peer, socklen_t peerLength, const char* data, std::size_t length);
+
+    private:
+        void writeEvent() final;
+
+        std::size_t prepare(std::size_t first, mmsghdr& header, iovec& iov, char* control);
+
+        virtual void onWriteError(int errnum) = 0;
+
+        struct Pending {
+            std::size_t offset;
+            std::size_t length;
+            sockaddr_storage peer;
+            socklen_t peerLength;
+        };
+
+        std::size_t batchSize;
+        bool gso = false;
+
+        std::vector<char> payload;
+        std::vector<Pending> pending;
+        std::size_t next = 0;
+
+        std::vector<mmsghdr> headers;
+        std::vector<iovec> iovecs;
+        std::vector<char> controls;
+        std::vector<std::size_t> segments;
+
+        Stats stats;
+    };
+
+} // namespace core::socket::dgram
+
+#endif // CORE_SOCKET_DGRAM_SOCKETWRITER_H
@@ -0,0 +1,272 @@
+/*
+ * SNode.C - A Slim Toolkit for Network Communication
+ * Copyright (C) Volker Christian <me@vchrist.at>
+ *               2020, 2021, 2022, 2023, 2024, 2025, 2026
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "core/socket/stream/ProxySocketContext.h"
+
+#include "core/pipe/Pipe.h"
+#include "core/socket/stream/SocketConnection.h"
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+
+#include <algorithm>
+#include <fcntl.h>
+#include <span>
+#include <sys/ioctl.h>
+#include <utility>
+
+#endif /* DOXYGEN_SHOULD_SKIP_THIS */
+
+namespace core::socket::stream {
+
+    ProxyBridge::ProxyBridge(Mode mode)
+        : mode(mode) {
+    }
+
+    void ProxyBridge::setConnectUpstream(const std::function<void()>& connectUpstream) {
+        this->connectUpstream = connectUpstream;
+    }
+
+    void ProxyBridge::upstreamFailed() {
+        ProxySocketContext* downstream = takeDownstream();
+
+        if (downstream != nullptr) {
+            downstream->close();
+        }
+    }
+
+    ProxyBridge::Mode ProxyBridge::getMode() const {
+        return mode;
+    }
+
+    void ProxyBridge::waitForUpstream(ProxySocketContext* downstream) {
+        waiting.push_back(downstream);
+
+        if (connectUpstream) {
+            connectUpstream();
+        }
+    }
+
+    ProxySocketContext* ProxyBridge::takeDownstream() {
+        ProxySocketContext* downstream = nullptr;
+
+        if (!waiting.empty()) {
+            downstream = waiting.front();
+            waiting.pop_front();
+        }
+
+        return downstream;
+    }
+
+    void ProxyBridge::cancel(ProxySocketContext* downstream) {
+        waiting.erase(std::remove(waiting.begin(), waiting.end(), downstream), waiting.end());
+    }
+
+    ProxySocketContext::ProxySocketContext(SocketConnection* socketConnection,
+                                           const std::shared_ptr<ProxyBridge>& bridge,
+                                           ProxyBridge::Side side)
+        : SocketContext(socketConnection)
+        , bridge(bridge)
+        , side(side) {
+    }
+
+    bool ProxySocketContext::isSplicing() const {
+        return pipe != nullptr;
+    }
+
+    std::size_t ProxySocketContext::getForwarded() const {
+        return forwarded;
+    }
+
+    void ProxySocketContext::onConnected() {
+        if (side == ProxyBridge::Side::Downstream) {
+            // Nothing is read until the upstream connection is there to take it
+            throttle();
+
+            bridge->waitForUpstream(this);
+        } else {
+            ProxySocketContext* downstream = bridge->takeDownstream();
+
+            if (downstream != nullptr) {
+                pair(downstream);
+            } else {
+                log().debug("Proxy: no downstream connection waiting");
+
+                close();
+            }
+        }
+    }
+
+    void ProxySocketContext::onDisconnected() {
+        bridge->cancel(this);
+
+        if (pipe != nullptr) {
+            getSocketConnection()->spliceFromPeer(-1, nullptr);
+        }
+
+        if (peer != nullptr) {
+            ProxySocketContext* orphan = std::exchange(peer, nullptr);
+
+            // Let the peer flush what is queued for it, then close its write direction. What it still receives is discarded
+            orphan->streamEof();
+            orphan->peer = nullptr;
+            if (orphan->pipe != nullptr) {
+                orphan->getSocketConnection()->spliceFromPeer(-1, nullptr);
+            }
+            orphan->unthrottle();
+            orphan->shutdownWrite();
+        }
+    }
+
+    std::size_t ProxySocketContext::onReceivedFromPeer() {
+        const std::span<const char> data = peekFromPeer();
+
+        if (peer != nullptr) {
+            peer->sendToPeer(data.data(), data.size());
+
+            forwarded += data.size();
+        }
+
+        return consumeFromPeer(data.size());
+    }
+
+    bool ProxySocketContext::onSignal([[maybe_unused]] int signum) {
+        return true;
+    }
+
+    void ProxySocketContext::pair(ProxySocketContext* downstream) {
+        peer = downstream;
+        downstream->peer = this;
+
+        for (ProxySocketContext* context : {this, downstream}) {
+            context->peer->streamToPeer(context);
+
+            SocketConnection* socketConnection = context->getSocketConnection();
+            if (bridge->getMode() == ProxyBridge::Mode::Splice && socketConnection->canSpliceFromPeer()) {
+                auto splicePipe = std::make_shared<core::pipe::Pipe>(O_NONBLOCK | O_CLOEXEC);
+
+                if (splicePipe->hasReadFd() && splicePipe->hasWriteFd()) {
+                    const int pipeSize = ::fcntl(splicePipe->getWriteFd(), F_GETPIPE_SZ);
+
+                    context->pipe = splicePipe;
+                    context->pipeSize = pipeSize > 0 ? static_cast<std::size_t>(pipeSize) : 0;
+
+                    socketConnection->spliceFromPeer(splicePipe->getWriteFd(), [context](std::size_t len) {
+                        context->spliced(len);
+                    });
+                } else {
+                    context->log().debug("Proxy: no splice pipe, forwarding by copy: {}", splicePipe->getError());
+                }
+            }
+
+            context->unthrottle();
+        }
+    }
+
+    void ProxySocketContext::spliced(std::size_t len) {
+        if (len > 0 && peer != nullptr) {
+            peer->getSocketConnection()->spliceToPeer(pipe, pipe->getReadFd(), len);
+
+            forwarded += len;
+        }
+
+        // Splicing into a full pipe fails with EAGAIN just as an empty socket does: wait for the peer to drain the pipe
+        const std::size_t pending = inFlight();
+        if (pending >= pipeSize || (len == 0 && pending > 0)) {
+            throttle();
+        }
+    }
+
+    std::size_t ProxySocketContext::inFlight() const {
+        int pending = 0;
+
+        if (pipe != nullptr && ::ioctl(pipe->getReadFd(), FIONREAD, &pending) != 0) {
+            pending = 0;
+        }
+
+        return static_cast<std::size_t>(pending);
+    }
+
+    void ProxySocketContext::throttle() {
+        if (!throttled) {
+            throttled = true;
+
+            getSocketConnection()->suspendReadFromPeer();
+        }
+    }
+
+    void ProxySocketContext::unthrottle() {
+        if (throttled) {
+            throttled = false;
+
+            getSocketConnection()->resumeReadFromPeer();
+        }
+    }
+
+    bool ProxySocketContext::isOpen() {
+        return peer != nullptr;
+    }
+
+    void ProxySocketContext::start() {
+        unthrottle();
+    }
+
+    void ProxySocketContext::suspend() {
+        throttle();
+    }
+
+    void ProxySocketContext::resume() {
+        unthrottle();
+    }
+
+    void ProxySocketContext::stop() {
+        close();
+    }
+
+    ProxySocketContextFactory::ProxySocketContextFactory(const std::shared_ptr<ProxyBridge>& bridge, ProxyBridge::Side side)
+        : bridge(bridge)
+        , side(side) {
+    }
+
+    SocketContext* ProxySocketContextFactory::create(SocketConnection* socketConnection) {
+        return new ProxySocketContext(socketConnection, bridge, side);
+    }
+
+} // namespace core::socket::stream
@@ -0,0 +1,157 @@
+/*
+ * SNode.C - A Slim Toolkit for Network Communication
+ * Copyright (C) Volker Christian <me@vchrist.at>
+ *               2020, 2021, 2022, 2023, 2024, 2025, 2026
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef CORE_SOCKET_STREAM_PROXYSOCKETCONTEXT_H
+#define CORE_SOCKET_STREAM_PROXYSOCKETCONTEXT_H
+
+#include "core/pipe/Source.h"
+#include "core/socket/stream/SocketContext.h"
+#include "core/socket/stream/SocketContextFactory.h"
+
+namespace core::pipe {
+    class Pipe;
+}
+
+namespace core::socket::stream {
+    class SocketConnection;
+    class ProxySocketContext;
+} // namespace core::socket::stream
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+
+#endif /* DOXYGEN_SHOULD_SKIP_THIS */
+
+namespace core::socket::stream {
+
+    // Pairs the connections a proxy server accepts (downstream) with the connections its client opens to the proxied service
+    // (upstream) in the order they are established. Shared by the server and the client side ProxySocketContextFactory.
+    class ProxyBridge {
+    public:
+        // Copy forwards through user space, Splice moves the bytes through a kernel pipe (splice(2)) where both connections allow it
+        enum class Mode { Copy, Splice };
+        enum class Side { Downstream, Upstream };
+
+        explicit ProxyBridge(Mode mode);
+
+        // Called for every accepted downstream connection, usually connects the upstream client
+        void setConnectUpstream(const std::function<void()>& connectUpstream);
+
+        // An upstream connect failed: closes the longest waiting downstream connection
+        void upstreamFailed();
+
+        Mode getMode() const;
+
+    private:
+        void waitForUpstream(ProxySocketContext* downstream);
+        ProxySocketContext* takeDownstream();
+        void cancel(ProxySocketContext* downstream);
+
+        Mode mode;
+        std::function<void()> connectUpstream;
+
+        std::deque<ProxySocketContext*> waiting;
+
+        friend class ProxySocketContext;
+    };
+
+    // Forwards everything received to the paired connection. The writer of the peer throttles reading (core::pipe::Source): it
+    // suspends the reader of this connection while its queue is long, resumes it once drained. A side that closes lets the
+    // other one flush and shut down its write direction.
+    class ProxySocketContext
+        : public SocketContext
+        , private core::pipe::Source {
+    public:
+        ProxySocketContext(SocketConnection* socketConnection, const std::shared_ptr<ProxyBridge>& bridge, ProxyBridge::Side side);
+
+        bool isSplicing() const;
+        std::size_t getForwarded() const;
+
+    private:
+        void onConnected() override;
+        void onDisconnected() override;
+        std::size_t onReceivedFromPeer() override;
+        bool onSignal(int signum) override;
+
+        void pair(ProxySocketContext* peer);
+        void spliced(std::size_t len);
+        std::size_t inFlight() const;
+
+        void throttle();
+        void unthrottle();
+
+        bool isOpen() override;
+        void start() override;
+        void suspend() override;
+        void resume() override;
+        void stop() override;
+
+        std::shared_ptr<ProxyBridge> bridge;
+        ProxyBridge::Side side;
+
+        ProxySocketContext* peer = nullptr;
+
+        // Splice mode: the received bytes on their way to the peer
+        std::shared_ptr<core::pipe::Pipe> pipe;
+        std::size_t pipeSize = 0;
+
+        std::size_t forwarded = 0;
+        bool throttled = false;
+    };
+
+    class ProxySocketContextFactory : public SocketContextFactory {
+    public:
+        ProxySocketContextFactory(const std::shared_ptr<ProxyBridge>& bridge, ProxyBridge::Side side);
+
+        SocketContext* create(SocketConnection* socketConnection) override;
+
+    private:
+        std::shared_ptr<ProxyBridge> bridge;
+        ProxyBridge::Side side;
+    };
+
+} // namespace core::socket::stream
+
+#endif // CORE_SOCKET_STREAM_PROXYSOCKETCONTEXT_H
@@ -0,0 +1,138 @@
+/*
+ * SNode.C - A Slim Toolkit for Network Communication
+ * Copyright (C) Volker Christian <me@vchrist.at>
+ *               2020, 2021, 2022, 2023, 2024, 2025, 2026
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "core/socket/stream/ReadBufferPool.h"
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+
+#include <algorithm>
+
+#endif /* DOXYGEN_SHOULD_SKIP_THIS */
+
+namespace core::socket::stream {
+
+    ReadBufferPool::~ReadBufferPool() {
+        trim(0);
+    }
+
+    ReadBufferPool& ReadBufferPool::instance() {
+        thread_local ReadBufferPool readBufferPool;
+
+        return readBufferPool;
+    }
+
+    char* ReadBufferPool::acquire(std::size_t blockSize) {
+        char* buffer = nullptr;
+
+        std::map<std::size_t, std::vector<char*>>::iterator it = idleBuffers.find(blockSize);
+        if (it != idleBuffers.end() && !it->second.empty()) {
+            buffer = it->second.back();
+            it->second.pop_back();
+
+            stats.idle--;
+            stats.idleBytes -= blockSize;
+            stats.reused++;
+        } else {
+            buffer = new char[blockSize];
+
+            stats.allocated++;
+        }
+
+        stats.leased++;
+        stats.leasedBytes += blockSize;
+        stats.peakLeased = std::max(stats.peakLeased, stats.leased);
+
+        return buffer;
+    }
+
+    void ReadBufferPool::release(char* buffer, std::size_t blockSize) {
+        stats.leased--;
+        stats.leasedBytes -= blockSize;
+
+        idleBuffers[blockSize].push_back(buffer);
+
+        stats.idle++;
+        stats.idleBytes += blockSize;
+
+        if (stats.idleBytes > highWatermark) {
+            trim(lowWatermark);
+        }
+    }
+
+    void ReadBufferPool::setWatermarks(std::size_t lowWatermark, std::size_t highWatermark) {
+        this->highWatermark = highWatermark;
+        this->lowWatermark = std::min(lowWatermark, highWatermark);
+
+        if (stats.idleBytes > this->highWatermark) {
+            trim(this->lowWatermark);
+        }
+    }
+
+    std::size_t ReadBufferPool::getLowWatermark() const {
+        return lowWatermark;
+    }
+
+    std::size_t ReadBufferPool::getHighWatermark() const {
+        return highWatermark;
+    }
+
+    const ReadBufferPool::Stats& ReadBufferPool::getStats() const {
+        return stats;
+    }
+
+    void ReadBufferPool::trim(std::size_t targetBytes) {
+        // Largest buffers first, they give back the most memory per free
+        std::map<std::size_t, std::vector<char*>>::reverse_iterator it = idleBuffers.rbegin();
+        while (stats.idleBytes > targetBytes && it != idleBuffers.rend()) {
+            while (stats.idleBytes > targetBytes && !it->second.empty()) {
+                delete[] it->second.back();
+                it->second.pop_back();
+
+                stats.idle--;
+                stats.idleBytes -= it->first;
+                stats.trimmed++;
+            }
+
+            ++it;
+        }
+    }
+
+} // namespace core::socket::stream
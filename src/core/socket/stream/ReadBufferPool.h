@@ -0,0 +1,105 @@
+/*
+ * SNode.C - A Slim Toolkit for Network Communication
+ * Copyright (C) Volker Christian <me@vchrist.at>
+ *               2020, 2021, 2022, 2023, 2024, 2025, 2026
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef CORE_SOCKET_STREAM_READBUFFERPOOL_H
+#define CORE_SOCKET_STREAM_READBUFFERPOOL_H
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+
+#include <cstddef>
+#include <map>
+#include <vector>
+
+#endif /* DOXYGEN_SHOULD_SKIP_THIS */
+
+namespace core::socket::stream {
+
+    // Receive buffers shared by all connections of one event loop thread. A SocketReader leases a buffer only while it holds
+    // received but unprocessed data, thus idle connections do not pin a buffer. Returned buffers are kept per block size for reuse.
+    // As soon as the idle buffers exceed the high watermark (in bytes) the pool is trimmed down to the low watermark.
+    class ReadBufferPool {
+    public:
+        struct Stats {
+            std::size_t leased = 0;
+            std::size_t peakLeased = 0;
+            std::size_t leasedBytes = 0;
+            std::size_t idle = 0;
+            std::size_t idleBytes = 0;
+            std::size_t allocated = 0; // Leases served by a fresh allocation
+            std::size_t reused = 0;    // Leases served from the idle buffers
+            std::size_t trimmed = 0;   // Idle buffers freed by trimming
+        };
+
+        static constexpr std::size_t defaultLowWatermark = 4 * 1024 * 1024;
+        static constexpr std::size_t defaultHighWatermark = 16 * 1024 * 1024;
+
+        ReadBufferPool(const ReadBufferPool&) = delete;
+        ReadBufferPool& operator=(const ReadBufferPool&) = delete;
+
+        // The pool of the calling event loop thread
+        static ReadBufferPool& instance();
+
+        char* acquire(std::size_t blockSize);
+        void release(char* buffer, std::size_t blockSize);
+
+        void setWatermarks(std::size_t lowWatermark, std::size_t highWatermark);
+        std::size_t getLowWatermark() const;
+        std::size_t getHighWatermark() const;
+
+        const Stats& getStats() const;
+
+    private:
+        ReadBufferPool() = default;
+        ~ReadBufferPool();
+
+        void trim(std::size_t targetBytes);
+
+        std::map<std::size_t, std::vector<char*>> idleBuffers;
+
+        std::size_t lowWatermark = defaultLowWatermark;
+        std::size_t highWatermark = defaultHighWatermark;
+
+        Stats stats;
+    };
+
+} // namespace core::socket::stream
+
+#endif // CORE_SOCKET_STREAM_READBUFFERPOOL_H
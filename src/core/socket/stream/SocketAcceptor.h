@@ -125,6 +125,8 @@ namespace core::socket::stream {
         PhysicalServerSocket physicalServerSocket;
         SocketAddress configuredAddress;
 
+        std::shared_ptr<bool> alive = std::make_shared<bool>(true); // Expires with the acceptor, guards posted hand-overs
+
     protected:
         std::function<void(SocketConnection*)> onConnect;
         std::function<void(SocketConnection*)> onConnected;
@@ -40,7 +40,9 @@
  */
 
 #include "SemanticLog.h"
+#include "core/EventLoop.h"
 #include "core/State.h"
+#include "core/socket/ListenerRegistry.h"
 #include "core/socket/stream/SocketAcceptor.h"
 
 #ifndef DOXYGEN_SHOULD_SKIP_THIS
@@ -113,10 +115,15 @@ namespace core::socket::stream {
 
                 configuredAddress = config->Local::getSocketAddress();
 
-                if (physicalServerSocket.open(config->getSocketOptions(), PhysicalServerSocket::Flags::NONBLOCK) < 0) {
+                // Socket activation or a hand-off from a predecessor may already provide the listener
+                const int inheritedFd = core::socket::ListenerRegistry::instance().claim(
+                    config->getInstanceName(), &configuredAddress.getSockAddr(), configuredAddress.getSockAddrLen(), SOCK_STREAM);
+
+                if ((inheritedFd >= 0 ? physicalServerSocket.adopt(inheritedFd, PhysicalServerSocket::Flags::NONBLOCK)
+                                      : physicalServerSocket.open(config->getSocketOptions(), PhysicalServerSocket::Flags::NONBLOCK)) < 0) {
                     const int errnum = errno;
                     snode::semantic::sysError(snode::semantic::coreSocketLog(), logger::LogLevel::Error, errnum)
-                        << config->getInstanceName() << " open " << configuredAddress.toString();
+                        << config->getInstanceName() << (inheritedFd >= 0 ? " adopt " : " open ") << configuredAddress.toString();
 
                     switch (errnum) {
                         case EMFILE:
@@ -130,10 +137,10 @@ namespace core::socket::stream {
                             break;
                     }
                 } else {
-                    snode::semantic::coreSocketLog().debug()
-                        << config->getInstanceName() << " open " << configuredAddress.toString() << ": success";
+                    snode::semantic::coreSocketLog().debug() << config->getInstanceName() << (inheritedFd >= 0 ? " adopt " : " open ")
+                                                             << configuredAddress.toString() << ": success";
 
-                    if (physicalServerSocket.bind(configuredAddress) < 0) {
+                    if (inheritedFd < 0 && physicalServerSocket.bind(configuredAddress) < 0) {
                         const int errnum = errno;
                         snode::semantic::sysError(snode::semantic::coreSocketLog(), logger::LogLevel::Error, errnum)
                             << config->getInstanceName() << " bind " << configuredAddress.toString();
@@ -160,7 +167,7 @@ namespace core::socket::stream {
                                                                                       : " (effective: " + effectiveBindAddressString + ")")
                             << ": success";
 
-                        if (physicalServerSocket.listen(config->getBacklog()) < 0) {
+                        if (inheritedFd < 0 && physicalServerSocket.listen(config->getBacklog()) < 0) {
                             const int errnum = errno;
                             snode::semantic::sysError(snode::semantic::coreSocketLog(), logger::LogLevel::Error, errnum)
                                 << config->getInstanceName() << " listen " << physicalServerSocket.getBindAddress().toString();
@@ -181,6 +188,18 @@ namespace core::socket::stream {
                                 snode::semantic::coreSocketLog().debug() << config->getInstanceName() << " enable "
                                                                          << physicalServerSocket.getBindAddress().toString() << ": success";
                                 log().info("listener started");
+
+                                core::socket::ListenerRegistry::instance().add(
+                                    config->getInstanceName(),
+                                    physicalServerSocket.getFd(),
+                                    [this, eventLoop = &core::EventLoop::instance(), guard = std::weak_ptr<bool>(alive)]() {
+                                        eventLoop->post([this, guard]() {
+                                            if (!guard.expired()) {
+                                                physicalServerSocket.disown();
+                                                stopListen();
+                                            }
+                                        });
+                                    });
                             } else {
                                 snode::semantic::coreSocketLog().error()
                                     << config->getInstanceName() << " enable " << physicalServerSocket.getBindAddress().toString()
@@ -276,6 +295,8 @@ namespace core::socket::stream {
               typename Config,
               template <typename ConfigT, typename PhysicalSocketServerT> typename SocketConnection>
     void SocketAcceptor<PhysicalSocketServer, Config, SocketConnection>::destruct() {
+        core::socket::ListenerRegistry::instance().remove(physicalServerSocket.getFd());
+
         if (!config->getDisabled()) {
             onInitState(this);
         }
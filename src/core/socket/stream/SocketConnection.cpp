@@ -47,10 +47,13 @@
 
 #ifndef DOXYGEN_SHOULD_SKIP_THIS
 
+#include "core/system/unistd.h"
 #include "log/Logger.h"
 
+#include <algorithm>
 #include <ctime>
 #include <iomanip>
+#include <memory>
 #include <optional>
 #include <sstream>
 #include <utility>
@@ -61,6 +64,13 @@ struct tm;
 
 namespace core::socket::stream {
 
+    namespace {
+
+        // Below this a copy into the write slabs is cheaper than a queued reference of its own
+        constexpr std::size_t minSharedSendLen = 1024;
+
+    } // namespace
+
     SocketConnection::SocketConnection(int fd,
                                        std::uint64_t connectionId,
                                        const std::string& instanceName,
@@ -120,6 +130,94 @@ namespace core::socket::stream {
         sendToPeer(data.data(), data.size());
     }
 
+    void SocketConnection::sendToPeer([[maybe_unused]] const std::shared_ptr<const void>& owner, const char* chunk, std::size_t chunkLen) {
+        sendToPeer(chunk, chunkLen);
+    }
+
+    std::size_t SocketConnection::getBytesHeld() const {
+        return 0;
+    }
+
+    bool SocketConnection::canSendFileToPeer() const {
+        return false;
+    }
+
+    void SocketConnection::sendFileToPeer([[maybe_unused]] const std::shared_ptr<const void>& owner, int fd, off_t offset, std::size_t len) {
+        char chunk[16384];
+
+        while (len > 0) {
+            const ssize_t ret = core::system::pread(fd, chunk, std::min(len, sizeof(chunk)), offset);
+            if (ret <= 0) {
+                break;
+            }
+
+            sendToPeer(chunk, static_cast<std::size_t>(ret));
+
+            offset += ret;
+            len -= static_cast<std::size_t>(ret);
+        }
+    }
+
+    void SocketConnection::spliceToPeer([[maybe_unused]] const std::shared_ptr<const void>& owner, int pipeFd, std::size_t len) {
+        char chunk[16384];
+
+        while (len > 0) {
+            const ssize_t ret = core::system::read(pipeFd, chunk, std::min(len, sizeof(chunk)));
+            if (ret <= 0) {
+                break;
+            }
+
+            sendToPeer(chunk, static_cast<std::size_t>(ret));
+
+            len -= static_cast<std::size_t>(ret);
+        }
+    }
+
+    bool SocketConnection::canSpliceFromPeer() const {
+        return false;
+    }
+
+    void SocketConnection::spliceFromPeer([[maybe_unused]] int pipeFd, [[maybe_unused]] const std::function<void(std::size_t)>& onSpliced) {
+    }
+
+    void SocketConnection::suspendReadFromPeer() {
+    }
+
+    void SocketConnection::resumeReadFromPeer() {
+    }
+
+    void SocketConnection::sendToPeer(std::string&& data) {
+        if (data.size() < minSharedSendLen) {
+            sendToPeer(data.data(), data.size());
+        } else {
+            sendToPeer(std::make_shared<const std::string>(std::move(data)));
+        }
+    }
+
+    void SocketConnection::sendToPeer(std::vector<char>&& data) {
+        if (data.size() < minSharedSendLen) {
+            sendToPeer(data.data(), data.size());
+        } else {
+            sendToPeer(std::make_shared<const std::vector<char>>(std::move(data)));
+        }
+    }
+
+    void SocketConnection::sendToPeer(const std::shared_ptr<const std::string>& data) {
+        if (data->size() < minSharedSendLen) {
+            sendToPeer(data->data(), data->size());
+        } else {
+            sendToPeer(data, data->data(), data->size());
+        }
+    }
+
+    void SocketConnection::sendToPeer(const std::shared_ptr<const std::vector<char>>& data) {
+        if (data->size() < minSharedSendLen) {
+            sendToPeer(data->data(), data->size());
+        } else {
+            sendToPeer(data, data->data(), data->size());
+        }
+    }
+
     const std::string& SocketConnection::getInstanceName() const {
         return instanceName;
     }
@@ -76,7 +76,9 @@ namespace utils {
 #include <functional>
 #include <memory>
 #include <optional>
+#include <span>
 #include <string>
+#include <sys/types.h>
 #include <vector> // IWYU pragma: keep
 
 // IWYU pragma: no_include <format>
@@ -105,10 +107,37 @@ namespace core::socket::stream {
         void sentToPeer(const std::vector<uint8_t>& data);
         void sentToPeer(const std::vector<char>& data);
 
+        // Queue a reference instead of a copy: owner keeps the immutable chunk alive until it is written. Copies by default
+        virtual void sendToPeer(const std::shared_ptr<const void>& owner, const char* chunk, std::size_t chunkLen);
+        void sendToPeer(std::string&& data);
+        void sendToPeer(std::vector<char>&& data);
+        void sendToPeer(const std::shared_ptr<const std::string>& data);
+        void sendToPeer(const std::shared_ptr<const std::vector<char>>& data);
+
+        // Queue len bytes of the file fd starting at offset, owner keeps fd open until they are written. Where the kernel can send
+        // them directly (sendfile) nothing is copied, otherwise the range is read and copied. Copies by default
+        virtual bool canSendFileToPeer() const;
+        virtual void sendFileToPeer(const std::shared_ptr<const void>& owner, int fd, off_t offset, std::size_t len);
+
+        // Queue the next len bytes waiting in the pipe read end pipeFd, owner keeps it open until they are written. They are spliced
+        // straight from the pipe into the socket if the kernel can send them, otherwise read from the pipe and copied. Copies by default
+        virtual void spliceToPeer(const std::shared_ptr<const void>& owner, int pipeFd, std::size_t len);
+
         virtual bool streamToPeer(core::pipe::Source* source) = 0;
         virtual void streamEof() = 0;
 
         virtual std::size_t readFromPeer(char* chunk, std::size_t chunkLen) = 0;
+        virtual std::span<const char> peekFromPeer() const = 0;
+        virtual std::size_t consumeFromPeer(std::size_t len) = 0;
+
+        // Received bytes go into the pipe write end pipeFd instead of the read buffer (splice), onSpliced gets their count. Passing an
+        // empty onSpliced switches back to reading. Not supported by default, e.g. if a record layer has to decrypt them first
+        virtual bool canSpliceFromPeer() const;
+        virtual void spliceFromPeer(int pipeFd, const std::function<void(std::size_t)>& onSpliced);
+
+        // Throttle the peer: nothing is read from the socket in between
+        virtual void suspendReadFromPeer();
+        virtual void resumeReadFromPeer();
 
         virtual void shutdownRead() = 0;
         virtual void shutdownWrite() = 0;
@@ -140,6 +169,9 @@ namespace core::socket::stream {
         virtual std::size_t getTotalRead() const = 0;
         virtual std::size_t getTotalProcessed() const = 0;
 
+        // Memory held for received and queued data, in bytes
+        virtual std::size_t getBytesHeld() const;
+
         std::string getOnlineSince() const;
         std::string getOnlineDuration() const;
 
@@ -209,13 +241,27 @@ namespace core::socket::stream {
         const SocketAddress& getRemoteAddress() const final;
 
         std::size_t readFromPeer(char* chunk, std::size_t chunkLen) final;
+        std::span<const char> peekFromPeer() const final;
+        std::size_t consumeFromPeer(std::size_t len) final;
 
         using Super::sendToPeer;
         void sendToPeer(const char* chunk, std::size_t chunkLen) final;
+        void sendToPeer(const std::shared_ptr<const void>& owner, const char* chunk, std::size_t chunkLen) final;
+
+        bool canSendFileToPeer() const final;
+        void sendFileToPeer(const std::shared_ptr<const void>& owner, int fd, off_t offset, std::size_t len) final;
+
+        void spliceToPeer(const std::shared_ptr<const void>& owner, int pipeFd, std::size_t len) final;
 
         bool streamToPeer(core::pipe::Source* source) final;
         void streamEof() final;
 
+        bool canSpliceFromPeer() const final;
+        void spliceFromPeer(int pipeFd, const std::function<void(std::size_t)>& onSpliced) final;
+
+        void suspendReadFromPeer() final;
+        void resumeReadFromPeer() final;
+
         void shutdownRead() final;
         void shutdownWrite() final;
 
@@ -229,6 +275,8 @@ namespace core::socket::stream {
         std::size_t getTotalRead() const override;
         std::size_t getTotalProcessed() const override;
 
+        std::size_t getBytesHeld() const override;
+
     protected:
         void doWriteShutdown(const std::function<void()>& onShutdown) override;
 
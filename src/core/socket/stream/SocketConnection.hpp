@@ -150,6 +150,8 @@ namespace core::socket::stream {
         , localAddress(getLocalSocketAddress<SocketAddress>(this->physicalSocket, config))
         , remoteAddress(getRemoteSocketAddress<SocketAddress>(this->physicalSocket, config))
         , config(config) {
+        SocketReader::setPersistentInterest(config->getReadPersistentInterest());
+
         if (!SocketReader::enable(this->physicalSocket.getFd())) {
             delete this;
         } else if (!SocketWriter::enable(this->physicalSocket.getFd())) {
@@ -216,11 +218,56 @@ namespace core::socket::stream {
         return ret;
     }
 
+    template <typename PhysicalSocket, typename SocketReader, typename SocketWriter, typename Config>
+    std::span<const char> SocketConnectionT<PhysicalSocket, SocketReader, SocketWriter, Config>::peekFromPeer() const {
+        return newSocketContext == nullptr ? SocketReader::peekFromPeer() : std::span<const char>();
+    }
+
+    template <typename PhysicalSocket, typename SocketReader, typename SocketWriter, typename Config>
+    std::size_t SocketConnectionT<PhysicalSocket, SocketReader, SocketWriter, Config>::consumeFromPeer(std::size_t len) {
+        return newSocketContext == nullptr ? SocketReader::consumeFromPeer(len) : 0;
+    }
+
     template <typename PhysicalSocket, typename SocketReader, typename SocketWriter, typename Config>
     void SocketConnectionT<PhysicalSocket, SocketReader, SocketWriter, Config>::sendToPeer(const char* chunk, std::size_t chunkLen) {
         SocketWriter::sendToPeer(chunk, chunkLen);
     }
 
+    template <typename PhysicalSocket, typename SocketReader, typename SocketWriter, typename Config>
+    void SocketConnectionT<PhysicalSocket, SocketReader, SocketWriter, Config>::sendToPeer(const std::shared_ptr<const void>& owner,
+                                                                                           const char* chunk,
+                                                                                           std::size_t chunkLen) {
+        SocketWriter::sendToPeer(owner, chunk, chunkLen);
+    }
+
+    template <typename PhysicalSocket, typename SocketReader, typename SocketWriter, typename Config>
+    bool SocketConnectionT<PhysicalSocket, SocketReader, SocketWriter, Config>::canSendFileToPeer() const {
+        return SocketWriter::canSendFile();
+    }
+
+    template <typename PhysicalSocket, typename SocketReader, typename SocketWriter, typename Config>
+    void SocketConnectionT<PhysicalSocket, SocketReader, SocketWriter, Config>::sendFileToPeer(const std::shared_ptr<const void>& owner,
+                                                                                               int fd,
+                                                                                               off_t offset,
+                                                                                               std::size_t len) {
+        if (SocketWriter::canSendFile()) {
+            SocketWriter::sendFileToPeer(owner, fd, offset, len);
+        } else {
+            Super::sendFileToPeer(owner, fd, offset, len);
+        }
+    }
+
+    template <typename PhysicalSocket, typename SocketReader, typename SocketWriter, typename Config>
+    void SocketConnectionT<PhysicalSocket, SocketReader, SocketWriter, Config>::spliceToPeer(const std::shared_ptr<const void>& owner,
+                                                                                             int pipeFd,
+                                                                                             std::size_t len) {
+        if (SocketWriter::canSendFile()) {
+            SocketWriter::spliceToPeer(owner, pipeFd, len);
+        } else {
+            Super::spliceToPeer(owner, pipeFd, len);
+        }
+    }
+
     template <typename PhysicalSocket, typename SocketReader, typename SocketWriter, typename Config>
     bool SocketConnectionT<PhysicalSocket, SocketReader, SocketWriter, Config>::streamToPeer(core::pipe::Source* source) {
         return SocketWriter::streamToPeer(source);
@@ -231,6 +278,27 @@ namespace core::socket::stream {
         SocketWriter::streamEof();
     }
 
+    template <typename PhysicalSocket, typename SocketReader, typename SocketWriter, typename Config>
+    bool SocketConnectionT<PhysicalSocket, SocketReader, SocketWriter, Config>::canSpliceFromPeer() const {
+        return SocketReader::canSplice();
+    }
+
+    template <typename PhysicalSocket, typename SocketReader, typename SocketWriter, typename Config>
+    void SocketConnectionT<PhysicalSocket, SocketReader, SocketWriter, Config>::spliceFromPeer(
+        int pipeFd, const std::function<void(std::size_t)>& onSpliced) {
+        SocketReader::spliceFromPeer(pipeFd, onSpliced);
+    }
+
+    template <typename PhysicalSocket, typename SocketReader, typename SocketWriter, typename Config>
+    void SocketConnectionT<PhysicalSocket, SocketReader, SocketWriter, Config>::suspendReadFromPeer() {
+        SocketReader::suspendReading();
+    }
+
+    template <typename PhysicalSocket, typename SocketReader, typename SocketWriter, typename Config>
+    void SocketConnectionT<PhysicalSocket, SocketReader, SocketWriter, Config>::resumeReadFromPeer() {
+        SocketReader::resumeReading();
+    }
+
     template <typename PhysicalSocket, typename SocketReader, typename SocketWriter, typename Config>
     void SocketConnectionT<PhysicalSocket, SocketReader, SocketWriter, Config>::shutdownRead() {
         this->log().trace("Shutdown (RD)");
@@ -293,6 +361,11 @@ namespace core::socket::stream {
         return SocketReader::getTotalProcessed();
     }
 
+    template <typename PhysicalSocket, typename SocketReader, typename SocketWriter, typename Config>
+    std::size_t SocketConnectionT<PhysicalSocket, SocketReader, SocketWriter, Config>::getBytesHeld() const {
+        return SocketReader::getBytesHeld() + SocketWriter::getBytesHeld();
+    }
+
     template <typename PhysicalSocket, typename SocketReader, typename SocketWriter, typename Config>
     void SocketConnectionT<PhysicalSocket, SocketReader, SocketWriter, Config>::doWriteShutdown(const std::function<void()>& onShutdown) {
         errno = 0;
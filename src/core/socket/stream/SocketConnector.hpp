@@ -107,6 +107,19 @@ namespace core::socket::stream {
     void SocketConnector<PhysicalSocketClient, Config, SocketConnection>::init() {
         if (!config->getDisabled()) {
             startAttempt();
+
+            if (config->Remote::resolve([this]() {
+                    if (core::eventLoopState() == core::State::RUNNING) {
+                        init();
+                    } else {
+                        destruct();
+                    }
+                })) {
+                snode::semantic::coreSocketLog().debug() << config->getInstanceName() << " Connect: resolving remote host";
+
+                return;
+            }
+
             try {
                 core::socket::State state = core::socket::STATE_OK;
 
@@ -126,6 +126,30 @@ namespace core::socket::stream {
         socketConnection->sendToPeer(chunk, chunkLen);
     }
 
+    void SocketContext::sendToPeer(std::string&& data) const {
+        socketConnection->sendToPeer(std::move(data));
+    }
+
+    void SocketContext::sendToPeer(std::vector<char>&& data) const {
+        socketConnection->sendToPeer(std::move(data));
+    }
+
+    void SocketContext::sendToPeer(const std::shared_ptr<const std::string>& data) const {
+        socketConnection->sendToPeer(data);
+    }
+
+    void SocketContext::sendToPeer(const std::shared_ptr<const std::vector<char>>& data) const {
+        socketConnection->sendToPeer(data);
+    }
+
+    bool SocketContext::canSendFileToPeer() const {
+        return socketConnection->canSendFileToPeer();
+    }
+
+    void SocketContext::sendFileToPeer(const std::shared_ptr<const void>& owner, int fd, off_t offset, std::size_t len) const {
+        socketConnection->sendFileToPeer(owner, fd, offset, len);
+    }
+
     bool SocketContext::streamToPeer(pipe::Source* source) const {
         return socketConnection->streamToPeer(source);
     }
@@ -142,6 +166,14 @@ namespace core::socket::stream {
         return socketConnection->readFromPeer(chunk, chunklen);
     }
 
+    std::span<const char> SocketContext::peekFromPeer() const {
+        return socketConnection->peekFromPeer();
+    }
+
+    std::size_t SocketContext::consumeFromPeer(std::size_t len) const {
+        return socketConnection->consumeFromPeer(len);
+    }
+
     void SocketContext::setTimeout(const utils::Timeval& timeout) {
         socketConnection->setTimeout(timeout);
     }
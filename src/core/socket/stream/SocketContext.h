@@ -63,8 +63,12 @@ namespace core::socket::stream {
 
 #include <chrono>
 #include <cstddef>
+#include <memory>
 #include <optional>
+#include <span>
 #include <string>
+#include <sys/types.h>
+#include <vector>
 
 #endif /* DOXYGEN_SHOULD_SKIP_THIS */
 
@@ -81,11 +85,21 @@ namespace core::socket::stream {
         using Super::sendToPeer;
 
         void sendToPeer(const char* chunk, std::size_t chunkLen) const final;
+        void sendToPeer(std::string&& data) const;
+        void sendToPeer(std::vector<char>&& data) const;
+        void sendToPeer(const std::shared_ptr<const std::string>& data) const;
+        void sendToPeer(const std::shared_ptr<const std::vector<char>>& data) const;
+        bool canSendFileToPeer() const;
+        void sendFileToPeer(const std::shared_ptr<const void>& owner, int fd, off_t offset, std::size_t len) const;
         bool streamToPeer(core::pipe::Source* source) const;
         void streamEof();
 
         std::size_t readFromPeer(char* chunk, std::size_t chunklen) const final;
 
+        // Parse received data in place: peek at the unread bytes, then consume what was used. Only kept bytes need copying
+        std::span<const char> peekFromPeer() const;
+        std::size_t consumeFromPeer(std::size_t len) const;
+
         void setTimeout(const utils::Timeval& timeout) final;
 
         void shutdownRead();
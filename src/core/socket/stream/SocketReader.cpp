@@ -41,9 +41,12 @@
 
 #include "core/socket/stream/SocketReader.h"
 
+#include "core/socket/stream/ReadBufferPool.h"
+
 #ifndef DOXYGEN_SHOULD_SKIP_THIS
 
 #include "core/system/socket.h"
+#include "core/system/unistd.h"
 
 #include <algorithm>
 #include <cerrno>
@@ -63,6 +66,10 @@ namespace core::socket::stream {
         setBlockSize(blockSize);
     }
 
+    SocketReader::~SocketReader() {
+        releaseReadBuffer();
+    }
+
     std::size_t SocketReader::getTotalRead() const {
         return totalRead;
     }
@@ -71,11 +78,23 @@ namespace core::socket::stream {
         return totalProcessed;
     }
 
+    std::size_t SocketReader::getBytesHeld() const {
+        return readBuffer != nullptr ? readBufferSize : 0;
+    }
+
     void SocketReader::readEvent() {
-        const std::size_t available = doRead();
+        if (readingSuspended) {
+            if (isEnabled() && !isSuspended()) {
+                suspend();
+            }
+        } else if (spliceFd >= 0 && size == 0 && !shutdownInProgress) {
+            doSplice();
+        } else {
+            const std::size_t available = doRead();
 
-        if (available > 0) {
-            onReceivedFromPeer(available);
+            if (available > 0) {
+                onReceivedFromPeer(available);
+            }
         }
     }
 
@@ -94,24 +113,34 @@ namespace core::socket::stream {
 
             ssize_t retRead = 0;
             if (!shutdownInProgress) {
-                const std::size_t readLen = blockSize - size;
-                retRead = read(readBuffer.data() + size, readLen);
+                if (readBuffer == nullptr) {
+                    readBuffer = ReadBufferPool::instance().acquire(blockSize);
+                    readBufferSize = blockSize;
+                }
+
+                retRead = read(readBuffer, readBufferSize);
             }
             if (retRead > 0) {
                 totalRead += static_cast<std::size_t>(retRead);
 
                 size += static_cast<std::size_t>(retRead);
 
-                if (!isSuspended()) {
+                if (!persistentInterest && !isSuspended()) {
                     suspend();
                 }
                 span();
-            } else if (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR) {
-                if (isSuspended()) {
-                    resume();
-                }
             } else {
-                onStatus(errno);
+                const int errnum = errno;
+                releaseReadBuffer();
+                errno = errnum;
+
+                if (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR) {
+                    if (isSuspended()) {
+                        resume();
+                    }
+                } else {
+                    onStatus(errno);
+                }
             }
         } else {
             span();
@@ -120,25 +149,96 @@ namespace core::socket::stream {
         return size;
     }
 
+    void SocketReader::doSplice() {
+        const ssize_t retSplice =
+            core::system::splice(this->getRegisteredFd(), nullptr, spliceFd, nullptr, blockSize, SPLICE_F_MOVE | SPLICE_F_NONBLOCK);
+
+        if (retSplice > 0) {
+            totalRead += static_cast<std::size_t>(retSplice);
+            totalProcessed += static_cast<std::size_t>(retSplice);
+
+            if (!persistentInterest && !isSuspended()) {
+                suspend();
+            }
+            span();
+
+            onSpliced(static_cast<std::size_t>(retSplice));
+        } else if (retSplice < 0 && (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR)) {
+            // Either nothing was received or the pipe is full, only the caller can tell
+            if (isSuspended()) {
+                resume();
+            }
+
+            onSpliced(0);
+        } else {
+            onStatus(errno);
+        }
+    }
+
     void SocketReader::setBlockSize(std::size_t readBlockSize) {
-        readBuffer.resize(readBlockSize);
+        // A currently leased buffer keeps its size until it is released
         blockSize = readBlockSize;
     }
 
+    void SocketReader::setPersistentInterest(bool persistentInterest) {
+        this->persistentInterest = persistentInterest;
+    }
+
+    bool SocketReader::canSplice() const {
+        return false;
+    }
+
+    void SocketReader::spliceFromPeer(int pipeFd, const std::function<void(std::size_t)>& onSpliced) {
+        spliceFd = onSpliced ? pipeFd : -1;
+        this->onSpliced = onSpliced;
+    }
+
+    void SocketReader::suspendReading() {
+        readingSuspended = true;
+
+        if (isEnabled() && !isSuspended()) {
+            suspend();
+        }
+    }
+
+    void SocketReader::resumeReading() {
+        if (readingSuspended) {
+            readingSuspended = false;
+
+            if (isEnabled()) {
+                span();
+            }
+        }
+    }
+
     std::size_t SocketReader::readFromPeer(char* chunk, std::size_t chunkLen) {
         const std::size_t maxReturn = std::min(chunkLen, size);
 
-        std::copy(readBuffer.data() + cursor, readBuffer.data() + cursor + maxReturn, chunk);
+        std::copy(readBuffer + cursor, readBuffer + cursor + maxReturn, chunk);
 
-        cursor += maxReturn;
-        size -= maxReturn;
-        totalProcessed += maxReturn;
+        return consumeFromPeer(maxReturn);
+    }
 
-        return maxReturn;
+    std::span<const char> SocketReader::peekFromPeer() const {
+        return {readBuffer + cursor, size};
+    }
+
+    std::size_t SocketReader::consumeFromPeer(std::size_t len) {
+        len = std::min(len, size);
+
+        cursor += len;
+        size -= len;
+        totalProcessed += len;
+
+        if (size == 0) {
+            releaseReadBuffer();
+        }
+
+        return len;
     }
 
     void SocketReader::shutdownRead() {
-        readBuffer.clear();
+        releaseReadBuffer();
 
         size = 0;
         cursor = 0;
@@ -148,4 +248,14 @@ namespace core::socket::stream {
         setTimeout(terminateTimeout);
     }
 
+    void SocketReader::releaseReadBuffer() {
+        if (readBuffer != nullptr) {
+            ReadBufferPool::instance().release(readBuffer, readBufferSize);
+
+            readBuffer = nullptr;
+            readBufferSize = 0;
+            cursor = 0;
+        }
+    }
+
 } // namespace core::socket::stream
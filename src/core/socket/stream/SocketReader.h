@@ -50,9 +50,9 @@
 
 #include <cstddef>
 #include <functional>
+#include <span>
 #include <string>
 #include <sys/types.h>
-#include <vector>
 
 #endif /* DOXYGEN_SHOULD_SKIP_THIS */
 
@@ -72,31 +72,60 @@ namespace core::socket::stream {
                               std::size_t blockSize,
                               const utils::Timeval& terminateTimeout);
 
+        ~SocketReader() override;
+
         std::size_t getTotalRead() const;
         std::size_t getTotalProcessed() const;
 
+        std::size_t getBytesHeld() const;
+
     private:
         virtual void onReceivedFromPeer(std::size_t available) = 0;
 
         void readEvent() final;
 
         std::size_t doRead();
+        void doSplice();
         void signalEvent(int sigNum) final;
 
     protected:
         virtual ssize_t read(char* chunk, std::size_t chunkLen);
 
         void setBlockSize(std::size_t readBlockSize);
+        void setPersistentInterest(bool persistentInterest);
+
+        // Whether received bytes can be moved into a pipe by splice(2), i.e. no user space record layer sits in between
+        virtual bool canSplice() const;
+        // While pipeFd is valid received bytes are spliced into that pipe instead of being read, onSpliced gets their count or zero
+        // if nothing could be moved. Data already read is delivered first
+        void spliceFromPeer(int pipeFd, const std::function<void(std::size_t)>& onSpliced);
+
+        // Stop and restart taking data from the socket, also if some is still buffered
+        void suspendReading();
+        void resumeReading();
 
         std::size_t readFromPeer(char* chunk, std::size_t chunkLen);
 
+        // The unread part of the read buffer in place. Valid until it is consumed or the next read event
+        std::span<const char> peekFromPeer() const;
+        std::size_t consumeFromPeer(std::size_t len);
+
         void shutdownRead();
 
     private:
+        void releaseReadBuffer();
+
         std::function<void(int)> onStatus;
 
-        std::vector<char> readBuffer;
+        // Leased from the ReadBufferPool of the loop while unprocessed data is held, nullptr otherwise
+        char* readBuffer = nullptr;
+        std::size_t readBufferSize = 0;
         std::size_t blockSize = 0;
+        bool persistentInterest = false;
+        bool readingSuspended = false;
+
+        int spliceFd = -1;
+        std::function<void(std::size_t)> onSpliced;
 
         std::size_t totalRead = 0;
         std::size_t totalProcessed = 0;
@@ -57,6 +57,8 @@
 #include "utils/Random.h"
 
 #include <algorithm>
+#include <atomic>
+#include <concepts>
 #include <cstdint>
 #include <functional> // IWYU pragma: export
 #include <memory>
@@ -111,7 +113,7 @@ namespace core::socket::stream {
 
             ServerFlowController flowController;
             logger::LogScopeOwner logScope;
-            std::uint64_t connectionsCreated{0};
+            std::atomic<std::uint64_t> connectionsCreated{0}; // Shared by all listener shards
 
             std::uint64_t allocateConnectionId() noexcept {
                 return ++connectionsCreated;
@@ -141,7 +143,7 @@ namespace core::socket::stream {
 
             void emitTerminationSummary() const {
                 logScope.logger(logger::Logger::semanticSink())
-                    .info("Instance terminated: connections={} retries={}", connectionsCreated, flowController.getRetryCount());
+                    .info("Instance terminated: connections={} retries={}", connectionsCreated.load(), flowController.getRetryCount());
             }
 
             void emitTerminationSummaryOnce() {
@@ -312,8 +314,51 @@ namespace core::socket::stream {
             return *this;
         }
 
+        // Each secondary event loop gets its own acceptor bound to the same address. The kernel distributes incoming
+        // connections among them (SO_REUSEPORT). Shards are independent of the flow controller and do not retry.
+        void shardListen() const {
+            if constexpr (requires(Config& config) {
+                              { config.getReusePort() } -> std::convertible_to<bool>;
+                          }) {
+                if (core::SNodeC::state() == core::State::INITIALIZED && core::SNodeC::eventLoopIndex() == 0) {
+                    core::SNodeC::atEventLoopStart([config = this->config, sharedContext = this->sharedContext, log = this->log()] {
+                        if (config->getReusePort() && (config->Instance::getParent() != nullptr || !config->Instance::getRequired())) {
+                            log.debug("Initiating listen on event loop {}", core::SNodeC::eventLoopIndex());
+
+                            new SocketAcceptor(
+                                sharedContext->socketContextFactory,
+                                sharedContext->onConnect,
+                                sharedContext->onConnected,
+                                sharedContext->onDisconnect,
+                                [](core::eventreceiver::AcceptEventReceiver*) {
+                                },
+                                [log](const SocketAddress& socketAddress, core::socket::State state) {
+                                    state &= ~core::socket::State::NO_RETRY;
+
+                                    if (state == core::socket::State::OK) {
+                                        log.debug("Listener shard on event loop {}: {}",
+                                                  core::SNodeC::eventLoopIndex(),
+                                                  socketAddress.toString());
+                                    } else {
+                                        log.warn("Listener shard on event loop {} failed: {}",
+                                                 core::SNodeC::eventLoopIndex(),
+                                                 socketAddress.toString());
+                                    }
+                                },
+                                [sharedContext]() {
+                                    return sharedContext->allocateConnectionId();
+                                },
+                                config);
+                        }
+                    });
+                }
+            }
+        }
+
     public:
         const SocketServer& listen(const std::function<void(const SocketAddress&, core::socket::State)>& onStatus) const {
+            shardListen();
+
             return realListen(onStatus, 0, 1);
         }
 
@@ -47,9 +47,12 @@
 #ifndef DOXYGEN_SHOULD_SKIP_THIS
 
 #include "core/system/socket.h"
+#include "core/system/unistd.h"
 #include "log/Logger.h"
 
+#include <algorithm>
 #include <cerrno>
+#include <sys/uio.h>
 
 #endif // DOXYGEN_SHOULD_SKIP_THIS
 
@@ -73,6 +76,10 @@ namespace core::socket::stream {
         return totalQueued;
     }
 
+    std::size_t SocketWriter::getBytesHeld() const {
+        return writePuffer.heldBytes();
+    }
+
     void SocketWriter::writeEvent() {
         if (writeActivationBlocked) {
             if (isEnabled() && !isSuspended()) {
@@ -87,18 +94,51 @@ namespace core::socket::stream {
         return core::system::send(this->getRegisteredFd(), chunk, chunkLen, MSG_NOSIGNAL);
     }
 
+    ssize_t SocketWriter::writev(const iovec* iov, int iovcnt) {
+        msghdr msg{};
+        msg.msg_iov = const_cast<iovec*>(iov);
+        msg.msg_iovlen = static_cast<std::size_t>(iovcnt);
+
+        return core::system::sendmsg(this->getRegisteredFd(), &msg, MSG_NOSIGNAL);
+    }
+
+    bool SocketWriter::canSendFile() const {
+        return false;
+    }
+
+    ssize_t SocketWriter::sendfile(int fd, off_t offset, std::size_t count) {
+        return core::system::sendfile(this->getRegisteredFd(), fd, &offset, count);
+    }
+
+    ssize_t SocketWriter::splice(int pipeFd, std::size_t count) {
+        return core::system::splice(pipeFd, nullptr, this->getRegisteredFd(), nullptr, count, SPLICE_F_MOVE | SPLICE_F_NONBLOCK);
+    }
+
     void SocketWriter::doWrite() {
         if (!writePuffer.empty()) {
-            const std::size_t writeLen = (writePuffer.size() < blockSize) ? writePuffer.size() : blockSize;
-            const ssize_t retWrite = write(writePuffer.data(), writeLen);
+            ssize_t retWrite = 0;
 
-            if (retWrite > 0) {
-                totalSent += static_cast<std::size_t>(retWrite);
-                writePuffer.erase(writePuffer.begin(), writePuffer.begin() + retWrite);
+            WritePuffer::FileRange fileRange;
+            if (writePuffer.frontFile(fileRange)) {
+                if (fileRange.pipe) {
+                    retWrite = splice(fileRange.fd, std::min(fileRange.len, blockSize));
+                } else {
+                    retWrite = sendfile(fileRange.fd, fileRange.offset, std::min(fileRange.len, blockSize));
+                }
 
-                if (writePuffer.capacity() > writePuffer.size() * 2) {
-                    writePuffer.shrink_to_fit();
+                if (retWrite == 0) { // The file has been truncated or the pipe drained behind our back
+                    retWrite = -1;
+                    errno = EIO;
                 }
+            } else {
+                iovec iov[WritePuffer::maxIovecs];
+                const int iovcnt = writePuffer.gather(iov, WritePuffer::maxIovecs, blockSize);
+                retWrite = writev(iov, iovcnt);
+            }
+
+            if (retWrite > 0) {
+                totalSent += static_cast<std::size_t>(retWrite);
+                writePuffer.consume(static_cast<std::size_t>(retWrite));
 
                 if (!isSuspended()) {
                     suspend();
@@ -128,26 +168,71 @@ namespace core::socket::stream {
     }
 
     void SocketWriter::sendToPeer(const char* chunk, std::size_t chunkLen) {
-        if (!shutdownInProgress && !markShutdown) {
-            if (isEnabled()) {
-                const bool wasEmpty = writePuffer.empty();
+        if (acceptsData()) {
+            const bool wasEmpty = writePuffer.empty();
 
-                writePuffer.insert(writePuffer.end(), chunk, chunk + chunkLen);
-                totalQueued += chunkLen;
+            writePuffer.append(chunk, chunkLen);
 
-                if (wasEmpty && !writeActivationBlocked) {
-                    resume();
-                }
+            queued(wasEmpty, chunkLen);
+        }
+    }
 
-                if (source != nullptr && writePuffer.size() > 5 * blockSize) {
-                    source->suspend();
-                }
+    void SocketWriter::sendToPeer(const std::shared_ptr<const void>& owner, const char* chunk, std::size_t chunkLen) {
+        if (acceptsData()) {
+            const bool wasEmpty = writePuffer.empty();
+
+            writePuffer.append(owner, chunk, chunkLen);
+
+            queued(wasEmpty, chunkLen);
+        }
+    }
+
+    void SocketWriter::sendFileToPeer(const std::shared_ptr<const void>& owner, int fd, off_t offset, std::size_t len) {
+        if (acceptsData()) {
+            const bool wasEmpty = writePuffer.empty();
+
+            writePuffer.appendFile(owner, fd, offset, len);
+
+            queued(wasEmpty, len);
+        }
+    }
+
+    void SocketWriter::spliceToPeer(const std::shared_ptr<const void>& owner, int pipeFd, std::size_t len) {
+        if (acceptsData()) {
+            const bool wasEmpty = writePuffer.empty();
+
+            writePuffer.appendPipe(owner, pipeFd, len);
+
+            queued(wasEmpty, len);
+        }
+    }
+
+    bool SocketWriter::acceptsData() const {
+        bool accepts = false;
+
+        if (!shutdownInProgress && !markShutdown) {
+            if (isEnabled()) {
+                accepts = true;
             } else {
                 snode::semantic::coreSocketLog().warn() << getName() << ": Send while not enabled";
             }
         } else {
             snode::semantic::coreSocketLog().warn() << getName() << ": Send while shutdown in progress: ignoring";
         }
+
+        return accepts;
+    }
+
+    void SocketWriter::queued(bool wasEmpty, std::size_t chunkLen) {
+        totalQueued += chunkLen;
+
+        if (wasEmpty && !writeActivationBlocked) {
+            resume();
+        }
+
+        if (source != nullptr && writePuffer.size() > 5 * blockSize) {
+            source->suspend();
+        }
     }
 
     bool SocketWriter::streamToPeer(core::pipe::Source* source) {
@@ -43,6 +43,7 @@
 #define CORE_SOCKET_STREAM_SOCKETWRITER_H
 
 #include "core/eventreceiver/WriteEventReceiver.h"
+#include "core/socket/stream/WritePuffer.h"
 
 namespace core::pipe {
     class Source;
@@ -54,9 +55,9 @@ namespace core::pipe {
 
 #include <cstddef>
 #include <functional>
+#include <memory>
 #include <string>
 #include <sys/types.h>
-#include <vector>
 
 #endif /* DOXYGEN_SHOULD_SKIP_THIS */
 
@@ -79,20 +80,34 @@ namespace core::socket::stream {
         std::size_t getTotalSent() const;
         std::size_t getTotalQueued() const;
 
+        std::size_t getBytesHeld() const;
+
     private:
         void writeEvent() final;
 
         void doWrite();
 
+        bool acceptsData() const;
+        void queued(bool wasEmpty, std::size_t chunkLen);
+
         virtual bool onSignal(int sigNum) = 0;
         virtual void doWriteShutdown(const std::function<void()>& onShutdown) = 0;
 
     protected:
         virtual ssize_t write(const char* chunk, std::size_t chunkLen);
+        virtual ssize_t writev(const iovec* iov, int iovcnt);
+
+        // Whether queued file ranges can be handed to sendfile(2), i.e. no user space record layer sits in between
+        virtual bool canSendFile() const;
+        virtual ssize_t sendfile(int fd, off_t offset, std::size_t count);
+        virtual ssize_t splice(int pipeFd, std::size_t count);
 
         void setBlockSize(std::size_t writeBlockSize);
 
         void sendToPeer(const char* chunk, std::size_t chunkLen);
+        void sendToPeer(const std::shared_ptr<const void>& owner, const char* chunk, std::size_t chunkLen);
+        void sendFileToPeer(const std::shared_ptr<const void>& owner, int fd, off_t offset, std::size_t len);
+        void spliceToPeer(const std::shared_ptr<const void>& owner, int pipeFd, std::size_t len);
         bool streamToPeer(core::pipe::Source* source);
         void streamEof();
 
@@ -110,7 +125,7 @@ namespace core::socket::stream {
     protected:
         std::function<void()> onShutdown;
 
-        std::vector<char> writePuffer;
+        WritePuffer writePuffer;
 
         bool shutdownInProgress = false;
         bool writeActivationBlocked = false;
@@ -0,0 +1,363 @@
+/*
+ * SNode.C - A Slim Toolkit for Network Communication
+ * Copyright (C) Volker Christian <me@vchrist.at>
+ *               2020, 2021, 2022, 2023, 2024, 2025, 2026
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "core/socket/stream/WritePuffer.h"
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+
+#endif /* DOXYGEN_SHOULD_SKIP_THIS */
+
+namespace core::socket::stream {
+
+    namespace {
+
+        // Enough slabs to absorb the churn of a busy loop without pinning the memory of a burst forever
+        constexpr std::size_t maxPooledSlabs = 256;
+
+    } // namespace
+
+    WritePuffer::~WritePuffer() {
+        clear();
+    }
+
+    void WritePuffer::append(const char* chunk, std::size_t chunkLen) {
+        queued += chunkLen;
+
+        while (chunkLen > 0) {
+            if (appendSlab == nullptr || appendSlab->end == slabSize) {
+                appendSlab = acquireSlab();
+                link(appendSlab);
+            }
+
+            const std::size_t copyLen = std::min(chunkLen, slabSize - appendSlab->end);
+            std::memcpy(appendSlab->storage + appendSlab->end, chunk, copyLen);
+
+            appendSlab->end += copyLen;
+            chunk += copyLen;
+            chunkLen -= copyLen;
+        }
+    }
+
+    void WritePuffer::append(const std::shared_ptr<const void>& owner, const char* chunk, std::size_t chunkLen) {
+        if (chunkLen > 0) {
+            SharedSegment* segment = new SharedSegment;
+            segment->data = chunk;
+            segment->end = chunkLen;
+            segment->shared = true;
+            segment->owner = owner;
+
+            link(segment);
+
+            // Copied data following the reference must not go into a slab queued before it
+            appendSlab = nullptr;
+            queued += chunkLen;
+        }
+    }
+
+    void WritePuffer::appendFile(const std::shared_ptr<const void>& owner, int fd, off_t offset, std::size_t len) {
+        if (len > 0) {
+            SharedSegment* segment = new SharedSegment;
+            segment->end = len;
+            segment->shared = true;
+            segment->file = true;
+            segment->owner = owner;
+            segment->fd = fd;
+            segment->offset = offset;
+
+            link(segment);
+
+            appendSlab = nullptr;
+            queued += len;
+        }
+    }
+
+    void WritePuffer::appendPipe(const std::shared_ptr<const void>& owner, int fd, std::size_t len) {
+        if (len > 0) {
+            SharedSegment* segment = new SharedSegment;
+            segment->end = len;
+            segment->shared = true;
+            segment->file = true;
+            segment->owner = owner;
+            segment->fd = fd;
+            segment->pipe = true;
+
+            link(segment);
+
+            appendSlab = nullptr;
+            queued += len;
+        }
+    }
+
+    bool WritePuffer::frontFile(FileRange& fileRange) const {
+        const bool isFile = head != nullptr && head->file;
+
+        if (isFile) {
+            const SharedSegment* segment = static_cast<const SharedSegment*>(head);
+
+            fileRange.fd = segment->fd;
+            fileRange.offset = segment->offset + static_cast<off_t>(segment->begin);
+            fileRange.len = segment->end - segment->begin;
+            fileRange.pipe = segment->pipe;
+        }
+
+        return isFile;
+    }
+
+    int WritePuffer::gather(iovec* iov, std::size_t iovMax, std::size_t maxLen) const {
+        std::size_t iovCount = 0;
+
+        for (const Segment* segment = head; segment != nullptr && !segment->file && iovCount < iovMax && maxLen > 0;
+             segment = segment->next) {
+            const std::size_t len = std::min(segment->end - segment->begin, maxLen);
+
+            iov[iovCount].iov_base = const_cast<char*>(segment->data + segment->begin);
+            iov[iovCount].iov_len = len;
+
+            maxLen -= len;
+            iovCount++;
+        }
+
+        return static_cast<int>(iovCount);
+    }
+
+    void WritePuffer::consume(std::size_t len) {
+        len = std::min(len, queued);
+        queued -= len;
+
+        while (len > 0) {
+            const std::size_t consumeLen = std::min(len, head->end - head->begin);
+
+            head->begin += consumeLen;
+            len -= consumeLen;
+
+            if (head->begin == head->end) {
+                Segment* next = head->next;
+
+                if (head == appendSlab) {
+                    appendSlab = nullptr;
+                }
+                if (inFlight(head)) {
+                    retire(head);
+                } else {
+                    release(head);
+                }
+
+                head = next;
+                if (head == nullptr) {
+                    tail = nullptr;
+                }
+            }
+        }
+    }
+
+    void WritePuffer::clear() {
+        while (head != nullptr) {
+            Segment* next = head->next;
+            if (inFlight(head)) {
+                discard(head);
+            } else {
+                release(head);
+            }
+            head = next;
+        }
+
+        while (retiredHead != nullptr) {
+            Segment* next = retiredHead->next;
+            discard(retiredHead);
+            retiredHead = next;
+        }
+
+        tail = nullptr;
+        appendSlab = nullptr;
+        retiredTail = nullptr;
+        queued = 0;
+    }
+
+    void WritePuffer::pin(std::size_t len) {
+        const std::uint32_t id = zeroCopySent++;
+
+        for (Segment* segment = head; segment != nullptr && len > 0; segment = segment->next) {
+            segment->pinned = true;
+            segment->zeroCopyId = id;
+
+            len -= std::min(len, segment->end - segment->begin);
+        }
+    }
+
+    void WritePuffer::zeroCopyCompleted(std::uint32_t id) {
+        if (static_cast<std::int32_t>(id + 1 - zeroCopyDone) > 0) {
+            zeroCopyDone = id + 1;
+        }
+
+        while (retiredHead != nullptr && !inFlight(retiredHead)) {
+            Segment* next = retiredHead->next;
+            release(retiredHead);
+            retiredHead = next;
+        }
+
+        if (retiredHead == nullptr) {
+            retiredTail = nullptr;
+        }
+    }
+
+    bool WritePuffer::zeroCopyPending() const {
+        return zeroCopyDone != zeroCopySent;
+    }
+
+    std::size_t WritePuffer::size() const {
+        return queued;
+    }
+
+    std::size_t WritePuffer::heldBytes() const {
+        std::size_t held = 0;
+
+        for (const Segment* segment : {head, retiredHead}) {
+            for (; segment != nullptr; segment = segment->next) {
+                held += segment->shared ? 0 : slabSize;
+            }
+        }
+
+        return held;
+    }
+
+    bool WritePuffer::empty() const {
+        return queued == 0;
+    }
+
+    void WritePuffer::link(Segment* segment) {
+        if (tail == nullptr) {
+            head = segment;
+        } else {
+            tail->next = segment;
+        }
+        tail = segment;
+    }
+
+    void WritePuffer::retire(Segment* segment) {
+        segment->next = nullptr;
+
+        if (retiredTail == nullptr) {
+            retiredHead = segment;
+        } else {
+            retiredTail->next = segment;
+        }
+        retiredTail = segment;
+    }
+
+    bool WritePuffer::inFlight(const Segment* segment) const {
+        // Wrap-around safe: ids ahead of the last completed one are still in flight
+        return segment->pinned && static_cast<std::int32_t>(segment->zeroCopyId - zeroCopyDone) >= 0;
+    }
+
+    void WritePuffer::release(Segment* segment) {
+        if (segment->shared) {
+            delete static_cast<SharedSegment*>(segment);
+        } else {
+            releaseSlab(static_cast<Slab*>(segment));
+        }
+    }
+
+    // The kernel may still read from the segment: do not recycle it for the next connection
+    void WritePuffer::discard(Segment* segment) {
+        if (segment->shared) {
+            delete static_cast<SharedSegment*>(segment);
+        } else {
+            delete static_cast<Slab*>(segment);
+        }
+    }
+
+    // Slabs are handed out and returned by the event loop thread owning the connection only
+    struct WritePuffer::SlabPool {
+        ~SlabPool() {
+            while (slabs != nullptr) {
+                Slab* next = static_cast<Slab*>(slabs->next);
+                delete slabs;
+                slabs = next;
+            }
+        }
+
+        Slab* slabs = nullptr;
+        std::size_t count = 0;
+    };
+
+    WritePuffer::SlabPool& WritePuffer::slabPool() {
+        thread_local SlabPool slabPool;
+
+        return slabPool;
+    }
+
+    WritePuffer::Slab* WritePuffer::acquireSlab() {
+        SlabPool& pool = slabPool();
+
+        Slab* slab = pool.slabs;
+        if (slab != nullptr) {
+            pool.slabs = static_cast<Slab*>(slab->next);
+            pool.count--;
+
+            slab->next = nullptr;
+            slab->begin = 0;
+            slab->end = 0;
+            slab->pinned = false;
+        } else {
+            slab = new Slab;
+            slab->data = slab->storage;
+        }
+
+        return slab;
+    }
+
+    void WritePuffer::releaseSlab(Slab* slab) {
+        SlabPool& pool = slabPool();
+
+        if (pool.count < maxPooledSlabs) {
+            slab->next = pool.slabs;
+            pool.slabs = slab;
+            pool.count++;
+        } else {
+            delete slab;
+        }
+    }
+
+} // namespace core::socket::stream
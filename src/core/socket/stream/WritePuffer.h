@@ -0,0 +1,163 @@
+/*
+ * SNode.C - A Slim Toolkit for Network Communication
+ * Copyright (C) Volker Christian <me@vchrist.at>
+ *               2020, 2021, 2022, 2023, 2024, 2025, 2026
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef CORE_SOCKET_STREAM_WRITEPUFFER_H
+#define CORE_SOCKET_STREAM_WRITEPUFFER_H
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <sys/types.h>
+#include <sys/uio.h>
+
+#endif /* DOXYGEN_SHOULD_SKIP_THIS */
+
+namespace core::socket::stream {
+
+    // Outgoing data as a chain of segments. Copied data goes into fixed-size slabs: appending copies into the tail slab only and
+    // consuming releases fully written slabs, so neither moves the queued backlog. Released slabs are kept in a per-thread pool for
+    // the next connection. Shared data is queued as a reference to the caller's immutable buffer which is kept alive until written.
+    // Segments handed to the kernel by a MSG_ZEROCOPY send are retired instead of released once written and are released when the
+    // kernel reports that send as completed. File ranges are queued by descriptor and offset and are sent by the kernel straight from
+    // the page cache; gathering stops in front of them. Pipe ranges are bytes waiting in a pipe which the kernel splices on.
+    class WritePuffer {
+    public:
+        static constexpr std::size_t slabSize = 16384;
+        static constexpr std::size_t maxIovecs = 64;
+
+        struct FileRange {
+            int fd = -1;
+            off_t offset = 0;
+            std::size_t len = 0;
+            bool pipe = false;
+        };
+
+        WritePuffer() = default;
+        ~WritePuffer();
+
+        WritePuffer(const WritePuffer&) = delete;
+        WritePuffer& operator=(const WritePuffer&) = delete;
+
+        void append(const char* chunk, std::size_t chunkLen);
+        void append(const std::shared_ptr<const void>& owner, const char* chunk, std::size_t chunkLen);
+        // owner keeps fd open until the range is written
+        void appendFile(const std::shared_ptr<const void>& owner, int fd, off_t offset, std::size_t len);
+        // The next len bytes in the pipe read end fd, owner keeps fd open until they are written
+        void appendPipe(const std::shared_ptr<const void>& owner, int fd, std::size_t len);
+
+        // True if the next bytes to send are the unsent rest of a queued file or pipe range
+        bool frontFile(FileRange& fileRange) const;
+
+        // Describes at most maxLen queued bytes from the front in at most iovMax iovecs. Returns the number of iovecs filled
+        int gather(iovec* iov, std::size_t iovMax, std::size_t maxLen) const;
+        void consume(std::size_t len);
+        void clear();
+
+        // The first len queued bytes were sent with MSG_ZEROCOPY. Sends are numbered as the kernel does, starting at zero
+        void pin(std::size_t len);
+        // The kernel is done with all zero-copy sends up to and including id
+        void zeroCopyCompleted(std::uint32_t id);
+        bool zeroCopyPending() const;
+
+        std::size_t size() const;
+        bool empty() const;
+
+        // Slab memory held by queued and retired segments. Shared data and file ranges belong to their owners and are not counted
+        std::size_t heldBytes() const;
+
+    private:
+        struct Segment {
+            Segment* next = nullptr;
+            const char* data = nullptr;
+            std::size_t begin = 0;
+            std::size_t end = 0;
+            bool shared = false;
+            bool file = false;
+            bool pinned = false;
+            std::uint32_t zeroCopyId = 0;
+        };
+
+        struct Slab : Segment {
+            char storage[slabSize];
+        };
+
+        struct SharedSegment : Segment {
+            std::shared_ptr<const void> owner;
+
+            // File and pipe ranges only
+            int fd = -1;
+            off_t offset = 0;
+            bool pipe = false;
+        };
+
+        struct SlabPool;
+
+        void link(Segment* segment);
+        void retire(Segment* segment);
+        bool inFlight(const Segment* segment) const;
+        static void release(Segment* segment);
+        static void discard(Segment* segment);
+
+        static SlabPool& slabPool();
+        static Slab* acquireSlab();
+        static void releaseSlab(Slab* slab);
+
+        Segment* head = nullptr;
+        Segment* tail = nullptr;
+
+        // The tail slab if further copied data may still be appended to it
+        Slab* appendSlab = nullptr;
+
+        std::size_t queued = 0;
+
+        // Written segments the kernel may still read from, in send order
+        Segment* retiredHead = nullptr;
+        Segment* retiredTail = nullptr;
+
+        std::uint32_t zeroCopySent = 0;
+        std::uint32_t zeroCopyDone = 0;
+    };
+
+} // namespace core::socket::stream
+
+#endif // CORE_SOCKET_STREAM_WRITEPUFFER_H
@@ -62,6 +62,9 @@ namespace core::socket::stream::legacy {
               },
               connectionId,
               config) {
+        if (SocketWriter::isEnabled() && config->getZeroCopy()) {
+            static_cast<void>(SocketWriter::enableZeroCopy(config->getZeroCopyThreshold()));
+        }
     }
 
 } // namespace core::socket::stream::legacy
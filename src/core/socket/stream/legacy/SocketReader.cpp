@@ -50,4 +50,8 @@ namespace core::socket::stream::legacy {
     SocketReader::~SocketReader() {
     }
 
+    bool SocketReader::canSplice() const {
+        return true;
+    }
+
 } // namespace core::socket::stream::legacy
@@ -57,6 +57,9 @@ namespace core::socket::stream::legacy {
 
     public:
         ~SocketReader() override;
+
+    protected:
+        bool canSplice() const override;
     };
 
 } // namespace core::socket::stream::legacy
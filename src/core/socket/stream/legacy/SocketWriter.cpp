@@ -43,11 +43,140 @@
 
 #ifndef DOXYGEN_SHOULD_SKIP_THIS
 
+#include "core/system/socket.h"
+#include "log/Logger.h"
+
+#include <cerrno>
+#include <cstring>
+#include <linux/errqueue.h>
+#include <netinet/in.h>
+
 #endif // DOXYGEN_SHOULD_SKIP_THIS
 
 namespace core::socket::stream::legacy {
 
+    SocketWriter::SocketWriter(const std::string& instanceName,
+                               const std::function<void(int)>& onStatus,
+                               const utils::Timeval& timeout,
+                               std::size_t blockSize,
+                               const utils::Timeval& terminateTimeout)
+        : Super(instanceName, onStatus, timeout, blockSize, terminateTimeout)
+        , ZeroCopyReceiver(instanceName, core::DescriptorEventReceiver::TIMEOUT::DISABLE) {
+    }
+
     SocketWriter::~SocketWriter() {
     }
 
+    bool SocketWriter::isEnabled() const {
+        return Super::isEnabled();
+    }
+
+    bool SocketWriter::enable(int fd) {
+        return Super::enable(fd);
+    }
+
+    void SocketWriter::disable() {
+        if (ZeroCopyReceiver::isEnabled()) {
+            ZeroCopyReceiver::disable();
+        }
+
+        Super::disable();
+    }
+
+    void SocketWriter::suspend() {
+        Super::suspend();
+    }
+
+    void SocketWriter::setTimeout(const utils::Timeval& timeout) {
+        Super::setTimeout(timeout);
+    }
+
+    bool SocketWriter::enableZeroCopy(std::size_t threshold) {
+        const int fd = Super::getRegisteredFd();
+        const int one = 1;
+
+        if (core::system::setsockopt(fd, SOL_SOCKET, SO_ZEROCOPY, &one, sizeof(one)) == 0) {
+            if (ZeroCopyReceiver::enable(fd)) {
+                zeroCopyThreshold = threshold;
+                Super::log().debug("{}: MSG_ZEROCOPY for writes of at least {} bytes", Super::getName(), threshold);
+            }
+        } else {
+            Super::log().sysError(logger::LogLevel::Debug, errno, "MSG_ZEROCOPY not supported: copying");
+        }
+
+        return zeroCopyThreshold > 0;
+    }
+
+    bool SocketWriter::canSendFile() const {
+        return true;
+    }
+
+    ssize_t SocketWriter::writev(const iovec* iov, int iovcnt) {
+        std::size_t len = 0;
+        for (int i = 0; i < iovcnt; i++) {
+            len += iov[i].iov_len;
+        }
+
+        ssize_t ret = 0;
+
+        if (zeroCopyThreshold > 0 && len >= zeroCopyThreshold) {
+            // Also collected here as select() does not report error queue readiness as an exceptional condition
+            reapZeroCopyCompletions();
+
+            msghdr msg{};
+            msg.msg_iov = const_cast<iovec*>(iov);
+            msg.msg_iovlen = static_cast<std::size_t>(iovcnt);
+
+            ret = core::system::sendmsg(Super::getRegisteredFd(), &msg, MSG_NOSIGNAL | MSG_ZEROCOPY);
+
+            if (ret > 0) {
+                writePuffer.pin(static_cast<std::size_t>(ret));
+            } else if (ret < 0 && errno == ENOBUFS) {
+                // No socket memory left for a completion notification: copy this time
+                ret = Super::writev(iov, iovcnt);
+            }
+        } else {
+            ret = Super::writev(iov, iovcnt);
+        }
+
+        return ret;
+    }
+
+    void SocketWriter::outOfBandEvent() {
+        reapZeroCopyCompletions();
+    }
+
+    void SocketWriter::reapZeroCopyCompletions() {
+        const int errnum = errno;
+
+        bool reaped = true;
+        while (reaped && writePuffer.zeroCopyPending()) {
+            union {
+                struct cmsghdr cm;
+                char control[CMSG_SPACE(sizeof(sock_extended_err)) + CMSG_SPACE(sizeof(sockaddr_in6))] = {};
+            } control_un;
+
+            msghdr msg{};
+            msg.msg_control = control_un.control;
+            msg.msg_controllen = sizeof(control_un.control);
+
+            reaped = core::system::recvmsg(Super::getRegisteredFd(), &msg, MSG_ERRQUEUE) >= 0;
+
+            for (cmsghdr* cmptr = reaped ? CMSG_FIRSTHDR(&msg) : nullptr; cmptr != nullptr; cmptr = CMSG_NXTHDR(&msg, cmptr)) {
+                if ((cmptr->cmsg_level == SOL_IP && cmptr->cmsg_type == IP_RECVERR) ||
+                    (cmptr->cmsg_level == SOL_IPV6 && cmptr->cmsg_type == IPV6_RECVERR)) {
+                    sock_extended_err extendedErr{};
+                    std::memcpy(&extendedErr, CMSG_DATA(cmptr), sizeof(extendedErr));
+
+                    if (extendedErr.ee_errno == 0 && extendedErr.ee_origin == SO_EE_ORIGIN_ZEROCOPY) {
+                        // Sends ee_info to ee_data are done; the kernel reports them in order for TCP
+                        writePuffer.zeroCopyCompleted(extendedErr.ee_data);
+                    }
+                }
+            }
+        }
+
+        errno = errnum;
+    }
+
 } // namespace core::socket::stream::legacy
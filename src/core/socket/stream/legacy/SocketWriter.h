@@ -42,21 +42,65 @@
 #ifndef CORE_SOCKET_STREAM_LEGACY_SOCKETWRITER_H
 #define CORE_SOCKET_STREAM_LEGACY_SOCKETWRITER_H
 
+#include "core/eventreceiver/ExceptionalConditionEventReceiver.h"
 #include "core/socket/stream/SocketWriter.h"
 
 #ifndef DOXYGEN_SHOULD_SKIP_THIS
 
+#include "utils/Timeval.h"
+
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <sys/types.h>
+#include <sys/uio.h>
+
 #endif /* DOXYGEN_SHOULD_SKIP_THIS */
 
 namespace core::socket::stream::legacy {
 
-    class SocketWriter : public core::socket::stream::SocketWriter {
+    // With MSG_ZEROCOPY enabled, writes of at least the configured threshold hand the queued pages to the kernel instead of
+    // copying them. The kernel reports on the socket error queue when it is done with them. The exceptional-condition receiver
+    // reaps these notifications and releases the buffers.
+    class SocketWriter
+        : public core::socket::stream::SocketWriter
+        , public core::eventreceiver::ExceptionalConditionEventReceiver {
     private:
         using Super = core::socket::stream::SocketWriter;
-        using Super::Super;
+        using ZeroCopyReceiver = core::eventreceiver::ExceptionalConditionEventReceiver;
+
+    protected:
+        SocketWriter(const std::string& instanceName,
+                     const std::function<void(int)>& onStatus,
+                     const utils::Timeval& timeout,
+                     std::size_t blockSize,
+                     const utils::Timeval& terminateTimeout);
 
     public:
         ~SocketWriter() override;
+
+        // Both receivers observe the connection's descriptor, the write receiver speaks for the writer
+        bool isEnabled() const;
+
+    protected:
+        bool enable(int fd);
+        void disable();
+
+        void suspend();
+        void setTimeout(const utils::Timeval& timeout);
+
+        bool enableZeroCopy(std::size_t threshold);
+
+        bool canSendFile() const override;
+
+    private:
+        ssize_t writev(const iovec* iov, int iovcnt) override;
+
+        void outOfBandEvent() override;
+
+        void reapZeroCopyCompletions();
+
+        std::size_t zeroCopyThreshold = 0;
     };
 
 } // namespace core::socket::stream::legacy
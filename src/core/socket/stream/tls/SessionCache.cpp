@@ -0,0 +1,291 @@
+/*
+ * SNode.C - A Slim Toolkit for Network Communication
+ * Copyright (C) Volker Christian <me@vchrist.at>
+ *               2020, 2021, 2022, 2023, 2024, 2025, 2026
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "core/socket/stream/tls/SessionCache.h"
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+
+#include <algorithm>
+#include <cstring>
+#include <ctime>
+#include <openssl/core_names.h>
+#include <openssl/crypto.h>
+#include <openssl/evp.h>
+#include <openssl/params.h>
+#include <openssl/rand.h>
+#include <openssl/ssl.h>
+
+#endif /* DOXYGEN_SHOULD_SKIP_THIS */
+
+namespace core::socket::stream::tls {
+
+    SessionCache::~SessionCache() {
+        flush();
+    }
+
+    SessionCache& SessionCache::instance() {
+        static SessionCache sessionCache;
+
+        return sessionCache;
+    }
+
+    void SessionCache::attach(SSL_CTX* ctx, std::size_t cacheSize, long timeout, long ticketKeyRotation) {
+        {
+            const std::lock_guard<std::mutex> lock(mutex);
+
+            capacity = std::max(capacity, cacheSize);
+            if (ticketKeyRotation > 0 && (this->ticketKeyRotation == 0 || ticketKeyRotation < this->ticketKeyRotation)) {
+                this->ticketKeyRotation = ticketKeyRotation;
+            }
+        }
+
+        if (timeout > 0) {
+            SSL_CTX_set_timeout(ctx, timeout);
+        }
+
+        if (cacheSize > 0) {
+            SSL_CTX_set_session_cache_mode(ctx, SSL_SESS_CACHE_SERVER | SSL_SESS_CACHE_NO_INTERNAL);
+            SSL_CTX_sess_set_new_cb(ctx, newSessionCallback);
+            SSL_CTX_sess_set_get_cb(ctx, getSessionCallback);
+            SSL_CTX_sess_set_remove_cb(ctx, removeSessionCallback);
+        } else {
+            SSL_CTX_set_session_cache_mode(ctx, SSL_SESS_CACHE_OFF);
+        }
+
+        if (ticketKeyRotation > 0) {
+            SSL_CTX_set_tlsext_ticket_key_evp_cb(ctx, ticketKeyCallback);
+        }
+    }
+
+    void SessionCache::countHandshake(bool resumed) {
+        const std::lock_guard<std::mutex> lock(mutex);
+
+        if (resumed) {
+            stats.resumedHandshakes++;
+        } else {
+            stats.fullHandshakes++;
+        }
+    }
+
+    void SessionCache::rotateTicketKeys() {
+        const std::lock_guard<std::mutex> lock(mutex);
+
+        newTicketKey();
+    }
+
+    void SessionCache::flush() {
+        const std::lock_guard<std::mutex> lock(mutex);
+
+        for (const Entry& entry : sessions) {
+            SSL_SESSION_free(entry.session);
+        }
+        sessions.clear();
+        sessionIndex.clear();
+    }
+
+    SessionCache::Stats SessionCache::getStats() const {
+        const std::lock_guard<std::mutex> lock(mutex);
+
+        Stats current = stats;
+        current.sessions = sessions.size();
+
+        return current;
+    }
+
+    int SessionCache::newSessionCallback(SSL* ssl, SSL_SESSION* session) {
+        // TLSv1.3 sessions resumed by stateless tickets carry only a dummy id, caching them would waste the capacity
+        const bool stateless = SSL_version(ssl) == TLS1_3_VERSION && (SSL_get_options(ssl) & SSL_OP_NO_TICKET) == 0;
+
+        if (!stateless) {
+            instance().insert(session);
+        }
+
+        return stateless ? 0 : 1; // On 1 the cache keeps the reference
+    }
+
+    SSL_SESSION* SessionCache::getSessionCallback([[maybe_unused]] SSL* ssl, const unsigned char* id, int idLen, int* copy) {
+        *copy = 0; // lookup() already took the reference for OpenSSL
+
+        return instance().lookup(id, idLen);
+    }
+
+    void SessionCache::removeSessionCallback([[maybe_unused]] SSL_CTX* ctx, SSL_SESSION* session) {
+        instance().remove(session);
+    }
+
+    int SessionCache::ticketKeyCallback(
+        [[maybe_unused]] SSL* ssl, unsigned char* keyName, unsigned char* iv, EVP_CIPHER_CTX* cipherCtx, EVP_MAC_CTX* macCtx, int enc) {
+        return instance().ticketKey(keyName, iv, cipherCtx, macCtx, enc);
+    }
+
+    void SessionCache::insert(SSL_SESSION* session) {
+        unsigned int idLen = 0;
+        const unsigned char* id = SSL_SESSION_get_id(session, &idLen);
+        std::string key(reinterpret_cast<const char*>(id), idLen);
+
+        const std::lock_guard<std::mutex> lock(mutex);
+
+        if (auto it = sessionIndex.find(key); it != sessionIndex.end()) {
+            SSL_SESSION_free(it->second->session);
+            sessions.erase(it->second);
+            sessionIndex.erase(it);
+        }
+
+        sessions.push_front({key, session});
+        sessionIndex.emplace(std::move(key), sessions.begin());
+
+        while (sessions.size() > capacity) {
+            SSL_SESSION_free(sessions.back().session);
+            sessionIndex.erase(sessions.back().id);
+            sessions.pop_back();
+            stats.evicted++;
+        }
+    }
+
+    SSL_SESSION* SessionCache::lookup(const unsigned char* id, int idLen) {
+        SSL_SESSION* session = nullptr;
+
+        const std::lock_guard<std::mutex> lock(mutex);
+
+        if (auto it = sessionIndex.find(std::string(reinterpret_cast<const char*>(id), static_cast<std::size_t>(idLen)));
+            it != sessionIndex.end()) {
+            const std::list<Entry>::iterator entry = it->second;
+
+            if (SSL_SESSION_get_time(entry->session) + SSL_SESSION_get_timeout(entry->session) < static_cast<long>(time(nullptr))) {
+                SSL_SESSION_free(entry->session);
+                sessions.erase(entry);
+                sessionIndex.erase(it);
+            } else {
+                sessions.splice(sessions.begin(), sessions, entry);
+                SSL_SESSION_up_ref(entry->session);
+                session = entry->session;
+            }
+        }
+
+        if (session != nullptr) {
+            stats.hits++;
+        } else {
+            stats.misses++;
+        }
+
+        return session;
+    }
+
+    void SessionCache::remove(SSL_SESSION* session) {
+        unsigned int idLen = 0;
+        const unsigned char* id = SSL_SESSION_get_id(session, &idLen);
+
+        const std::lock_guard<std::mutex> lock(mutex);
+
+        if (auto it = sessionIndex.find(std::string(reinterpret_cast<const char*>(id), idLen)); it != sessionIndex.end()) {
+            SSL_SESSION_free(it->second->session);
+            sessions.erase(it->second);
+            sessionIndex.erase(it);
+        }
+    }
+
+    int SessionCache::ticketKey(unsigned char* keyName, unsigned char* iv, EVP_CIPHER_CTX* cipherCtx, EVP_MAC_CTX* macCtx, int enc) {
+        int ret = 0;
+
+        const std::lock_guard<std::mutex> lock(mutex);
+
+        if (ticketKeys.empty() ||
+            std::chrono::steady_clock::now() - ticketKeys.front().created >= std::chrono::seconds(ticketKeyRotation)) {
+            newTicketKey();
+        }
+
+        const TicketKey* key = nullptr;
+        if (enc == 1) {
+            if (!ticketKeys.empty() && RAND_bytes(iv, EVP_CIPHER_get_iv_length(EVP_aes_256_cbc())) == 1) {
+                key = &ticketKeys.front();
+                std::memcpy(keyName, key->name.data(), key->name.size());
+            }
+        } else {
+            const auto it = std::find_if(ticketKeys.begin(), ticketKeys.end(), [keyName](const TicketKey& ticketKey) {
+                return std::memcmp(keyName, ticketKey.name.data(), ticketKey.name.size()) == 0;
+            });
+
+            if (it != ticketKeys.end()) {
+                key = &*it;
+            }
+        }
+
+        if (key != nullptr) {
+            OSSL_PARAM params[] = {
+                OSSL_PARAM_construct_octet_string(OSSL_MAC_PARAM_KEY, const_cast<unsigned char*>(key->hmacKey.data()), key->hmacKey.size()),
+                OSSL_PARAM_construct_utf8_string(OSSL_MAC_PARAM_DIGEST, const_cast<char*>("SHA256"), 0),
+                OSSL_PARAM_construct_end()};
+
+            const int initialized = enc == 1 ? EVP_EncryptInit_ex(cipherCtx, EVP_aes_256_cbc(), nullptr, key->aesKey.data(), iv)
+                                             : EVP_DecryptInit_ex(cipherCtx, EVP_aes_256_cbc(), nullptr, key->aesKey.data(), iv);
+
+            if (initialized != 1 || EVP_MAC_CTX_set_params(macCtx, params) != 1) {
+                ret = -1;
+            } else if (enc != 1 && key != &ticketKeys.front()) {
+                ret = 2; // Still valid, but issue a ticket under the current key
+            } else {
+                ret = 1;
+            }
+        }
+
+        return ret;
+    }
+
+    void SessionCache::newTicketKey() {
+        TicketKey key{};
+
+        if (RAND_bytes(key.name.data(), static_cast<int>(key.name.size())) == 1 &&
+            RAND_bytes(key.aesKey.data(), static_cast<int>(key.aesKey.size())) == 1 &&
+            RAND_bytes(key.hmacKey.data(), static_cast<int>(key.hmacKey.size())) == 1) {
+            key.created = std::chrono::steady_clock::now();
+
+            ticketKeys.push_front(key);
+            if (ticketKeys.size() > 2) {
+                OPENSSL_cleanse(&ticketKeys.back(), sizeof(TicketKey));
+                ticketKeys.pop_back();
+            }
+            stats.ticketKeyRotations++;
+        }
+
+        OPENSSL_cleanse(&key, sizeof(TicketKey));
+    }
+
+} // namespace core::socket::stream::tls
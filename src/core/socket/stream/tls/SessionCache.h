@@ -0,0 +1,140 @@
+/*
+ * SNode.C - A Slim Toolkit for Network Communication
+ * Copyright (C) Volker Christian <me@vchrist.at>
+ *               2020, 2021, 2022, 2023, 2024, 2025, 2026
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef CORE_SOCKET_STREAM_TLS_SESSIONCACHE_H
+#define CORE_SOCKET_STREAM_TLS_SESSIONCACHE_H
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <deque>
+#include <list>
+#include <mutex>
+#include <openssl/ssl.h>
+#include <string>
+#include <unordered_map>
+
+#endif /* DOXYGEN_SHOULD_SKIP_THIS */
+
+namespace core::socket::stream::tls {
+
+    // Server side session resumption state shared by all SSL_CTXs of the process, thus by all listeners, their SNI contexts and all
+    // event loops. Stateful sessions are kept in one LRU cache sized by the largest configured capacity. Stateless session tickets
+    // are encrypted with one key ring rotated at the shortest configured interval: a key older than the interval is replaced on
+    // next use and then still decrypts (and renews) the tickets it issued for one more interval. OpenSSL resumes a session only in
+    // a context with the session id context it was created in.
+    class SessionCache {
+    public:
+        struct Stats {
+            std::size_t fullHandshakes = 0;
+            std::size_t resumedHandshakes = 0;
+            std::size_t sessions = 0;
+            std::size_t hits = 0;
+            std::size_t misses = 0;
+            std::size_t evicted = 0;
+            std::size_t ticketKeyRotations = 0;
+        };
+
+        SessionCache(const SessionCache&) = delete;
+        SessionCache& operator=(const SessionCache&) = delete;
+
+        static SessionCache& instance();
+
+        // cacheSize 0 disables the session cache of ctx, ticketKeyRotation 0 leaves ctx with its own random ticket keys
+        void attach(SSL_CTX* ctx, std::size_t cacheSize, long timeout, long ticketKeyRotation);
+
+        void countHandshake(bool resumed);
+
+        void rotateTicketKeys();
+        void flush();
+
+        Stats getStats() const;
+
+    private:
+        SessionCache() = default;
+        ~SessionCache();
+
+        struct TicketKey {
+            std::array<unsigned char, 16> name;
+            std::array<unsigned char, 32> aesKey;
+            std::array<unsigned char, 32> hmacKey;
+            std::chrono::steady_clock::time_point created;
+        };
+
+        struct Entry {
+            std::string id;
+            SSL_SESSION* session;
+        };
+
+        static int newSessionCallback(SSL* ssl, SSL_SESSION* session);
+        static SSL_SESSION* getSessionCallback(SSL* ssl, const unsigned char* id, int idLen, int* copy);
+        static void removeSessionCallback(SSL_CTX* ctx, SSL_SESSION* session);
+        static int ticketKeyCallback(SSL* ssl,
+                                     unsigned char* keyName,
+                                     unsigned char* iv,
+                                     EVP_CIPHER_CTX* cipherCtx,
+                                     EVP_MAC_CTX* macCtx,
+                                     int enc);
+
+        void insert(SSL_SESSION* session);
+        SSL_SESSION* lookup(const unsigned char* id, int idLen);
+        void remove(SSL_SESSION* session);
+        int ticketKey(unsigned char* keyName, unsigned char* iv, EVP_CIPHER_CTX* cipherCtx, EVP_MAC_CTX* macCtx, int enc);
+
+        void newTicketKey();
+
+        mutable std::mutex mutex;
+
+        std::list<Entry> sessions; // Most recently used first
+        std::unordered_map<std::string, std::list<Entry>::iterator> sessionIndex;
+        std::size_t capacity = 0;
+
+        std::deque<TicketKey> ticketKeys; // Current key first
+        long ticketKeyRotation = 0;
+
+        Stats stats;
+    };
+
+} // namespace core::socket::stream::tls
+
+#endif // CORE_SOCKET_STREAM_TLS_SESSIONCACHE_H
@@ -90,6 +90,10 @@ namespace core::socket::stream::tls {
 
         SSL* getSSL() const;
 
+        std::size_t getBytesHeld() const final;
+
+        const typename SocketWriter::RecordStats& getRecordStats() const;
+
     private:
         SSL* startSSL(int fd, SSL_CTX* ctx);
 
@@ -140,6 +144,7 @@ namespace core::socket::stream::tls {
         bool isLegalTlsTransition(TlsTransportState from, TlsTransportState to) const;
         void transitionTo(TlsTransportState next);
         void drainTlsShutdownCallbacks();
+        void detectKernelTls();
 
         void onReadShutdown() final;
 
@@ -153,6 +158,7 @@ namespace core::socket::stream::tls {
         utils::Timeval sslShutdownTimeout;
         bool closeNotifyIsEOF;
         bool tlsFatalError = false;
+        bool kernelTls = false;
         TlsTransportState tlsTransportState = TlsTransportState::Plaintext;
         TlsShutdownIntent tlsShutdownIntent = TlsShutdownIntent::ContinuePlaintext;
         bool tlsShutdownSemanticComplete = false;
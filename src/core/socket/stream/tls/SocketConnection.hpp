@@ -40,6 +40,7 @@
  */
 
 #include "core/socket/stream/SocketConnection.hpp"
+#include "core/socket/stream/tls/SessionCache.h"
 #include "core/socket/stream/tls/SocketConnection.h"
 #include "core/socket/stream/tls/TLSHandshake.h"
 #include "core/socket/stream/tls/TLSShutdown.h"
@@ -164,6 +165,32 @@ namespace core::socket::stream::tls {
         return ssl;
     }
 
+    template <typename PhysicalSocket, typename Config>
+    std::size_t SocketConnection<PhysicalSocket, Config>::getBytesHeld() const {
+        std::size_t bytesHeld = Super::getBytesHeld();
+
+        // OpenSSL does not report its record buffers, they are accounted at their maximum size. Without SSL_MODE_RELEASE_BUFFERS
+        // both stay allocated, with it each one is freed as soon as it runs empty.
+        if (ssl != nullptr) {
+            const bool releaseBuffers = (SSL_get_mode(ssl) & SSL_MODE_RELEASE_BUFFERS) != 0;
+
+            if (!releaseBuffers || SSL_has_pending(ssl) == 1) {
+                bytesHeld += SSL3_RT_MAX_PACKET_SIZE;
+            }
+            if (!releaseBuffers || Super::getTotalQueued() > Super::getTotalSent()) {
+                bytesHeld += SSL3_RT_MAX_PACKET_SIZE;
+            }
+        }
+
+        return bytesHeld;
+    }
+
+    template <typename PhysicalSocket, typename Config>
+    const typename SocketConnection<PhysicalSocket, Config>::SocketWriter::RecordStats&
+    SocketConnection<PhysicalSocket, Config>::getRecordStats() const {
+        return SocketWriter::getRecordStats();
+    }
+
     template <typename PhysicalSocket, typename Config>
     SSL* SocketConnection<PhysicalSocket, Config>::startSSL(int fd, SSL_CTX* ctx) {
         if (ctx != nullptr) {
@@ -203,6 +230,28 @@ namespace core::socket::stream::tls {
         ssl = nullptr;
         SocketReader::ssl = nullptr;
         SocketWriter::ssl = nullptr;
+        SocketWriter::kernelTlsSend = false;
+    }
+
+    template <typename PhysicalSocket, typename Config>
+    void SocketConnection<PhysicalSocket, Config>::detectKernelTls() {
+        // OpenSSL installs the kernel TLS layer during the handshake if SSL_OP_ENABLE_KTLS is set and the kernel supports
+        // the negotiated cipher. Without it everything stays in user space.
+        SocketWriter::kernelTlsSend = false;
+
+#if defined(SSL_OP_ENABLE_KTLS)
+        if (ssl != nullptr && (SSL_get_options(ssl) & SSL_OP_ENABLE_KTLS) != 0) {
+            const bool kernelTlsSend = BIO_get_ktls_send(SSL_get_wbio(ssl));
+            const bool kernelTlsRecv = BIO_get_ktls_recv(SSL_get_rbio(ssl));
+
+            SocketWriter::kernelTlsSend = kernelTlsSend;
+            kernelTls = kernelTls || kernelTlsSend || kernelTlsRecv;
+
+            core::socket::stream::SocketConnection::log().debug("SSL/TLS: Kernel TLS send {}, receive {}",
+                                                                kernelTlsSend ? "offloaded" : "in user space",
+                                                                kernelTlsRecv ? "offloaded" : "in user space");
+        }
+#endif
     }
 
     template <typename PhysicalSocket, typename Config>
@@ -272,6 +321,8 @@ namespace core::socket::stream::tls {
                     if (lifecycle->releaseRequested || owner->tlsTransportState == TlsTransportState::Closing) {
                         return;
                     }
+                    SessionCache::instance().countHandshake(SSL_session_reused(lifecycle->ssl) == 1);
+                    owner->detectKernelTls();
                     owner->transitionTo(TlsTransportState::TlsActive);
                     owner->SocketReader::span();
                     onSuccess();
@@ -461,7 +512,8 @@ namespace core::socket::stream::tls {
         if (onComplete) {
             tlsShutdownCompletionCallbacks.push_back(onComplete);
         }
-        if (intent == TlsShutdownIntent::CloseTransport) {
+        if (intent == TlsShutdownIntent::CloseTransport || kernelTls) {
+            // The kernel TLS layer stays on the socket, plaintext can not continue behind it
             tlsShutdownIntent = TlsShutdownIntent::CloseTransport;
         } else if (tlsShutdownIntent != TlsShutdownIntent::CloseTransport) {
             tlsShutdownIntent = TlsShutdownIntent::ContinuePlaintext;
@@ -561,7 +613,8 @@ namespace core::socket::stream::tls {
     void SocketConnection<PhysicalSocket, Config>::onReadShutdown() {
         core::socket::stream::SocketConnection::log().debug(
             "SSL/TLS: Passive close_notify received, requesting connection-owned TLS shutdown");
-        const TlsShutdownIntent intent = closeNotifyIsEOF ? TlsShutdownIntent::CloseTransport : TlsShutdownIntent::ContinuePlaintext;
+        const TlsShutdownIntent intent =
+            closeNotifyIsEOF || kernelTls ? TlsShutdownIntent::CloseTransport : TlsShutdownIntent::ContinuePlaintext;
         if (intent == TlsShutdownIntent::CloseTransport) {
             tlsCloseEofPending = true;
             requestTlsShutdown(intent);
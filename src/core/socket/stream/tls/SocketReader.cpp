@@ -96,13 +96,17 @@ namespace core::socket::stream::tls {
     }
 
 
+    std::size_t SocketReader::getBytesHeld() const {
+        return Super::getBytesHeld() + handoffBuffer.capacity();
+    }
+
     ssize_t SocketReader::read(char* chunk, std::size_t chunkLen) {
         if (handoffCursor < handoffBuffer.size()) {
             const std::size_t available = std::min(chunkLen, handoffBuffer.size() - handoffCursor);
             std::copy(handoffBuffer.data() + handoffCursor, handoffBuffer.data() + handoffCursor + available, chunk);
             handoffCursor += available;
             if (handoffCursor == handoffBuffer.size()) {
-                handoffBuffer.clear();
+                std::vector<char>().swap(handoffBuffer);
                 handoffCursor = 0;
             }
             return static_cast<ssize_t>(available);
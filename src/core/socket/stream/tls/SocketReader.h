@@ -78,6 +78,8 @@ namespace core::socket::stream::tls {
                                    logger::LogLevel threshold = logger::LogLevel::Trace,
                                    logger::BoundaryLogger::Clock clock = {}) const;
 
+        std::size_t getBytesHeld() const;
+
     private:
         ssize_t read(char* chunk, std::size_t chunkLen) override;
 
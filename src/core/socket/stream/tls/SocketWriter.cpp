@@ -51,7 +51,9 @@
 #include "log/Logger.h"
 #include "utils/PreserveErrno.h"
 
+#include <algorithm>
 #include <cerrno>
+#include <cstring>
 #include <openssl/err.h>
 #include <openssl/ssl.h>
 #include <string>
@@ -70,6 +72,10 @@ namespace core::socket::stream::tls::detail::test {
 
 namespace core::socket::stream::tls {
 
+    namespace {
+        const utils::Timeval recordIdleTimeout({1, 0});
+    } // namespace
+
     SocketWriter::SocketWriter(const std::string& instanceName,
                                const std::function<void(int)>& onStatus,
                                const utils::Timeval& timeout,
@@ -93,11 +99,15 @@ namespace core::socket::stream::tls {
         return logScope.logger(std::move(sink), threshold, std::move(clock));
     }
 
+    const SocketWriter::RecordStats& SocketWriter::getRecordStats() const {
+        return recordStats;
+    }
+
 
     ssize_t SocketWriter::write(const char* chunk, std::size_t chunkLen) {
         ssize_t ret = 0;
 
-        if (ssl == nullptr) {
+        if (ssl == nullptr || kernelTlsSend) {
             ret = Super::write(chunk, chunkLen);
         } else {
             detail::TlsIoResult result;
@@ -200,4 +210,83 @@ namespace core::socket::stream::tls {
         return ret;
     }
 
+    ssize_t SocketWriter::writev(const iovec* iov, int iovcnt) {
+        if (ssl != nullptr && kernelTlsSend) {
+            // The kernel frames the records itself, the whole gather list goes out in one sendmsg
+            return Super::writev(iov, iovcnt);
+        }
+
+        if (ssl == nullptr) {
+            return Super::writev(iov, iovcnt);
+        }
+
+        const utils::Timeval now = utils::Timeval::currentTime();
+        if (retryRecordLen == 0 && now - lastRecordAt > recordIdleTimeout) {
+            recordSize = smallRecordSize;
+            rampedBytes = 0;
+        }
+
+        std::size_t available = 0;
+        for (int i = 0; i < iovcnt; i++) {
+            available += iov[i].iov_len;
+        }
+
+        std::size_t recordLen = std::min(available, std::max(recordSize, retryRecordLen));
+        const char* record = nullptr;
+
+        if (iovcnt == 0 || recordLen == 0) {
+            return 0;
+        }
+        if (iov[0].iov_len >= recordLen) {
+            // Once ramped up a large segment goes out in one SSL_write, OpenSSL cuts it into full records itself
+            recordLen = recordSize == fullRecordSize ? iov[0].iov_len : recordLen;
+            record = static_cast<const char*>(iov[0].iov_base);
+        } else {
+            // SSL_write takes one contiguous buffer: small segments are staged so that they share one record. A retry restages the
+            // same leading bytes, which SSL_MODE_ACCEPT_MOVING_WRITE_BUFFER allows
+            thread_local char staging[fullRecordSize];
+
+            std::size_t staged = 0;
+            for (int i = 0; i < iovcnt && staged < recordLen; i++) {
+                const std::size_t len = std::min(iov[i].iov_len, recordLen - staged);
+                std::memcpy(staging + staged, iov[i].iov_base, len);
+                staged += len;
+            }
+            record = staging;
+        }
+
+        const ssize_t ret = write(record, recordLen);
+
+        if (ret > 0) {
+            const std::size_t written = static_cast<std::size_t>(ret);
+
+            retryRecordLen = 0;
+            lastRecordAt = now;
+
+            const std::size_t records = (written + fullRecordSize - 1) / fullRecordSize;
+            recordStats.records += records;
+            flushRecords += records;
+
+            rampedBytes += written;
+            if (recordSize < fullRecordSize && rampedBytes >= recordRampBytes) {
+                recordSize = fullRecordSize;
+            }
+
+            if (written == getTotalQueued() - getTotalSent()) {
+                recordStats.flushes++;
+                recordStats.lastFlushRecords = flushRecords;
+                recordStats.maxFlushRecords = std::max(recordStats.maxFlushRecords, flushRecords);
+                flushRecords = 0;
+            }
+        } else if (errno == EAGAIN) {
+            retryRecordLen = recordLen;
+        }
+
+        return ret;
+    }
+
+    bool SocketWriter::canSendFile() const {
+        return ssl != nullptr && kernelTlsSend;
+    }
+
 } // namespace core::socket::stream::tls
@@ -44,9 +44,11 @@
 
 #include "core/socket/stream/SocketWriter.h"
 #include "log/LogScopeOwner.h"
+#include "utils/Timeval.h"
 
 #ifndef DOXYGEN_SHOULD_SKIP_THIS
 
+#include <cstddef>
 #include <cstdio>
 #include <functional>
 #include <openssl/types.h>
@@ -72,15 +74,32 @@ namespace core::socket::stream::tls {
                               const utils::Timeval& terminateTimeout);
 
     public:
+        // A flush ends when a record drains the write queue, it approximates one response of a request/response protocol
+        struct RecordStats {
+            std::size_t records = 0;
+            std::size_t flushes = 0;
+            std::size_t lastFlushRecords = 0;
+            std::size_t maxFlushRecords = 0;
+        };
+
+        static constexpr std::size_t smallRecordSize = 1400;
+        static constexpr std::size_t fullRecordSize = 16384;
+        static constexpr std::size_t recordRampBytes = 1024 * 1024;
+
         logger::BoundaryLogger log() const;
         logger::BoundaryLogger log(logger::BoundaryLogger::Sink sink,
                                    logger::LogLevel threshold = logger::LogLevel::Trace,
                                    logger::BoundaryLogger::Clock clock = {}) const;
 
+        const RecordStats& getRecordStats() const;
+
     private:
         ssize_t write(const char* chunk, std::size_t chunkLen) override;
+        ssize_t writev(const iovec* iov, int iovcnt) override;
 
     protected:
+        bool canSendFile() const override;
+
         virtual bool doSSLHandshake(const std::function<void()>& onSuccess,
                                     const std::function<void()>& onTimeout,
                                     const std::function<void(int)>& onStatus) = 0;
@@ -89,7 +108,22 @@ namespace core::socket::stream::tls {
 
         SSL* ssl = nullptr;
 
+        // Set while the kernel encrypts outgoing records (kTLS), plain send/sendmsg/sendfile are used then
+        bool kernelTlsSend = false;
+
     private:
+        // Records start small so the first bytes of a response can be decrypted early and grow to full size once the connection
+        // streams. After an idle second the congestion window has likely collapsed and the ramp starts over.
+        std::size_t recordSize = smallRecordSize;
+        std::size_t rampedBytes = 0;
+        utils::Timeval lastRecordAt;
+
+        // SSL_write must be retried with at least the length which got WANT_READ/WANT_WRITE
+        std::size_t retryRecordLen = 0;
+
+        RecordStats recordStats;
+        std::size_t flushRecords = 0;
+
         logger::LogScopeOwner logScope;
 
         friend struct detail::TLSLifecycleTestAccess;
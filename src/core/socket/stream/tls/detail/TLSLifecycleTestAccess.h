@@ -292,6 +292,17 @@ namespace core::socket::stream::tls::detail {
             connection.transitionTo(SocketConnection<PhysicalSocket, Config>::TlsTransportState::TlsActive);
         }
 
+        template <typename PhysicalSocket, typename Config>
+        static void enableKernelTls(SocketConnection<PhysicalSocket, Config>& connection, bool send) {
+            connection.kernelTls = true;
+            connection.SocketWriter::kernelTlsSend = send;
+        }
+
+        template <typename PhysicalSocket, typename Config>
+        static std::size_t recordSize(const SocketConnection<PhysicalSocket, Config>& connection) {
+            return connection.SocketWriter::recordSize;
+        }
+
         template <typename PhysicalSocket, typename Config>
         static bool transitionTo(SocketConnection<PhysicalSocket, Config>& connection, int state) {
             const auto next = static_cast<typename SocketConnection<PhysicalSocket, Config>::TlsTransportState>(state);
@@ -43,6 +43,8 @@
 
 #include "core/socket/stream/tls/ssl_utils.h"
 
+#include "core/socket/stream/tls/SessionCache.h"
+
 #include "log/LogScopeOwner.h"
 #include "log/Logger.h"
 #include "utils/PreserveErrno.h"
@@ -140,12 +142,18 @@ namespace core::socket::stream::tls {
 
             SSL_CTX_set_mode(ctx, SSL_MODE_ENABLE_PARTIAL_WRITE);
             SSL_CTX_set_mode(ctx, SSL_MODE_ACCEPT_MOVING_WRITE_BUFFER);
+            if (sslConfig.releaseBuffers) {
+                SSL_CTX_set_mode(ctx, SSL_MODE_RELEASE_BUFFERS);
+            }
 
             bool sslErr = false;
 
             if (sslConfig.server) {
                 SSL_CTX_set_session_id_context(ctx, reinterpret_cast<const unsigned char*>(&sslSessionCtxId), sizeof(sslSessionCtxId));
                 sslSessionCtxId++;
+
+                SessionCache::instance().attach(
+                    ctx, sslConfig.sessionCacheSize, sslConfig.sessionTimeout, sslConfig.ticketKeyRotation);
             }
             if (!sslConfig.caCert.empty() || !sslConfig.caCertDir.empty()) {
                 if (SSL_CTX_load_verify_locations(ctx,
@@ -225,6 +233,13 @@ namespace core::socket::stream::tls {
                 if (sslConfig.sslOptions != 0) {
                     SSL_CTX_set_options(ctx, sslConfig.sslOptions);
                 }
+                if (sslConfig.kernelTls) {
+#if defined(SSL_OP_ENABLE_KTLS)
+                    SSL_CTX_set_options(ctx, SSL_OP_ENABLE_KTLS);
+#else
+                    tlsLog().warn("{} SSL/TLS: Kernel TLS requested but not supported by this OpenSSL", sslConfig.instanceName);
+#endif
+                }
                 if (!sslConfig.cipherList.empty()) {
                     SSL_CTX_set_cipher_list(ctx, sslConfig.cipherList.c_str());
                 }
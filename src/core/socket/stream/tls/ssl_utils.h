@@ -44,6 +44,7 @@
 
 #ifndef DOXYGEN_SHOULD_SKIP_THIS
 
+#include <cstddef>
 #include <cstdint>
 #include <map>
 #include <string>
@@ -82,6 +83,11 @@ namespace core::socket::stream::tls {
         bool caCertAcceptUnknown = false;
         std::string cipherList;
         ssl_option_t sslOptions = 0;
+        bool kernelTls = false;
+        bool releaseBuffers = false;
+        std::size_t sessionCacheSize = 0;
+        long sessionTimeout = 0;
+        long ticketKeyRotation = 0;
         bool server = false;
     };
 
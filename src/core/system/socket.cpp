@@ -98,6 +98,26 @@ namespace core::system {
         return ::send(sockfd, buf, len, flags);
     }
 
+    ssize_t sendmsg(int sockfd, const msghdr* msg, int flags) {
+        errno = 0;
+        return ::sendmsg(sockfd, msg, flags);
+    }
+
+    ssize_t recvmsg(int sockfd, msghdr* msg, int flags) {
+        errno = 0;
+        return ::recvmsg(sockfd, msg, flags);
+    }
+
+    int sendmmsg(int sockfd, mmsghdr* msgvec, unsigned int vlen, int flags) {
+        errno = 0;
+        return ::sendmmsg(sockfd, msgvec, vlen, flags);
+    }
+
+    int recvmmsg(int sockfd, mmsghdr* msgvec, unsigned int vlen, int flags) {
+        errno = 0;
+        return ::recvmmsg(sockfd, msgvec, vlen, flags, nullptr);
+    }
+
     int getsockopt(int sockfd, int level, int optname, void* optval, socklen_t* optlen) {
         errno = 0;
         return ::getsockopt(sockfd, level, optname, optval, optlen);
@@ -108,6 +128,11 @@ namespace core::system {
         return ::setsockopt(sockfd, level, optname, optval, optlen);
     }
 
+    ssize_t sendfile(int outFd, int inFd, off_t* offset, std::size_t count) {
+        errno = 0;
+        return ::sendfile(outFd, inFd, offset, count);
+    }
+
     int shutdown(int sockfd, int how) {
         errno = 0;
         return ::shutdown(sockfd, how);
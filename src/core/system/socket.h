@@ -48,6 +48,7 @@
 
 // IWYU pragma: begin_exports
 
+#include <sys/sendfile.h>
 #include <sys/socket.h>
 #include <sys/types.h>
 
@@ -71,9 +72,16 @@ namespace core::system {
     int connect(int sockfd, const sockaddr* addr, socklen_t addrlen);
     ssize_t recv(int sockfd, void* buf, std::size_t len, int flags);
     ssize_t send(int sockfd, const void* buf, std::size_t len, int flags);
+    ssize_t sendmsg(int sockfd, const msghdr* msg, int flags);
+    ssize_t recvmsg(int sockfd, msghdr* msg, int flags);
+    int sendmmsg(int sockfd, mmsghdr* msgvec, unsigned int vlen, int flags);
+    int recvmmsg(int sockfd, mmsghdr* msgvec, unsigned int vlen, int flags);
     int getsockopt(int sockfd, int level, int optname, void* optval, socklen_t* optlen);
     int setsockopt(int sockfd, int level, int optname, const void* optval, socklen_t optlen);
 
+    // #include <sys/sendfile.h>
+    ssize_t sendfile(int outFd, int inFd, off_t* offset, std::size_t count);
+
 } // namespace core::system
 
 #endif // NET_SYSTEM_SOCKET_H
@@ -54,6 +54,11 @@ namespace core::system {
         return ::open(pathname, flags);
     }
 
+    int fstat(int fd, struct stat* statbuf) {
+        errno = 0;
+        return ::fstat(fd, statbuf);
+    }
+
     ssize_t read(int fd, void* buf, std::size_t count) {
         errno = 0;
         return ::read(fd, buf, count);
@@ -64,6 +69,16 @@ namespace core::system {
         return ::write(fd, buf, count);
     }
 
+    ssize_t pread(int fd, void* buf, std::size_t count, off_t offset) {
+        errno = 0;
+        return ::pread(fd, buf, count, offset);
+    }
+
+    int dup(int oldfd) {
+        errno = 0;
+        return ::dup(oldfd);
+    }
+
     int close(int fd) {
         errno = 0;
         return ::close(fd);
@@ -74,9 +89,19 @@ namespace core::system {
         return ::pipe2(pipefd, flags);
     }
 
+    ssize_t splice(int fdIn, loff_t* offIn, int fdOut, loff_t* offOut, std::size_t len, unsigned int flags) {
+        errno = 0;
+        return ::splice(fdIn, offIn, fdOut, offOut, len, flags);
+    }
+
     int flock(int lockFd, int operation) {
         errno = 0;
         return ::flock(lockFd, operation);
     }
 
+    int eventfd(unsigned int initval, int flags) {
+        errno = 0;
+        return ::eventfd(initval, flags);
+    }
+
 } // namespace core::system
@@ -48,6 +48,7 @@
 
 #include <cstddef>
 #include <fcntl.h>
+#include <sys/eventfd.h>
 #include <sys/file.h>
 #include <sys/stat.h>
 #include <sys/types.h>
@@ -61,14 +62,23 @@ namespace core::system {
 
     // #include <sys/types.h>, #include <sys/stat.h>, #include <fcntl.h>
     int open(const char* pathname, int flags);
+    int fstat(int fd, struct stat* statbuf);
 
     // #include <unistd.h>
     ssize_t read(int fd, void* buf, std::size_t count);
     ssize_t write(int fd, const void* buf, std::size_t count);
+    ssize_t pread(int fd, void* buf, std::size_t count, off_t offset);
+    int dup(int oldfd);
     int close(int fd);
     int pipe2(int pipefd[2], int flags);
+
+    // #include <fcntl.h>
+    ssize_t splice(int fdIn, loff_t* offIn, int fdOut, loff_t* offOut, std::size_t len, unsigned int flags);
     int flock(int lockFd, int operation);
 
+    // #include <sys/eventfd.h>
+    int eventfd(unsigned int initval, int flags);
+
 } // namespace core::system
 
 #endif // NET_SYSTEM_UNISTD_H
@@ -54,6 +54,8 @@ namespace CLI {
     class Option;
 } // namespace CLI
 
+#include <functional>
+
 #endif // DOXYGEN_SHOULD_SKIP_THIS
 
 namespace net::config {
@@ -78,6 +80,10 @@ namespace net::config {
         SocketAddress& getSocketAddress();
         void renew();
 
+        // Starts resolving the configured host in the background. Returns true if onResolved will be called once the
+        // address is known, false if getSocketAddress() can be used right away.
+        virtual bool resolve(const std::function<void()>& onResolved);
+
     private:
         virtual SocketAddress* init() = 0;
 
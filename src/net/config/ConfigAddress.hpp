@@ -75,6 +75,11 @@ namespace net::config {
         return *socketAddress;
     }
 
+    template <typename SocketAddress>
+    bool ConfigAddress<SocketAddress>::resolve([[maybe_unused]] const std::function<void()>& onResolved) {
+        return false;
+    }
+
     template <typename SocketAddress>
     void ConfigAddress<SocketAddress>::renew() {
         if (socketAddress != nullptr) {
@@ -47,6 +47,9 @@
 
 #endif /* DOXYGEN_SHOULD_SKIP_THIS */
 
+#define XSTR(s) STR(s)
+#define STR(s) #s
+
 namespace net::config {
 
     ConfigConnection::ConfigConnection(ConfigInstance* instance)
@@ -85,6 +88,13 @@ namespace net::config {
             "timeout",
             TERMINATE_TIMEOUT,
             CLI::PositiveNumber);
+
+        readPersistentInterestOpt = addFlag( //
+            "--read-persistent-interest{true}",
+            "Keep read interest registered while received data is processed",
+            "BOOL",
+            XSTR(READ_PERSISTENT_INTEREST),
+            CLI::IsMember({"true", "false"}));
     }
 
     ConfigConnection::~ConfigConnection() {
@@ -140,4 +150,14 @@ namespace net::config {
         return this;
     }
 
+    bool ConfigConnection::getReadPersistentInterest() const {
+        return readPersistentInterestOpt->as<bool>();
+    }
+
+    ConfigConnection* ConfigConnection::setReadPersistentInterest(bool persistentInterest) {
+        setDefaultValue(readPersistentInterestOpt, persistentInterest ? "true" : "false");
+
+        return this;
+    }
+
 } // namespace net::config
@@ -84,12 +84,16 @@ namespace net::config {
         utils::Timeval getTerminateTimeout() const;
         ConfigConnection* setTerminateTimeout(const utils::Timeval& newTerminateTimeout);
 
+        bool getReadPersistentInterest() const;
+        ConfigConnection* setReadPersistentInterest(bool persistentInterest = true);
+
     private:
         CLI::Option* readTimeoutOpt = nullptr;
         CLI::Option* writeTimeoutOpt = nullptr;
         CLI::Option* readBlockSizeOpt = nullptr;
         CLI::Option* writeBlockSizeOpt = nullptr;
         CLI::Option* terminateTimeoutOpt = nullptr;
+        CLI::Option* readPersistentInterestOpt = nullptr;
     };
 
 } // namespace net::config
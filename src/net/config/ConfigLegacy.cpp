@@ -47,13 +47,49 @@
 
 #endif /* DOXYGEN_SHOULD_SKIP_THIS */
 
+#define XSTR(s) STR(s)
+#define STR(s) #s
+
 namespace net::config {
 
     ConfigLegacy::ConfigLegacy(ConfigInstance* instance)
         : ConfigSection(instance, this) {
+        zeroCopyOpt = addFlag( //
+            "--zerocopy{true}",
+            "Send large writes with MSG_ZEROCOPY (TCP only)",
+            "BOOL",
+            XSTR(ZERO_COPY),
+            CLI::IsMember({"true", "false"}));
+
+        zeroCopyThresholdOpt = addOption( //
+            "--zerocopy-threshold",
+            "Minimum size of a write sent with MSG_ZEROCOPY",
+            "size",
+            ZERO_COPY_THRESHOLD,
+            CLI::PositiveNumber);
     }
 
     ConfigLegacy::~ConfigLegacy() {
     }
 
+    bool ConfigLegacy::getZeroCopy() const {
+        return zeroCopyOpt->as<bool>();
+    }
+
+    ConfigLegacy* ConfigLegacy::setZeroCopy(bool zeroCopy) {
+        setDefaultValue(zeroCopyOpt, zeroCopy ? "true" : "false");
+
+        return this;
+    }
+
+    std::size_t ConfigLegacy::getZeroCopyThreshold() const {
+        return zeroCopyThresholdOpt->as<std::size_t>();
+    }
+
+    ConfigLegacy* ConfigLegacy::setZeroCopyThreshold(std::size_t zeroCopyThreshold) {
+        setDefaultValue(zeroCopyThresholdOpt, zeroCopyThreshold);
+
+        return this;
+    }
+
 } // namespace net::config
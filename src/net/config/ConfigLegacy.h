@@ -50,6 +50,7 @@ namespace net::config {
 
 #ifndef DOXYGEN_SHOULD_SKIP_THIS
 
+#include <cstddef>
 #include <string_view>
 
 #endif /* DOXYGEN_SHOULD_SKIP_THIS */
@@ -65,6 +66,17 @@ namespace net::config {
         explicit ConfigLegacy(ConfigInstance* instance);
 
         ~ConfigLegacy() override;
+
+    public:
+        bool getZeroCopy() const;
+        ConfigLegacy* setZeroCopy(bool zeroCopy = true);
+
+        std::size_t getZeroCopyThreshold() const;
+        ConfigLegacy* setZeroCopyThreshold(std::size_t zeroCopyThreshold);
+
+    private:
+        CLI::Option* zeroCopyOpt = nullptr;
+        CLI::Option* zeroCopyThresholdOpt = nullptr;
     };
 
 } // namespace net::config
@@ -152,6 +152,26 @@ namespace net::config {
         return noCloseNotifyIsEOFOpt;
     }
 
+    ConfigTls* ConfigTls::setKernelTls(bool set) {
+        setDefaultValue(kernelTlsOpt, set ? "true" : "false");
+
+        return this;
+    }
+
+    bool ConfigTls::getKernelTls() const {
+        return kernelTlsOpt->as<bool>();
+    }
+
+    ConfigTls* ConfigTls::setReleaseBuffers(bool set) {
+        setDefaultValue(releaseBuffersOpt, set ? "true" : "false");
+
+        return this;
+    }
+
+    bool ConfigTls::getReleaseBuffers() const {
+        return releaseBuffersOpt->as<bool>();
+    }
+
     ConfigTls* ConfigTls::setInitTimeout(const utils::Timeval& newInitTimeout) {
         setDefaultValue(initTimeoutOpt, newInitTimeout);
 
@@ -107,6 +107,12 @@ namespace net::config {
         ConfigTls* setNoCloseNotifyIsEOF(bool noCloseNotifyIsEOF = true);
         bool getNoCloseNotifyIsEOF() const;
 
+        ConfigTls* setKernelTls(bool set = true);
+        bool getKernelTls() const;
+
+        ConfigTls* setReleaseBuffers(bool set = true);
+        bool getReleaseBuffers() const;
+
     private:
         static CLI::Validator IsEmpty;
 
@@ -119,6 +125,8 @@ namespace net::config {
         CLI::Option* caCertAcceptUnknownOpt = nullptr;
         CLI::Option* cipherListOpt = nullptr;
         CLI::Option* sslOptionsOpt = nullptr;
+        CLI::Option* kernelTlsOpt = nullptr;
+        CLI::Option* releaseBuffersOpt = nullptr;
         CLI::Option* initTimeoutOpt = nullptr;
         CLI::Option* shutdownTimeoutOpt = nullptr;
         bool noCloseNotifyIsEOFOpt = false;
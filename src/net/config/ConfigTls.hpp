@@ -110,6 +110,20 @@ namespace net::config {
             0,
             CLI::TypeValidator<ssl_option_t>());
 
+        kernelTlsOpt = addFlag( //
+            "--kernel-tls{true}",
+            "Offload record encryption to the kernel (kTLS) after the handshake if supported",
+            "BOOL",
+            "false",
+            CLI::IsMember({"true", "false"}));
+
+        releaseBuffersOpt = addFlag( //
+            "--release-buffers{true}",
+            "Free the SSL/TLS record buffers of idle connections",
+            "BOOL",
+            "false",
+            CLI::IsMember({"true", "false"}));
+
         initTimeoutOpt = addOption( //
             "--init-timeout",
             "SSL/TLS initialization timeout in seconds",
@@ -115,6 +115,27 @@ namespace net::config {
             "false",
             CLI::IsMember({"true", "false"}));
 
+        sessionCacheSizeOpt = addOption( //
+            "--session-cache-size",
+            "Sessions kept in the session cache shared by all listeners (0 = no session cache)",
+            "sessions",
+            TLS_SESSION_CACHE_SIZE,
+            CLI::NonNegativeNumber);
+
+        sessionTimeoutOpt = addOption( //
+            "--session-timeout",
+            "Lifetime of cached sessions and session tickets in seconds",
+            "timeout",
+            TLS_SESSION_TIMEOUT,
+            CLI::PositiveNumber);
+
+        ticketKeyRotationOpt = addOption( //
+            "--ticket-key-rotation",
+            "Rotation interval in seconds of the session ticket keys shared by all listeners (0 = per listener keys)",
+            "interval",
+            TLS_TICKET_KEY_ROTATION,
+            CLI::NonNegativeNumber);
+
         finalCallback([this]() {
             for (auto& [domain, sniMap] : configuredSniCerts) {
                 if (domain.empty()) {
@@ -153,6 +174,36 @@ namespace net::config {
         return forceSniOpt->as<bool>();
     }
 
+    ConfigTlsServer* ConfigTlsServer::setSessionCacheSize(std::size_t sessionCacheSize) {
+        setDefaultValue(sessionCacheSizeOpt, sessionCacheSize);
+
+        return this;
+    }
+
+    std::size_t ConfigTlsServer::getSessionCacheSize() const {
+        return sessionCacheSizeOpt->as<std::size_t>();
+    }
+
+    ConfigTlsServer* ConfigTlsServer::setSessionTimeout(long sessionTimeout) {
+        setDefaultValue(sessionTimeoutOpt, sessionTimeout);
+
+        return this;
+    }
+
+    long ConfigTlsServer::getSessionTimeout() const {
+        return sessionTimeoutOpt->as<long>();
+    }
+
+    ConfigTlsServer* ConfigTlsServer::setTicketKeyRotation(long ticketKeyRotation) {
+        setDefaultValue(ticketKeyRotationOpt, ticketKeyRotation);
+
+        return this;
+    }
+
+    long ConfigTlsServer::getTicketKeyRotation() const {
+        return ticketKeyRotationOpt->as<long>();
+    }
+
     ConfigTlsServer* ConfigTlsServer::addSniCerts(
         const std::map<std::string, std::map<std::string, std::variant<std::string, bool, ssl_option_t>>>& sniCerts) {
         defaultSniCerts.insert(sniCerts.begin(), sniCerts.end());
@@ -52,6 +52,7 @@ namespace net::config {
 
 #ifndef DOXYGEN_SHOULD_SKIP_THIS
 
+#include <cstddef>
 #include <map>
 #include <string>
 #include <variant>
@@ -73,6 +74,15 @@ namespace net::config {
         ConfigTlsServer* setForceSni(bool forceSni = true);
         bool getForceSni() const;
 
+        ConfigTlsServer* setSessionCacheSize(std::size_t sessionCacheSize);
+        std::size_t getSessionCacheSize() const;
+
+        ConfigTlsServer* setSessionTimeout(long sessionTimeout);
+        long getSessionTimeout() const;
+
+        ConfigTlsServer* setTicketKeyRotation(long ticketKeyRotation);
+        long getTicketKeyRotation() const;
+
         ConfigTlsServer*
         addSniCerts(const std::map<std::string, std::map<std::string, std::variant<std::string, bool, ssl_option_t>>>& sniCerts);
         ConfigTlsServer* addSniCert(const std::string& domain,
@@ -85,6 +95,9 @@ namespace net::config {
 
         CLI::Option* sniCertsOpt = nullptr;
         CLI::Option* forceSniOpt = nullptr;
+        CLI::Option* sessionCacheSizeOpt = nullptr;
+        CLI::Option* sessionTimeoutOpt = nullptr;
+        CLI::Option* ticketKeyRotationOpt = nullptr;
     };
 
 } // namespace net::config
@@ -77,6 +77,8 @@ namespace net::config::stream::tls {
             sslConfig.sslOptions = getSslOptions();
             sslConfig.caCertUseDefaultDir = getCaCertDirUseDefault();
             sslConfig.caCertAcceptUnknown = getCaCertAcceptUnknown();
+            sslConfig.kernelTls = getKernelTls();
+            sslConfig.releaseBuffers = getReleaseBuffers();
 
             sslCtx = core::socket::stream::tls::ssl_ctx_new(sslConfig);
         }
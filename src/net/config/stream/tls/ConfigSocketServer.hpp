@@ -91,6 +91,11 @@ namespace net::config::stream::tls {
             sslConfig.sslOptions = getSslOptions();
             sslConfig.caCertUseDefaultDir = getCaCertDirUseDefault();
             sslConfig.caCertAcceptUnknown = getCaCertAcceptUnknown();
+            sslConfig.kernelTls = getKernelTls();
+            sslConfig.releaseBuffers = getReleaseBuffers();
+            sslConfig.sessionCacheSize = getSessionCacheSize();
+            sslConfig.sessionTimeout = getSessionTimeout();
+            sslConfig.ticketKeyRotation = getTicketKeyRotation();
 
             sslCtx = core::socket::stream::tls::ssl_ctx_new(sslConfig);
         }
@@ -110,6 +115,11 @@ namespace net::config::stream::tls {
                     core::socket::stream::tls::SslConfig sslConfig(true);
 
                     sslConfig.instanceName = getInstanceName();
+                    sslConfig.kernelTls = getKernelTls();
+                    sslConfig.releaseBuffers = getReleaseBuffers();
+                    sslConfig.sessionCacheSize = getSessionCacheSize();
+                    sslConfig.sessionTimeout = getSessionTimeout();
+                    sslConfig.ticketKeyRotation = getTicketKeyRotation();
 
                     for (const auto& [key, value] : sniCertConf) {
                         if (key == "Cert") {
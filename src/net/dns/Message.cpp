@@ -0,0 +1,320 @@
+/*
+ * SNode.C - A Slim Toolkit for Network Communication
+ * Copyright (C) Volker Christian <me@vchrist.at>
+ *               2020, 2021, 2022, 2023, 2024, 2025, 2026
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "net/dns/Message.h"
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+
+#include <algorithm>
+#include <cctype>
+#include <cstring>
+#include <limits>
+
+#endif /* DOXYGEN_SHOULD_SKIP_THIS */
+
+namespace net::dns {
+
+    namespace {
+
+        constexpr std::uint16_t CLASS_IN = 1;
+        constexpr std::uint16_t FLAG_QR = 0x8000;
+        constexpr std::uint16_t FLAG_TC = 0x0200;
+        constexpr std::uint16_t FLAG_RD = 0x0100;
+        constexpr std::size_t HEADER_SIZE = 12;
+        constexpr std::size_t MAX_NAME_SIZE = 255;
+        constexpr std::size_t MAX_LABEL_SIZE = 63;
+        constexpr int MAX_POINTERS = 16;
+        constexpr int MAX_CNAME_HOPS = 16;
+
+        void putU16(std::vector<char>& message, std::uint16_t value) {
+            message.push_back(static_cast<char>(value >> 8));
+            message.push_back(static_cast<char>(value & 0xFF));
+        }
+
+        struct Record {
+            std::string owner;
+            std::uint16_t type = 0;
+            std::uint32_t ttl = 0;
+            std::size_t rdata = 0;
+            std::uint16_t rdlength = 0;
+        };
+
+        class Reader {
+        public:
+            Reader(const char* data, std::size_t length)
+                : data(reinterpret_cast<const unsigned char*>(data))
+                , length(length) {
+            }
+
+            bool u16(std::size_t& offset, std::uint16_t& value) const {
+                const bool ok = offset + 2 <= length;
+
+                if (ok) {
+                    value = static_cast<std::uint16_t>(data[offset] << 8 | data[offset + 1]);
+                    offset += 2;
+                }
+
+                return ok;
+            }
+
+            bool u32(std::size_t& offset, std::uint32_t& value) const {
+                std::uint16_t high = 0;
+                std::uint16_t low = 0;
+
+                const bool ok = u16(offset, high) && u16(offset, low);
+                value = static_cast<std::uint32_t>(high) << 16 | low;
+
+                return ok;
+            }
+
+            // Decodes a possibly compressed name into lower case dotted form, offset is left behind the name in the message
+            bool name(std::size_t& offset, std::string& name) const {
+                std::size_t position = offset;
+                bool jumped = false;
+                int pointers = 0;
+
+                name.clear();
+
+                for (;;) {
+                    if (position >= length) {
+                        return false;
+                    }
+
+                    const unsigned char labelLength = data[position];
+
+                    if ((labelLength & 0xC0) == 0xC0) {
+                        if (position + 1 >= length || ++pointers > MAX_POINTERS) {
+                            return false;
+                        }
+                        if (!jumped) {
+                            offset = position + 2;
+                            jumped = true;
+                        }
+                        position = static_cast<std::size_t>(labelLength & 0x3F) << 8 | data[position + 1];
+                    } else if ((labelLength & 0xC0) != 0) {
+                        return false;
+                    } else if (labelLength == 0) {
+                        if (!jumped) {
+                            offset = position + 1;
+                        }
+                        return true;
+                    } else {
+                        if (position + 1 + labelLength > length || name.size() + labelLength + 1 > MAX_NAME_SIZE) {
+                            return false;
+                        }
+                        if (!name.empty()) {
+                            name += '.';
+                        }
+                        for (std::size_t i = position + 1; i < position + 1 + labelLength; i++) {
+                            name += static_cast<char>(std::tolower(data[i]));
+                        }
+                        position += 1 + labelLength;
+                    }
+                }
+            }
+
+            bool record(std::size_t& offset, Record& record) const {
+                std::uint16_t recordClass = 0;
+
+                const bool ok = name(offset, record.owner) && u16(offset, record.type) && u16(offset, recordClass) &&
+                                u32(offset, record.ttl) && u16(offset, record.rdlength) && offset + record.rdlength <= length;
+
+                if (ok) {
+                    record.rdata = offset;
+                    offset += record.rdlength;
+                }
+
+                return ok;
+            }
+
+            const unsigned char* at(std::size_t offset) const {
+                return data + offset;
+            }
+
+        private:
+            const unsigned char* data;
+            std::size_t length;
+        };
+
+    } // namespace
+
+    std::vector<char> Message::query(std::uint16_t id, const std::string& name, std::uint16_t type) {
+        std::vector<char> message;
+        message.reserve(HEADER_SIZE + name.size() + 6);
+
+        putU16(message, id);
+        putU16(message, FLAG_RD);
+        putU16(message, 1);
+        putU16(message, 0);
+        putU16(message, 0);
+        putU16(message, 0);
+
+        std::size_t labelStart = 0;
+        bool valid = !name.empty() && name.size() < MAX_NAME_SIZE;
+
+        while (valid && labelStart <= name.size()) {
+            std::size_t labelEnd = name.find('.', labelStart);
+            labelEnd = labelEnd == std::string::npos ? name.size() : labelEnd;
+
+            const std::size_t labelLength = labelEnd - labelStart;
+            valid = labelLength > 0 && labelLength <= MAX_LABEL_SIZE;
+
+            if (valid) {
+                message.push_back(static_cast<char>(labelLength));
+                message.insert(message.end(),
+                               name.begin() + static_cast<std::ptrdiff_t>(labelStart),
+                               name.begin() + static_cast<std::ptrdiff_t>(labelEnd));
+            }
+
+            labelStart = labelEnd + 1;
+        }
+
+        if (valid) {
+            message.push_back(0);
+            putU16(message, type);
+            putU16(message, CLASS_IN);
+        } else {
+            message.clear();
+        }
+
+        return message;
+    }
+
+    bool Message::parse(
+        const char* data, std::size_t length, std::uint16_t id, const std::string& name, std::uint16_t type, Message& message) {
+        const Reader reader(data, length);
+        std::size_t offset = 0;
+
+        std::uint16_t responseId = 0;
+        std::uint16_t flags = 0;
+        std::uint16_t questions = 0;
+        std::uint16_t answers = 0;
+        std::uint16_t authorities = 0;
+        std::uint16_t additionals = 0;
+
+        bool ok = reader.u16(offset, responseId) && reader.u16(offset, flags) && reader.u16(offset, questions) &&
+                  reader.u16(offset, answers) && reader.u16(offset, authorities) && reader.u16(offset, additionals) && responseId == id &&
+                  (flags & FLAG_QR) != 0;
+
+        message = Message();
+        message.rcode = static_cast<std::uint8_t>(flags & 0x000F);
+        message.truncated = (flags & FLAG_TC) != 0;
+
+        for (std::uint16_t i = 0; ok && i < questions; i++) {
+            std::string questionName;
+            std::uint16_t questionType = 0;
+            std::uint16_t questionClass = 0;
+
+            ok = reader.name(offset, questionName) && reader.u16(offset, questionType) && reader.u16(offset, questionClass) &&
+                 (i > 0 || (questionName == name && questionType == type));
+        }
+
+        // A truncated message is retried over TCP, its records need not be complete
+        std::vector<Record> records(ok && !message.truncated ? static_cast<std::size_t>(answers) + authorities : 0);
+        for (std::size_t i = 0; ok && i < records.size(); i++) {
+            ok = reader.record(offset, records[i]);
+        }
+
+        if (ok && !message.truncated) {
+            std::uint32_t ttl = std::numeric_limits<std::uint32_t>::max();
+            std::string current = name;
+
+            for (int hop = 0; hop < MAX_CNAME_HOPS && ok && message.addresses4.empty() && message.addresses6.empty(); hop++) {
+                const Record* cname = nullptr;
+
+                for (std::size_t i = 0; i < answers; i++) {
+                    const Record& record = records[i];
+
+                    if (record.owner != current) {
+                        continue;
+                    }
+                    if (record.type == type && type == TYPE_A && record.rdlength == sizeof(in_addr)) {
+                        in_addr address{};
+                        std::memcpy(&address, reader.at(record.rdata), sizeof(address));
+                        message.addresses4.push_back(address);
+                        ttl = std::min(ttl, record.ttl);
+                    } else if (record.type == type && type == TYPE_AAAA && record.rdlength == sizeof(in6_addr)) {
+                        in6_addr address{};
+                        std::memcpy(&address, reader.at(record.rdata), sizeof(address));
+                        message.addresses6.push_back(address);
+                        ttl = std::min(ttl, record.ttl);
+                    } else if (record.type == TYPE_CNAME && cname == nullptr) {
+                        cname = &record;
+                    }
+                }
+
+                if (message.addresses4.empty() && message.addresses6.empty() && cname != nullptr) {
+                    std::size_t target = cname->rdata;
+                    ok = reader.name(target, current);
+                    ttl = std::min(ttl, cname->ttl);
+                } else {
+                    break;
+                }
+            }
+
+            message.canonName = current;
+            message.ttl = message.addresses4.empty() && message.addresses6.empty() ? 0 : ttl;
+
+            for (std::size_t i = answers; ok && i < records.size(); i++) {
+                const Record& record = records[i];
+
+                if (record.type == TYPE_SOA) {
+                    std::size_t soa = record.rdata;
+                    std::string primary;
+                    std::string mailbox;
+                    std::uint32_t serial = 0;
+                    std::uint32_t refresh = 0;
+                    std::uint32_t retry = 0;
+                    std::uint32_t expire = 0;
+                    std::uint32_t minimum = 0;
+
+                    if (reader.name(soa, primary) && reader.name(soa, mailbox) && reader.u32(soa, serial) && reader.u32(soa, refresh) &&
+                        reader.u32(soa, retry) && reader.u32(soa, expire) && reader.u32(soa, minimum)) {
+                        message.negativeTtl = std::min(record.ttl, minimum);
+                    }
+                }
+            }
+        }
+
+        return ok;
+    }
+
+} // namespace net::dns
@@ -0,0 +1,92 @@
+/*
+ * SNode.C - A Slim Toolkit for Network Communication
+ * Copyright (C) Volker Christian <me@vchrist.at>
+ *               2020, 2021, 2022, 2023, 2024, 2025, 2026
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef NET_DNS_MESSAGE_H
+#define NET_DNS_MESSAGE_H
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+
+#include <cstddef>
+#include <cstdint>
+#include <netinet/in.h>
+#include <optional>
+#include <string>
+#include <vector>
+
+#endif /* DOXYGEN_SHOULD_SKIP_THIS */
+
+namespace net::dns {
+
+    // Wire format of the DNS messages exchanged by the resolver (RFC 1035). Only what an A/AAAA lookup needs is understood.
+    struct Message {
+        static constexpr std::uint16_t TYPE_A = 1;
+        static constexpr std::uint16_t TYPE_CNAME = 5;
+        static constexpr std::uint16_t TYPE_SOA = 6;
+        static constexpr std::uint16_t TYPE_AAAA = 28;
+
+        static constexpr std::uint8_t RCODE_NOERROR = 0;
+        static constexpr std::uint8_t RCODE_NXDOMAIN = 3;
+
+        // A recursive query for one name and type. Returns an empty message if the name can not be encoded
+        static std::vector<char> query(std::uint16_t id, const std::string& name, std::uint16_t type);
+
+        // Parses a response to query(id, name, type). Returns false if the message is malformed or answers a different question
+        static bool
+        parse(const char* data, std::size_t length, std::uint16_t id, const std::string& name, std::uint16_t type, Message& message);
+
+        std::uint8_t rcode = RCODE_NOERROR;
+        bool truncated = false;
+
+        // The end of the CNAME chain starting at the queried name, and the addresses found there
+        std::string canonName;
+        std::vector<in_addr> addresses4;
+        std::vector<in6_addr> addresses6;
+
+        // Lowest TTL along the answer chain
+        std::uint32_t ttl = 0;
+
+        // TTL of a negative answer, taken from the SOA record of the authority section (RFC 2308)
+        std::optional<std::uint32_t> negativeTtl;
+    };
+
+} // namespace net::dns
+
+#endif // NET_DNS_MESSAGE_H
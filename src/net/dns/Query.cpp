@@ -0,0 +1,228 @@
+/*
+ * SNode.C - A Slim Toolkit for Network Communication
+ * Copyright (C) Volker Christian <me@vchrist.at>
+ *               2020, 2021, 2022, 2023, 2024, 2025, 2026
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "net/dns/Query.h"
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+
+#include "core/system/socket.h"
+#include "core/system/unistd.h"
+
+#include <cerrno>
+#include <random>
+
+#endif /* DOXYGEN_SHOULD_SKIP_THIS */
+
+namespace net::dns {
+
+    namespace {
+
+        // Large enough for any UDP response, the kernel truncates the rest
+        constexpr std::size_t MAX_UDP_RESPONSE = 4096;
+
+        std::uint16_t nextId() {
+            thread_local std::mt19937 generator(std::random_device{}());
+            thread_local std::uniform_int_distribution<unsigned int> distribution(0, 0xFFFF);
+
+            return static_cast<std::uint16_t>(distribution(generator));
+        }
+
+    } // namespace
+
+    Query::Query(const std::string& name, std::uint16_t type, bool tcp, const utils::Timeval& timeout, const OnDone& onDone)
+        : core::eventreceiver::ReadEventReceiver("DNS query " + name, timeout)
+        , core::eventreceiver::WriteEventReceiver("DNS query " + name, core::DescriptorEventReceiver::TIMEOUT::DISABLE)
+        , name(name)
+        , type(type)
+        , tcp(tcp)
+        , id(nextId())
+        , onDone(onDone) {
+    }
+
+    Query::~Query() {
+        if (fd >= 0) {
+            core::system::close(fd);
+        }
+    }
+
+    bool Query::start(const std::string& name,
+                      std::uint16_t type,
+                      const sockaddr_storage& server,
+                      socklen_t serverLength,
+                      bool tcp,
+                      const utils::Timeval& timeout,
+                      const OnDone& onDone) {
+        Query* query = new Query(name, type, tcp, timeout, onDone);
+
+        const bool started = query->send(server, serverLength);
+        if (!started) {
+            delete query;
+        }
+
+        return started;
+    }
+
+    bool Query::send(const sockaddr_storage& server, socklen_t serverLength) {
+        request = Message::query(id, name, type);
+
+        if (tcp && !request.empty()) {
+            // Over TCP every message is preceded by its length
+            const std::size_t length = request.size();
+            request.insert(request.begin(), {static_cast<char>(length >> 8), static_cast<char>(length & 0xFF)});
+        }
+
+        // A connected UDP socket only receives datagrams from the name server
+        bool sent = !request.empty() &&
+                    (fd = core::system::socket(server.ss_family, (tcp ? SOCK_STREAM : SOCK_DGRAM) | SOCK_NONBLOCK | SOCK_CLOEXEC, 0)) >=
+                        0 &&
+                    (core::system::connect(fd, reinterpret_cast<const sockaddr*>(&server), serverLength) == 0 || errno == EINPROGRESS);
+
+        if (sent && !tcp) {
+            sent = core::system::send(fd, request.data(), request.size(), MSG_NOSIGNAL) == static_cast<ssize_t>(request.size());
+        }
+
+        if (sent && tcp) {
+            sent = WriteEventReceiver::enable(fd);
+
+            // Once one receiver is enabled the query has started: its unobserved event reports the attempt as cancelled
+            if (sent && !ReadEventReceiver::enable(fd)) {
+                WriteEventReceiver::disable();
+            }
+        } else if (sent) {
+            sent = ReadEventReceiver::enable(fd);
+        }
+
+        return sent;
+    }
+
+    void Query::readEvent() {
+        if (tcp) {
+            char chunk[MAX_UDP_RESPONSE];
+            const ssize_t received = core::system::recv(fd, chunk, sizeof(chunk), 0);
+
+            if (received > 0) {
+                response.insert(response.end(), chunk, chunk + received);
+
+                const std::size_t length =
+                    response.size() >= 2
+                        ? static_cast<std::size_t>(static_cast<unsigned char>(response[0])) << 8 | static_cast<unsigned char>(response[1])
+                        : 0;
+
+                if (response.size() >= 2 && response.size() - 2 >= length) {
+                    Message message;
+                    done(Message::parse(response.data() + 2, length, id, name, type, message) ? 0 : EBADMSG, message);
+                }
+            } else if (received == 0) {
+                done(ECONNRESET);
+            } else if (errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR) {
+                done(errno);
+            }
+        } else {
+            char datagram[MAX_UDP_RESPONSE];
+            const ssize_t received = core::system::recv(fd, datagram, sizeof(datagram), 0);
+
+            if (received >= 0) {
+                // Datagrams not answering our question are stale or forged, the answer may still be on its way
+                Message message;
+                if (Message::parse(datagram, static_cast<std::size_t>(received), id, name, type, message)) {
+                    done(0, message);
+                }
+            } else if (errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR) {
+                done(errno);
+            }
+        }
+    }
+
+    void Query::writeEvent() {
+        int error = 0;
+        socklen_t errorLength = sizeof(error);
+
+        if (requestSent == 0 && core::system::getsockopt(fd, SOL_SOCKET, SO_ERROR, &error, &errorLength) == 0 && error != 0) {
+            done(error);
+        } else {
+            const ssize_t sent = core::system::send(fd, request.data() + requestSent, request.size() - requestSent, MSG_NOSIGNAL);
+
+            if (sent > 0) {
+                requestSent += static_cast<std::size_t>(sent);
+
+                if (requestSent == request.size()) {
+                    WriteEventReceiver::disable();
+                }
+            } else if (errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR) {
+                done(errno);
+            }
+        }
+    }
+
+    void Query::readTimeout() {
+        done(ETIMEDOUT);
+    }
+
+    void Query::done(int errnum, const Message& message) {
+        if (!completed) {
+            completed = true;
+
+            if (ReadEventReceiver::isEnabled()) {
+                ReadEventReceiver::disable();
+            }
+            if (WriteEventReceiver::isEnabled()) {
+                WriteEventReceiver::disable();
+            }
+
+            onDone(errnum, message);
+        }
+    }
+
+    void Query::unobservedEvent() {
+        if (!completed) {
+            completed = true;
+
+            onDone(ECANCELED, {});
+        }
+
+        delete this;
+    }
+
+    void Query::destruct() {
+        delete this;
+    }
+
+} // namespace net::dns
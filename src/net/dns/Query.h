@@ -0,0 +1,121 @@
+/*
+ * SNode.C - A Slim Toolkit for Network Communication
+ * Copyright (C) Volker Christian <me@vchrist.at>
+ *               2020, 2021, 2022, 2023, 2024, 2025, 2026
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef NET_DNS_QUERY_H
+#define NET_DNS_QUERY_H
+
+#include "core/eventreceiver/ReadEventReceiver.h"
+#include "core/eventreceiver/WriteEventReceiver.h"
+#include "net/dns/Message.h"
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+
+#include "utils/Timeval.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <sys/socket.h>
+#include <vector>
+
+#endif /* DOXYGEN_SHOULD_SKIP_THIS */
+
+namespace net::dns {
+
+    /**
+     * One attempt of a DNS lookup: a single question sent to a single name server over UDP or TCP.
+     *
+     * Instances own themselves. onDone is called exactly once, with errnum == 0 and the parsed answer or with the errno of the
+     * failure: ETIMEDOUT if the server did not answer in time, EBADMSG for a malformed answer over TCP and ECANCELED if the
+     * query was dropped by the event loop. UDP datagrams not answering the question are ignored.
+     */
+    class Query final
+        : public core::eventreceiver::ReadEventReceiver
+        , public core::eventreceiver::WriteEventReceiver {
+    public:
+        using OnDone = std::function<void(int errnum, const Message& message)>;
+
+        Query(const Query&) = delete;
+
+        Query& operator=(const Query&) = delete;
+
+        // Returns false if the query could not be sent, onDone is not called then
+        static bool start(const std::string& name,
+                          std::uint16_t type,
+                          const sockaddr_storage& server,
+                          socklen_t serverLength,
+                          bool tcp,
+                          const utils::Timeval& timeout,
+                          const OnDone& onDone);
+
+    private:
+        Query(const std::string& name, std::uint16_t type, bool tcp, const utils::Timeval& timeout, const OnDone& onDone);
+        ~Query() override;
+
+        bool send(const sockaddr_storage& server, socklen_t serverLength);
+
+        void readEvent() override;
+        void writeEvent() override;
+        void readTimeout() override;
+        void unobservedEvent() override;
+        void destruct() final;
+
+        void done(int errnum, const Message& message = {});
+
+        std::string name;
+        std::uint16_t type;
+
+        int fd = -1;
+        bool tcp;
+        std::uint16_t id = 0;
+
+        std::vector<char> request;
+        std::size_t requestSent = 0;
+        std::vector<char> response;
+
+        OnDone onDone;
+        bool completed = false;
+    };
+
+} // namespace net::dns
+
+#endif // NET_DNS_QUERY_H
@@ -0,0 +1,399 @@
+/*
+ * SNode.C - A Slim Toolkit for Network Communication
+ * Copyright (C) Volker Christian <me@vchrist.at>
+ *               2020, 2021, 2022, 2023, 2024, 2025, 2026
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "net/dns/Resolver.h"
+
+#include "core/State.h"
+#include "net/dns/Message.h"
+#include "net/dns/Query.h"
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+
+#include "log/LogScopeOwner.h"
+#include "log/Logger.h"
+
+#include <algorithm>
+#include <arpa/inet.h>
+#include <cctype>
+#include <cerrno>
+#include <cstring>
+#include <fstream>
+#include <netdb.h>
+#include <sstream>
+
+#endif /* DOXYGEN_SHOULD_SKIP_THIS */
+
+namespace net::dns {
+
+    namespace {
+
+        // An answer has to outlive the connect it was looked up for
+        constexpr std::uint32_t MIN_TTL = 1;
+        constexpr std::uint32_t MAX_TTL = 86400;
+
+        // Negative answers without SOA record and failed lookups
+        constexpr std::uint32_t NEGATIVE_TTL = 30;
+        constexpr std::uint32_t FAILURE_TTL = 1;
+
+        constexpr std::size_t MAX_ENTRIES = 4096;
+        constexpr std::size_t MAX_NAME_SERVERS = 3;
+
+        logger::BoundaryLogger log() {
+            static const logger::LogScopeOwner logScope(logger::LogOrigin::Framework, logger::LogBoundary::System, "net.dns");
+
+            return logScope.logger(logger::Logger::semanticSink());
+        }
+
+        std::string normalize(const std::string& name) {
+            std::string normalized(name);
+
+            std::transform(normalized.begin(), normalized.end(), normalized.begin(), [](unsigned char c) {
+                return static_cast<char>(std::tolower(c));
+            });
+
+            if (!normalized.empty() && normalized.back() == '.') {
+                normalized.pop_back();
+            }
+
+            return normalized;
+        }
+
+        bool isNumeric(const std::string& name) {
+            in6_addr address{};
+
+            return inet_pton(AF_INET, name.c_str(), &address) == 1 || inet_pton(AF_INET6, name.c_str(), &address) == 1;
+        }
+
+        bool toSockAddr(const std::string& address, std::uint16_t port, std::pair<sockaddr_storage, socklen_t>& nameServer) {
+            nameServer = {};
+
+            sockaddr_in& sockAddr4 = reinterpret_cast<sockaddr_in&>(nameServer.first);
+            sockaddr_in6& sockAddr6 = reinterpret_cast<sockaddr_in6&>(nameServer.first);
+
+            bool valid = false;
+
+            if (inet_pton(AF_INET, address.c_str(), &sockAddr4.sin_addr) == 1) {
+                sockAddr4.sin_family = AF_INET;
+                sockAddr4.sin_port = htons(port);
+                nameServer.second = sizeof(sockaddr_in);
+                valid = true;
+            } else if (inet_pton(AF_INET6, address.c_str(), &sockAddr6.sin6_addr) == 1) {
+                sockAddr6.sin6_family = AF_INET6;
+                sockAddr6.sin6_port = htons(port);
+                nameServer.second = sizeof(sockaddr_in6);
+                valid = true;
+            }
+
+            return valid;
+        }
+
+        std::string stripComment(const std::string& line) {
+            return line.substr(0, line.find_first_of("#;"));
+        }
+
+        utils::Timeval expiresIn(std::uint32_t ttl) {
+            return utils::Timeval::currentTime() + utils::Timeval({static_cast<time_t>(std::clamp(ttl, MIN_TTL, MAX_TTL)), 0});
+        }
+
+        Resolver::Entry failure() {
+            return Resolver::Entry{
+                .aiErrCode = EAI_AGAIN, .canonName = {}, .addresses4 = {}, .addresses6 = {}, .expiry = expiresIn(FAILURE_TTL)};
+        }
+
+    } // namespace
+
+    Resolver& Resolver::instance() {
+        thread_local Resolver resolver;
+
+        return resolver;
+    }
+
+    void Resolver::configure(const std::string& resolvConf, const std::string& hosts) {
+        nameServers.clear();
+        hostNames.clear();
+        timeout = utils::Timeval({5, 0});
+        attempts = 2;
+
+        std::ifstream resolvConfStream(resolvConf);
+        std::string line;
+
+        while (std::getline(resolvConfStream, line)) {
+            std::istringstream tokens(stripComment(line));
+            std::string keyword;
+
+            tokens >> keyword;
+
+            if (keyword == "nameserver") {
+                std::string address;
+                std::pair<sockaddr_storage, socklen_t> nameServer;
+
+                if (tokens >> address && nameServers.size() < MAX_NAME_SERVERS && toSockAddr(address, 53, nameServer)) {
+                    nameServers.push_back(nameServer);
+                }
+            } else if (keyword == "options") {
+                std::string option;
+
+                while (tokens >> option) {
+                    if (option.starts_with("timeout:")) {
+                        timeout = utils::Timeval({std::clamp<time_t>(std::atol(option.c_str() + 8), 1, 30), 0});
+                    } else if (option.starts_with("attempts:")) {
+                        attempts = static_cast<std::size_t>(std::clamp(std::atol(option.c_str() + 9), 1L, 5L));
+                    }
+                }
+            }
+        }
+
+        std::ifstream hostsStream(hosts);
+
+        while (std::getline(hostsStream, line)) {
+            std::istringstream tokens(stripComment(line));
+            std::string address;
+            std::string hostName;
+
+            tokens >> address;
+            while (tokens >> hostName) {
+                hostNames.insert(normalize(hostName));
+            }
+        }
+
+        configured = true;
+
+        log().debug("{} name servers, {} host names, timeout {}s, {} attempts",
+                    nameServers.size(),
+                    hostNames.size(),
+                    timeout.getMs() / 1000,
+                    attempts);
+
+        flush();
+    }
+
+    void Resolver::setNameServers(const std::vector<NameServer>& nameServers) {
+        ensureConfigured();
+
+        this->nameServers.clear();
+
+        for (const NameServer& nameServer : nameServers) {
+            std::pair<sockaddr_storage, socklen_t> sockAddr;
+
+            if (toSockAddr(nameServer.address, nameServer.port, sockAddr)) {
+                this->nameServers.push_back(sockAddr);
+            } else {
+                log().warn("Name server '{}' is not a numeric address", nameServer.address);
+            }
+        }
+
+        flush();
+    }
+
+    void Resolver::setTimeout(const utils::Timeval& timeout) {
+        ensureConfigured();
+
+        this->timeout = timeout;
+    }
+
+    void Resolver::setAttempts(std::size_t attempts) {
+        ensureConfigured();
+
+        this->attempts = std::max<std::size_t>(attempts, 1);
+    }
+
+    bool Resolver::resolve(const std::string& name, int family, const std::function<void()>& onResolved) {
+        ensureConfigured();
+
+        const std::string normalized = normalize(name);
+        bool pending = false;
+
+        if (!nameServers.empty() && (family == AF_INET || family == AF_INET6) && normalized.find('.') != std::string::npos &&
+            !isNumeric(normalized) && !hostNames.contains(normalized)) {
+            if (lookup(normalized, family) != nullptr) {
+                stats.hits++;
+            } else {
+                stats.misses++;
+
+                const Key key(normalized, family);
+                const auto [it, inserted] = lookups.try_emplace(key);
+
+                it->second.onResolved.push_back(onResolved);
+
+                if (!inserted || query(key)) {
+                    pending = true;
+                } else {
+                    // Nothing went out: the caller goes on right away and finds the failure in the cache
+                    lookups.erase(it);
+                    cache[key] = failure();
+                }
+            }
+        }
+
+        return pending;
+    }
+
+    const Resolver::Entry* Resolver::lookup(const std::string& name, int family) {
+        auto it = cache.find(Key(normalize(name), family));
+
+        if (it != cache.end() && it->second.expiry <= utils::Timeval::currentTime()) {
+            cache.erase(it);
+            it = cache.end();
+        }
+
+        return it != cache.end() ? &it->second : nullptr;
+    }
+
+    void Resolver::flush() {
+        cache.clear();
+    }
+
+    Resolver::Stats Resolver::getStats() const {
+        return stats;
+    }
+
+    void Resolver::ensureConfigured() {
+        if (!configured) {
+            configure();
+        }
+    }
+
+    bool Resolver::query(const Key& key) {
+        Lookup& lookup = lookups.at(key);
+        bool started = false;
+
+        while (!started && lookup.attempt < attempts * nameServers.size()) {
+            const auto& [server, serverLength] = nameServers[lookup.attempt % nameServers.size()];
+
+            started = Query::start(key.first,
+                                   key.second == AF_INET6 ? Message::TYPE_AAAA : Message::TYPE_A,
+                                   server,
+                                   serverLength,
+                                   lookup.tcp,
+                                   timeout,
+                                   [this, key](int errnum, const Message& message) {
+                                       queryDone(key, errnum, message);
+                                   });
+
+            if (started) {
+                stats.queries++;
+            } else {
+                log().debug("Query for '{}' not sent: {}", key.first, std::strerror(errno));
+
+                lookup.attempt++;
+                lookup.tcp = false;
+            }
+        }
+
+        return started;
+    }
+
+    void Resolver::queryDone(const Key& key, int errnum, const Message& message) {
+        const auto it = lookups.find(key);
+
+        if (it != lookups.end()) {
+            Lookup& lookup = it->second;
+
+            if (errnum == 0 && message.truncated && !lookup.tcp) {
+                stats.tcpFallbacks++;
+                lookup.tcp = true;
+            } else if (errnum == 0 && message.rcode == Message::RCODE_NOERROR &&
+                       (!message.addresses4.empty() || !message.addresses6.empty())) {
+                complete(key,
+                         Entry{.aiErrCode = 0,
+                               .canonName = message.canonName,
+                               .addresses4 = message.addresses4,
+                               .addresses6 = message.addresses6,
+                               .expiry = expiresIn(message.ttl)});
+                return;
+            } else if (errnum == 0 &&
+                       (message.rcode == Message::RCODE_NXDOMAIN || (message.rcode == Message::RCODE_NOERROR && !message.truncated))) {
+                complete(key,
+                         Entry{.aiErrCode = EAI_NONAME,
+                               .canonName = {},
+                               .addresses4 = {},
+                               .addresses6 = {},
+                               .expiry = expiresIn(message.negativeTtl.value_or(NEGATIVE_TTL))});
+                return;
+            } else if (errnum == ECANCELED && core::eventLoopState() != core::State::RUNNING) {
+                lookup.attempt = attempts * nameServers.size();
+            } else {
+                if (errnum == ETIMEDOUT) {
+                    stats.timeouts++;
+                }
+                log().debug("Query for '{}' failed: {}",
+                            key.first,
+                            errnum != 0 ? std::strerror(errnum) : "rcode " + std::to_string(message.rcode));
+
+                lookup.attempt++;
+                lookup.tcp = false;
+            }
+
+            if (!query(key)) {
+                complete(key, failure());
+            }
+        }
+    }
+
+    void Resolver::complete(const Key& key, Entry entry) {
+        if (cache.size() >= MAX_ENTRIES) {
+            const utils::Timeval now = utils::Timeval::currentTime();
+
+            std::erase_if(cache, [&now](const auto& cached) {
+                return cached.second.expiry <= now;
+            });
+
+            if (cache.size() >= MAX_ENTRIES) {
+                cache.erase(std::min_element(cache.begin(), cache.end(), [](const auto& lhs, const auto& rhs) {
+                    return lhs.second.expiry < rhs.second.expiry;
+                }));
+            }
+        }
+
+        log().debug("'{}' resolved: {}", key.first, entry.aiErrCode == 0 ? "ok" : gai_strerror(entry.aiErrCode));
+
+        cache[key] = std::move(entry);
+
+        const auto it = lookups.find(key);
+        const std::vector<std::function<void()>> onResolved = std::move(it->second.onResolved);
+        lookups.erase(it);
+
+        for (const std::function<void()>& callback : onResolved) {
+            callback();
+        }
+    }
+
+} // namespace net::dns
@@ -0,0 +1,154 @@
+/*
+ * SNode.C - A Slim Toolkit for Network Communication
+ * Copyright (C) Volker Christian <me@vchrist.at>
+ *               2020, 2021, 2022, 2023, 2024, 2025, 2026
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef NET_DNS_RESOLVER_H
+#define NET_DNS_RESOLVER_H
+
+namespace net::dns {
+    struct Message;
+} // namespace net::dns
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+
+#include "utils/Timeval.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <netinet/in.h>
+#include <set>
+#include <string>
+#include <sys/socket.h>
+#include <utility>
+#include <vector>
+
+#endif /* DOXYGEN_SHOULD_SKIP_THIS */
+
+namespace net::dns {
+
+    /**
+     * Non-blocking stub resolver of an event loop.
+     *
+     * Host names are looked up with A/AAAA queries to the name servers of /etc/resolv.conf, over UDP and over TCP when an answer
+     * is truncated. Answers, negative ones included, are cached for their TTL. Names getaddrinfo() answers without asking the
+     * network - numeric addresses, names listed in /etc/hosts and single label names subject to the search list - are not
+     * handled and keep going through getaddrinfo().
+     */
+    class Resolver {
+    public:
+        struct NameServer {
+            std::string address; // Numeric IPv4 or IPv6 address
+            std::uint16_t port = 53;
+        };
+
+        struct Entry {
+            int aiErrCode = 0; // 0 for a positive answer, else the EAI_* error getaddrinfo() would report
+            std::string canonName;
+            std::vector<in_addr> addresses4;
+            std::vector<in6_addr> addresses6;
+            utils::Timeval expiry;
+        };
+
+        struct Stats {
+            std::size_t queries = 0;      // Messages sent to a name server
+            std::size_t hits = 0;         // Lookups answered from the cache
+            std::size_t misses = 0;       // Lookups which had to ask a name server
+            std::size_t timeouts = 0;     // Queries without an answer in time
+            std::size_t tcpFallbacks = 0; // Truncated answers repeated over TCP
+        };
+
+        Resolver(const Resolver&) = delete;
+
+        Resolver& operator=(const Resolver&) = delete;
+
+        static Resolver& instance();
+
+        // Replaces the configuration by the one in the given files and drops the cache. The system files are read on first use
+        void configure(const std::string& resolvConf = "/etc/resolv.conf", const std::string& hosts = "/etc/hosts");
+
+        void setNameServers(const std::vector<NameServer>& nameServers);
+        void setTimeout(const utils::Timeval& timeout);
+        void setAttempts(std::size_t attempts);
+
+        // Returns true if name needs a lookup over the network, onResolved is called once its answer is in the cache. Returns
+        // false if getaddrinfo() can be used right away
+        bool resolve(const std::string& name, int family, const std::function<void()>& onResolved);
+
+        // The cached answer for name, nullptr if there is none or it has expired
+        const Entry* lookup(const std::string& name, int family);
+
+        void flush();
+
+        Stats getStats() const;
+
+    private:
+        Resolver() = default;
+
+        using Key = std::pair<std::string, int>;
+
+        struct Lookup {
+            std::vector<std::function<void()>> onResolved;
+            std::size_t attempt = 0;
+            bool tcp = false;
+        };
+
+        void ensureConfigured();
+
+        bool query(const Key& key);
+        void queryDone(const Key& key, int errnum, const Message& message);
+        void complete(const Key& key, Entry entry);
+
+        std::vector<std::pair<sockaddr_storage, socklen_t>> nameServers;
+        std::set<std::string> hostNames;
+        utils::Timeval timeout{5, 0};
+        std::size_t attempts = 2;
+        bool configured = false;
+
+        std::map<Key, Entry> cache;
+        std::map<Key, Lookup> lookups;
+
+        Stats stats;
+    };
+
+} // namespace net::dns
+
+#endif // NET_DNS_RESOLVER_H
@@ -50,6 +50,7 @@
 #ifndef DOXYGEN_SHOULD_SKIP_THIS
 
 #include "core/system/netdb.h"
+#include "net/dns/Resolver.h"
 #include "utils/PreserveErrno.h"
 
 #include <limits>
@@ -174,6 +175,18 @@ namespace net::in::config {
         return socketAddress;
     }
 
+    template <template <typename SocketAddress> typename ConfigAddressType>
+    bool ConfigAddress<ConfigAddressType>::resolve(const std::function<void()>& onResolved) {
+        const bool pending =
+            !numericOpt->as<bool>() && net::dns::Resolver::instance().resolve(hostOpt->as<std::string>(), AF_INET, onResolved);
+
+        if (pending) {
+            Super::renew();
+        }
+
+        return pending;
+    }
+
     template <template <typename SocketAddress> typename ConfigAddressType>
     ConfigAddress<ConfigAddressType>* ConfigAddress<ConfigAddressType>::setSocketAddress(const SocketAddress& socketAddress) {
         setHost(socketAddress.getHost());
@@ -101,6 +101,8 @@ namespace net::in::config {
         using Super::getSocketAddress;
         SocketAddress getSocketAddress(const SocketAddress::SockAddr& sockAddr, SocketAddress::SockLen sockAddrLen);
 
+        bool resolve(const std::function<void()>& onResolved) final;
+
         ConfigAddress* setSocketAddress(const SocketAddress& socketAddress);
 
         ConfigAddress* setHost(const std::string& ipOrHostname);
@@ -0,0 +1,153 @@
+/*
+ * SNode.C - A Slim Toolkit for Network Communication
+ * Copyright (C) Volker Christian <me@vchrist.at>
+ *               2020, 2021, 2022, 2023, 2024, 2025, 2026
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "net/in/dgram/config/ConfigSocketServer.h"
+
+#include "net/config/dgram/ConfigSocketServer.hpp"
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+
+#include "core/system/netdb.h"
+
+#include <netinet/in.h>
+#include <netinet/udp.h>
+
+#endif /* DOXYGEN_SHOULD_SKIP_THIS */
+
+#define XSTR(s) STR(s)
+#define STR(s) #s
+
+namespace net::in::dgram::config {
+
+    ConfigSocketServer::ConfigSocketServer(const std::string& name)
+        : net::config::dgram::ConfigSocketServer<net::in::config::ConfigAddress>(name) {
+        Local::setPortRequired();
+        Local::setAiFlags(AI_PASSIVE);
+        Local::setAiSockType(SOCK_DGRAM);
+        Local::setAiProtocol(IPPROTO_UDP);
+
+        reuseAddressOpt = net::config::ConfigPhysicalSocket::addSocketOption( //
+            "--reuse-address{true}",
+            SOL_SOCKET,
+            SO_REUSEADDR,
+            "Reuse socket address",
+            "BOOL",
+            XSTR(IN_DGRAM_REUSE_ADDRESS),
+            CLI::IsMember({"true", "false"}));
+
+        reusePortOpt = net::config::ConfigPhysicalSocket::addSocketOption( //
+            "--reuse-port{true}",
+            SOL_SOCKET,
+            SO_REUSEPORT,
+            "Reuse port number",
+            "BOOL",
+            XSTR(IN_DGRAM_REUSE_PORT),
+            CLI::IsMember({"true", "false"}));
+
+        groOpt = net::config::ConfigPhysicalSocket::addSocketOption( //
+            "--gro{true}",
+            IPPROTO_UDP,
+            UDP_GRO,
+            "Receive coalesced datagrams (UDP_GRO)",
+            "BOOL",
+            XSTR(IN_DGRAM_GRO),
+            CLI::IsMember({"true", "false"}));
+
+        gsoOpt = Socket::addFlag( //
+            "--gso{true}",
+            "Send equally sized datagrams as one segmented message (UDP_SEGMENT)",
+            "BOOL",
+            XSTR(IN_DGRAM_GSO),
+            CLI::IsMember({"true", "false"}));
+    }
+
+    ConfigSocketServer::~ConfigSocketServer() {
+    }
+
+    ConfigSocketServer* ConfigSocketServer::setReuseAddress(bool reuseAddress) {
+        addSocketOption(SOL_SOCKET, SO_REUSEADDR, reuseAddress ? 1 : 0);
+
+        Local::setDefaultValue(reuseAddressOpt, reuseAddress ? "true" : "false");
+
+        return this;
+    }
+
+    bool ConfigSocketServer::getReuseAddress() const {
+        return reuseAddressOpt->as<bool>();
+    }
+
+    ConfigSocketServer* ConfigSocketServer::setReusePort(bool reusePort) {
+        addSocketOption(SOL_SOCKET, SO_REUSEPORT, reusePort ? 1 : 0);
+
+        Local::setDefaultValue(reusePortOpt, reusePort ? "true" : "false");
+
+        return this;
+    }
+
+    bool ConfigSocketServer::getReusePort() const {
+        return reusePortOpt->as<bool>();
+    }
+
+    ConfigSocketServer* ConfigSocketServer::setGro(bool gro) {
+        addSocketOption(IPPROTO_UDP, UDP_GRO, gro ? 1 : 0);
+
+        Local::setDefaultValue(groOpt, gro ? "true" : "false");
+
+        return this;
+    }
+
+    bool ConfigSocketServer::getGro() const {
+        return groOpt->as<bool>();
+    }
+
+    ConfigSocketServer* ConfigSocketServer::setGso(bool gso) {
+        Local::setDefaultValue(gsoOpt, gso ? "true" : "false");
+
+        return this;
+    }
+
+    bool ConfigSocketServer::getGso() const {
+        return gsoOpt->as<bool>();
+    }
+
+} // namespace net::in::dgram::config
+
+template class net::config::dgram::ConfigSocketServer<net::in::config::ConfigAddress>;
@@ -127,7 +127,18 @@ namespace net::in::stream::config {
     }
 
     bool ConfigSocketServer::getReusePort() const {
-        return reusePortOpt->as<bool>();
+        // The flag is applied to the socket options on parse and by setReusePort() - they hold the effective setting
+        const auto& socketOptions = getSocketOptions();
+
+        const auto solSocketOptions = socketOptions.find(SOL_SOCKET);
+        if (solSocketOptions != socketOptions.end()) {
+            const auto reusePortOption = solSocketOptions->second.find(SO_REUSEPORT);
+            if (reusePortOption != solSocketOptions->second.end()) {
+                return *static_cast<const int*>(reusePortOption->second.getOptValue()) != 0;
+            }
+        }
+
+        return false;
     }
 
     ConfigSocketServer* ConfigSocketServer::setDisableNagleAlgorithm(bool disableNagleAlgorithm) {
@@ -46,6 +46,7 @@
 #include "log/LogScopeOwner.h"
 #include "log/Logger.h"
 
+#include <cstdint>
 #include <cstring>
 #include <netinet/in.h>
 #include <sstream>
@@ -68,13 +69,55 @@ namespace net::in6 {
 
         int aiErrCode = 0;
 
-        if ((aiErrCode = core::system::getaddrinfo(node.c_str(), service.c_str(), &hints, &addrInfo)) == 0) {
+        const net::dns::Resolver::Entry* entry = (hints.ai_flags & (AI_NUMERICHOST | AI_V4MAPPED)) == 0
+                                                     ? net::dns::Resolver::instance().lookup(node, AF_INET6)
+                                                     : nullptr;
+
+        if (entry != nullptr) {
+            aiErrCode = entry->aiErrCode == 0 ? useCached(*entry, service, hints) : entry->aiErrCode;
+        } else if ((aiErrCode = core::system::getaddrinfo(node.c_str(), service.c_str(), &hints, &addrInfo)) == 0) {
             currentAddrInfo = addrInfo;
         }
 
         return aiErrCode;
     }
 
+    int SocketAddrInfo::useCached(const net::dns::Resolver::Entry& entry, const std::string& service, const addrinfo& hints) {
+        const uint16_t port = htons(static_cast<uint16_t>(std::stoul(service)));
+
+        cachedSockAddrs.clear();
+        for (const auto& address : entry.addresses6) {
+            sockaddr_in6 sockAddr{};
+            sockAddr.sin6_family = AF_INET6;
+            sockAddr.sin6_port = port;
+            sockAddr.sin6_addr = address;
+
+            cachedSockAddrs.push_back(sockAddr);
+        }
+
+        cachedCanonName = entry.canonName;
+        cachedAddrInfos.assign(cachedSockAddrs.size(), addrinfo{});
+
+        for (std::size_t i = 0; i < cachedAddrInfos.size(); i++) {
+            cachedAddrInfos[i] = addrinfo{.ai_flags = hints.ai_flags,
+                                          .ai_family = AF_INET6,
+                                          .ai_socktype = hints.ai_socktype,
+                                          .ai_protocol = hints.ai_protocol,
+                                          .ai_addrlen = sizeof(sockaddr_in6),
+                                          .ai_addr = reinterpret_cast<sockaddr*>(&cachedSockAddrs[i]),
+                                          .ai_canonname = nullptr,
+                                          .ai_next = i + 1 < cachedAddrInfos.size() ? &cachedAddrInfos[i + 1] : nullptr};
+        }
+
+        if (!cachedAddrInfos.empty() && (hints.ai_flags & AI_CANONNAME) != 0) {
+            cachedAddrInfos.front().ai_canonname = cachedCanonName.data();
+        }
+
+        currentAddrInfo = cachedAddrInfos.empty() ? nullptr : cachedAddrInfos.data();
+
+        return currentAddrInfo != nullptr ? 0 : EAI_NONAME;
+    }
+
     bool SocketAddrInfo::useNext() {
         if (currentAddrInfo != nullptr) {
             currentAddrInfo = currentAddrInfo->ai_next;
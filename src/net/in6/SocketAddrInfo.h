@@ -47,8 +47,10 @@ struct sockaddr_in6;
 #ifndef DOXYGEN_SHOULD_SKIP_THIS
 
 #include "core/system/netdb.h" // IWYU pragma: export
+#include "net/dns/Resolver.h"
 
 #include <string>
+#include <vector>
 
 #endif /* DOXYGEN_SHOULD_SKIP_THIS */
 
@@ -69,8 +71,15 @@ namespace net::in6 {
         void logAddressInfo();
 
     private:
+        int useCached(const net::dns::Resolver::Entry& entry, const std::string& service, const addrinfo& hints);
+
         struct addrinfo* addrInfo = nullptr;
         struct addrinfo* currentAddrInfo = nullptr;
+
+        // Answers taken from the resolver cache are not allocated by getaddrinfo
+        std::vector<sockaddr_in6> cachedSockAddrs;
+        std::vector<addrinfo> cachedAddrInfos;
+        std::string cachedCanonName;
     };
 
 } // namespace net::in6
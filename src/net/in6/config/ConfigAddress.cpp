@@ -50,6 +50,7 @@
 #ifndef DOXYGEN_SHOULD_SKIP_THIS
 
 #include "core/system/netdb.h"
+#include "net/dns/Resolver.h"
 #include "utils/PreserveErrno.h"
 
 #include <limits>
@@ -181,6 +182,19 @@ namespace net::in6::config {
         return socketAddress;
     }
 
+    template <template <typename SocketAddress> typename ConfigAddressType>
+    bool ConfigAddress<ConfigAddressType>::resolve(const std::function<void()>& onResolved) {
+        // The resolver asks for AAAA records only, IPv4-mapped answers are left to getaddrinfo()
+        const bool pending = !numericOpt->as<bool>() && !ipv4MappedOpt->as<bool>() &&
+                             net::dns::Resolver::instance().resolve(hostOpt->as<std::string>(), AF_INET6, onResolved);
+
+        if (pending) {
+            Super::renew();
+        }
+
+        return pending;
+    }
+
     template <template <typename SocketAddress> typename ConfigAddressType>
     ConfigAddress<ConfigAddressType>* ConfigAddress<ConfigAddressType>::setSocketAddress(const SocketAddress& socketAddress) {
         setHost(socketAddress.getHost());
@@ -0,0 +1,87 @@
+/*
+ * SNode.C - A Slim Toolkit for Network Communication
+ * Copyright (C) Volker Christian <me@vchrist.at>
+ *               2020, 2021, 2022, 2023, 2024, 2025, 2026
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef NET_IN6_DGRAM_CONFIG_CONFIGSOCKETSERVER_H
+#define NET_IN6_DGRAM_CONFIG_CONFIGSOCKETSERVER_H
+
+#include "net/config/dgram/ConfigSocketServer.h" // IWYU pragma: export
+#include "net/in6/config/ConfigAddress.h"        // IWYU pragma: export
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+
+#include <string>
+
+#endif /* DOXYGEN_SHOULD_SKIP_THIS */
+
+namespace net::in6::dgram::config {
+
+    class ConfigSocketServer final : public net::config::dgram::ConfigSocketServer<net::in6::config::ConfigAddress> {
+    public:
+        explicit ConfigSocketServer(const std::string& name);
+
+        ~ConfigSocketServer() override;
+
+        ConfigSocketServer* setReuseAddress(bool reuseAddress = true);
+        bool getReuseAddress() const;
+
+        ConfigSocketServer* setReusePort(bool reusePort = true);
+        bool getReusePort() const;
+
+        // Receive datagrams of one flow coalesced by the kernel (UDP_GRO)
+        ConfigSocketServer* setGro(bool gro = true);
+        bool getGro() const;
+
+        // Send equally sized datagrams to one peer as a single UDP_SEGMENT message
+        ConfigSocketServer* setGso(bool gso = true);
+        bool getGso() const;
+
+    private:
+        CLI::Option* reuseAddressOpt = nullptr;
+        CLI::Option* reusePortOpt = nullptr;
+        CLI::Option* groOpt = nullptr;
+        CLI::Option* gsoOpt = nullptr;
+    };
+
+} // namespace net::in6::dgram::config
+
+extern template class net::config::dgram::ConfigSocketServer<net::in6::config::ConfigAddress>;
+
+#endif // NET_IN6_DGRAM_CONFIG_CONFIGSOCKETSERVER_H
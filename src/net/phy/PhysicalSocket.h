@@ -87,6 +87,12 @@ namespace net::phy {
 
         int bind(SocketAddress& configuredAddress);
 
+        // Takes over an already bound socket, e.g. one inherited from another process
+        int adopt(int fd, Flags flags);
+
+        // The bound address is served by another process from now on. Nothing to release for most families
+        void disown();
+
         bool isValid() const;
 
         int getSockError(int& cErrno) const;
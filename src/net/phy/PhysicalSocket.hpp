@@ -43,6 +43,7 @@
 
 #ifndef DOXYGEN_SHOULD_SKIP_THIS
 
+#include <fcntl.h>
 #include <map>
 #include <utility>
 
@@ -124,6 +125,40 @@ namespace net::phy {
         return ret;
     }
 
+    template <typename SocketAddress>
+    int PhysicalSocket<SocketAddress>::adopt(int fd, Flags flags) {
+        Super::operator=(fd);
+
+        int ret = 0;
+
+        if ((flags & NONBLOCK) != 0) {
+            const int fileFlags = ::fcntl(fd, F_GETFL);
+            ret = fileFlags < 0 ? fileFlags : ::fcntl(fd, F_SETFL, fileFlags | O_NONBLOCK);
+        }
+
+        if (ret == 0) {
+            typename SocketAddress::SockAddr boundSockAddr = {};
+            typename SocketAddress::SockLen boundSockAddrLen = sizeof(boundSockAddr);
+
+            ret = getSockName(boundSockAddr, boundSockAddrLen);
+
+            if (ret == 0) {
+                try {
+                    this->bindAddress = SocketAddress(boundSockAddr, boundSockAddrLen);
+                } catch (const typename SocketAddress::BadSocketAddress&) {
+                    errno = EAFNOSUPPORT;
+                    ret = -1;
+                }
+            }
+        }
+
+        return ret;
+    }
+
+    template <typename SocketAddress>
+    void PhysicalSocket<SocketAddress>::disown() {
+    }
+
     template <typename SocketAddress>
     bool PhysicalSocket<SocketAddress>::isValid() const {
         return core::Descriptor::getFd() >= 0;
@@ -60,6 +60,8 @@ namespace net::phy::dgram {
         using Super = net::phy::PhysicalSocket<SocketAddressT>;
         using SocketAddress = SocketAddressT;
         using Super::Super;
+
+        int connect(SocketAddress& remoteAddress);
     };
 
 } // namespace net::phy::dgram
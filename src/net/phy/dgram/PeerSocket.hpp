@@ -41,8 +41,17 @@
 
 #include "net/phy/dgram/PeerSocket.h"
 
+#include "core/system/socket.h"
+
 #ifndef DOXYGEN_SHOULD_SKIP_THIS
 
 #endif /* DOXYGEN_SHOULD_SKIP_THIS */
 
-namespace net::phy::dgram {} // namespace net::phy::dgram
+namespace net::phy::dgram {
+
+    template <typename SocketAddress>
+    int PeerSocket<SocketAddress>::connect(SocketAddress& remoteAddress) {
+        return core::system::connect(Super::getFd(), &remoteAddress.getSockAddr(), remoteAddress.getSockAddrLen());
+    }
+
+} // namespace net::phy::dgram
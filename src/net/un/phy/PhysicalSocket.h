@@ -71,6 +71,8 @@ namespace net::un::phy {
 
         int bind(SocketAddress& bindAddress);
 
+        void disown();
+
         logger::BoundaryLogger log() const;
         logger::BoundaryLogger log(logger::BoundaryLogger::Sink sink,
                                    logger::LogLevel threshold = logger::LogLevel::Trace,
@@ -256,6 +256,14 @@ namespace net::un::phy {
         lockPath.clear();
     }
 
+    template <template <typename SocketAddress> typename PhysicalPeerSocket>
+    void PhysicalSocket<PhysicalPeerSocket>::disown() {
+        // The successor listens on the sun path now: neither it nor the lock file may be removed on close
+        socketIdentityValid = false;
+        socketPath.clear();
+        lockCleanupOwned = false;
+    }
+
     template <template <typename SocketAddress> typename PhysicalPeerSocket>
     logger::BoundaryLogger PhysicalSocket<PhysicalPeerSocket>::log() const {
         return logScope.logger(logger::Logger::semanticSink());
@@ -0,0 +1,259 @@
+/*
+ * SNode.C - A Slim Toolkit for Network Communication
+ * Copyright (C) Volker Christian <me@vchrist.at>
+ *               2020, 2021, 2022, 2023, 2024, 2025, 2026
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "net/un/stream/HandOff.h"
+
+#include "core/eventreceiver/AcceptEventReceiver.h"
+#include "core/socket/ListenerRegistry.h"
+#include "net/un/SocketAddress.h"
+#include "net/un/phy/stream/PhysicalSocketServer.h"
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+
+#include "core/system/socket.h"
+#include "core/system/unistd.h"
+#include "log/LogScopeOwner.h"
+#include "log/Logger.h"
+
+#include <cerrno>
+#include <cstring>
+#include <sstream>
+#include <vector>
+
+#endif // DOXYGEN_SHOULD_SKIP_THIS
+
+namespace net::un::stream {
+
+    namespace {
+        constexpr std::size_t maxFds = 253; // SCM_MAX_FD
+
+        logger::BoundaryLogger handOffLog() {
+            static const logger::LogScopeOwner scope(logger::LogOrigin::Framework, logger::LogBoundary::System, "net.un.handoff");
+            return scope.logger(logger::Logger::semanticSink());
+        }
+
+        // Names, each terminated by a newline, as payload and the descriptors in the same order as SCM_RIGHTS
+        bool sendListeners(int fd, const std::vector<core::socket::ListenerRegistry::Listener>& listeners) {
+            std::string names;
+            std::vector<int> fds;
+
+            for (const core::socket::ListenerRegistry::Listener& listener : listeners) {
+                names += listener.name + "\n";
+                fds.push_back(listener.fd);
+            }
+
+            std::vector<char> control(CMSG_SPACE(sizeof(int) * fds.size()));
+
+            iovec iov{names.data(), names.size()};
+            msghdr message{};
+            message.msg_iov = &iov;
+            message.msg_iovlen = 1;
+            message.msg_control = control.data();
+            message.msg_controllen = control.size();
+
+            cmsghdr* cmsg = CMSG_FIRSTHDR(&message);
+            cmsg->cmsg_level = SOL_SOCKET;
+            cmsg->cmsg_type = SCM_RIGHTS;
+            cmsg->cmsg_len = CMSG_LEN(sizeof(int) * fds.size());
+            std::memcpy(CMSG_DATA(cmsg), fds.data(), sizeof(int) * fds.size());
+
+            ssize_t sent = core::system::sendmsg(fd, &message, MSG_NOSIGNAL);
+
+            // Only the first chunk carries the descriptors
+            for (std::size_t offset = sent > 0 ? static_cast<std::size_t>(sent) : 0; sent > 0 && offset < names.size();) {
+                sent = core::system::send(fd, names.data() + offset, names.size() - offset, MSG_NOSIGNAL);
+                offset += sent > 0 ? static_cast<std::size_t>(sent) : 0;
+            }
+
+            return sent > 0;
+        }
+
+        // The sun path has to fit into sockaddr_un
+        bool initAddress(net::un::SocketAddress& address) {
+            bool valid = true;
+
+            try {
+                address.init();
+            } catch (const core::socket::SocketAddress::BadSocketAddress&) {
+                errno = ENAMETOOLONG;
+                valid = false;
+            }
+
+            return valid;
+        }
+
+        class HandOffAcceptor : public core::eventreceiver::AcceptEventReceiver {
+        public:
+            HandOffAcceptor(const std::string& sunPath, const std::function<void(std::size_t)>& onHandedOver)
+                : core::eventreceiver::AcceptEventReceiver("HandOff " + sunPath, TIMEOUT::DISABLE)
+                , onHandedOver(onHandedOver) {
+                net::un::SocketAddress address(sunPath);
+
+                if (!initAddress(address)) {
+                    handOffLog().sysError(logger::LogLevel::Error, errno, "address {}", sunPath);
+                } else if (physicalServerSocket.open({}, PhysicalServerSocket::Flags::NONBLOCK) < 0) {
+                    handOffLog().sysError(logger::LogLevel::Error, errno, "open {}", sunPath);
+                } else if (physicalServerSocket.bind(address) < 0) {
+                    handOffLog().sysError(logger::LogLevel::Error, errno, "bind {}", sunPath);
+                } else if (physicalServerSocket.listen(1) < 0) {
+                    handOffLog().sysError(logger::LogLevel::Error, errno, "listen {}", sunPath);
+                } else if (enable(physicalServerSocket.getFd())) {
+                    handOffLog().info("Waiting for a successor at {}", sunPath);
+                }
+            }
+
+            ~HandOffAcceptor() override = default;
+
+        private:
+            using PhysicalServerSocket = net::un::phy::stream::PhysicalSocketServer;
+
+            void acceptEvent() override {
+                const int fd = physicalServerSocket.accept4(0);
+
+                if (fd >= 0) {
+                    std::vector<core::socket::ListenerRegistry::Listener> listeners =
+                        core::socket::ListenerRegistry::instance().getListeners();
+
+                    if (listeners.size() > maxFds) {
+                        handOffLog().warn("Only {} of {} listeners can be handed over", maxFds, listeners.size());
+                        listeners.resize(maxFds);
+                    }
+
+                    if (listeners.empty() || sendListeners(fd, listeners)) {
+                        handOffLog().info("{} listener(s) handed over", listeners.size());
+
+                        core::socket::ListenerRegistry::instance().handedOver();
+
+                        if (onHandedOver) {
+                            onHandedOver(listeners.size());
+                        }
+
+                        stopListen();
+                    } else {
+                        handOffLog().sysError(logger::LogLevel::Error, errno, "Handing over listeners");
+                    }
+
+                    core::system::close(fd);
+                }
+            }
+
+            void unobservedEvent() override {
+                delete this;
+            }
+
+            PhysicalServerSocket physicalServerSocket;
+            std::function<void(std::size_t)> onHandedOver;
+        };
+    } // namespace
+
+    bool HandOff::offer(const std::string& sunPath, const std::function<void(std::size_t)>& onHandedOver) {
+        HandOffAcceptor* handOffAcceptor = new HandOffAcceptor(sunPath, onHandedOver);
+
+        const bool waiting = handOffAcceptor->isEnabled();
+        if (!waiting) {
+            delete handOffAcceptor;
+        }
+
+        return waiting;
+    }
+
+    std::size_t HandOff::receive(const std::string& sunPath, const utils::Timeval& timeout) {
+        std::size_t received = 0;
+
+        net::un::SocketAddress address(sunPath);
+        const int fd = core::system::socket(PF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+
+        if (fd < 0) {
+            handOffLog().sysError(logger::LogLevel::Error, errno, "socket");
+        } else if (!initAddress(address) || core::system::setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeval)) < 0 ||
+                   core::system::connect(fd, &address.getSockAddr(), address.getSockAddrLen()) < 0) {
+            handOffLog().sysError(logger::LogLevel::Error, errno, "Connecting to predecessor at {}", sunPath);
+        } else {
+            std::vector<char> buffer(4096);
+            std::vector<char> control(CMSG_SPACE(sizeof(int) * maxFds));
+
+            iovec iov{buffer.data(), buffer.size()};
+            msghdr message{};
+            message.msg_iov = &iov;
+            message.msg_iovlen = 1;
+            message.msg_control = control.data();
+            message.msg_controllen = control.size();
+
+            ssize_t ret = core::system::recvmsg(fd, &message, MSG_CMSG_CLOEXEC);
+
+            std::vector<int> fds;
+            for (cmsghdr* cmsg = CMSG_FIRSTHDR(&message); ret > 0 && cmsg != nullptr; cmsg = CMSG_NXTHDR(&message, cmsg)) {
+                if (cmsg->cmsg_level == SOL_SOCKET && cmsg->cmsg_type == SCM_RIGHTS) {
+                    fds.resize((cmsg->cmsg_len - CMSG_LEN(0)) / sizeof(int));
+                    std::memcpy(fds.data(), CMSG_DATA(cmsg), sizeof(int) * fds.size());
+                }
+            }
+
+            std::string names;
+            while (ret > 0) {
+                names.append(buffer.data(), static_cast<std::size_t>(ret));
+                ret = core::system::recv(fd, buffer.data(), buffer.size(), 0);
+            }
+
+            if (ret < 0) {
+                handOffLog().sysError(logger::LogLevel::Error, errno, "Receiving listeners from {}", sunPath);
+            }
+
+            std::istringstream nameStream(names);
+            for (const int listenerFd : fds) {
+                std::string name;
+                std::getline(nameStream, name);
+
+                core::socket::ListenerRegistry::instance().inherit(listenerFd, name);
+                received++;
+            }
+
+            handOffLog().info("{} listener(s) received from {}", received, sunPath);
+        }
+
+        if (fd >= 0) {
+            core::system::close(fd);
+        }
+
+        return received;
+    }
+
+} // namespace net::un::stream
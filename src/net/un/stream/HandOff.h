@@ -0,0 +1,74 @@
+/*
+ * SNode.C - A Slim Toolkit for Network Communication
+ * Copyright (C) Volker Christian <me@vchrist.at>
+ *               2020, 2021, 2022, 2023, 2024, 2025, 2026
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef NET_UN_STREAM_HANDOFF_H
+#define NET_UN_STREAM_HANDOFF_H
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+
+#include "utils/Timeval.h"
+
+#include <cstddef>
+#include <functional>
+#include <string>
+
+#endif // DOXYGEN_SHOULD_SKIP_THIS
+
+namespace net::un::stream {
+
+    // Zero-downtime restarts: the running process passes its listening sockets to its successor over a unix domain socket
+    // (SCM_RIGHTS). Connections waiting in the accept queues are served by the successor, established ones stay with the
+    // predecessor until they close.
+    class HandOff {
+    public:
+        HandOff() = delete;
+
+        // Predecessor: waits at sunPath for the successor, sends it every running listener and stops accepting
+        static bool offer(const std::string& sunPath, const std::function<void(std::size_t)>& onHandedOver = nullptr);
+
+        // Successor: blocks until the listeners are received. Call it after SNodeC::init() and before the servers listen, each
+        // SocketServer then adopts the listener of the same instance name or bound address instead of binding a new one
+        static std::size_t receive(const std::string& sunPath, const utils::Timeval& timeout = {5, 0});
+    };
+
+} // namespace net::un::stream
+
+#endif // NET_UN_STREAM_HANDOFF_H
@@ -608,6 +608,14 @@ namespace utils {
         verboseLevelOpt = setConfigurable(
             addOption("--verbose-level", "Legacy verbose level (0..10; no semantic-log effect)", "level", 2, CLI::Range(0, 10)), true);
 
+        eventLoopsOpt = setConfigurable(
+            addOption("--event-loops", "Number of event loops (one thread each; SO_REUSEPORT listeners are sharded)", "count", 1, CLI::Range(1, 1024)),
+            true);
+
+        workerThreadsOpt = setConfigurable(
+            addOption("--worker-threads", "Number of worker threads running blocking work offloaded by the event loops", "count", 2, CLI::Range(1, 1024)),
+            true);
+
         logFormatOpt = setConfigurable(addOption("--log-format",
                                                  "Semantic log format",
                                                  "text|json",
@@ -1093,6 +1101,14 @@ namespace utils {
         return configRoot.verboseLevelOpt->as<int>();
     }
 
+    int Config::getEventLoops() {
+        return configRoot.eventLoopsOpt->as<int>();
+    }
+
+    int Config::getWorkerThreads() {
+        return configRoot.workerThreadsOpt->as<int>();
+    }
+
     int Config::argc = 0;
     char** Config::argv = nullptr;
 
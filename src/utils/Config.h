@@ -105,6 +105,8 @@ namespace utils {
         CLI::Option* enforceLogFileOpt = nullptr;
         CLI::Option* logLevelOpt = nullptr;
         CLI::Option* verboseLevelOpt = nullptr;
+        CLI::Option* eventLoopsOpt = nullptr;
+        CLI::Option* workerThreadsOpt = nullptr;
         CLI::Option* logFormatOpt = nullptr;
         CLI::Option* logOriginLevelOpt = nullptr;
         CLI::Option* logBoundaryLevelOpt = nullptr;
@@ -135,6 +137,8 @@ namespace utils {
         static const std::string& getApplicationName();
         static int getLogLevel();
         static int getVerboseLevel();
+        static int getEventLoops();
+        static int getWorkerThreads();
 
         static ConfigRoot configRoot;
 
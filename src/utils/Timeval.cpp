@@ -74,10 +74,16 @@ namespace utils {
     }
 
     Timeval Timeval::currentTime() {
-        utils::Timeval currentTime;
-        utils::system::gettimeofday(&currentTime, nullptr);
+#ifdef SNODEC_COARSE_MONOTONIC_CLOCK
+        constexpr clockid_t clockId = CLOCK_MONOTONIC_COARSE;
+#else
+        constexpr clockid_t clockId = CLOCK_MONOTONIC;
+#endif
 
-        return currentTime;
+        timespec now{};
+        utils::system::clock_gettime(clockId, &now);
+
+        return utils::Timeval({now.tv_sec, now.tv_nsec / 1000});
     }
 
     Timeval& Timeval::operator=(const Timeval& timeVal) { // NOLINT
@@ -63,6 +63,7 @@ namespace utils {
         Timeval(double time) noexcept;            // cppcheck-suppress noExplicitConstructor
         Timeval(const timeval& timeVal) noexcept; // cppcheck-suppress noExplicitConstructor
 
+        // Monotonic, not a date: use utils::system::time() where wall-clock time is needed
         static Timeval currentTime();
 
         Timeval& operator=(const Timeval& timeVal);
@@ -54,6 +54,11 @@ namespace utils::system {
         return ::time(tloc);
     }
 
+    int clock_gettime(clockid_t clockid, struct timespec* tp) {
+        errno = 0;
+        return ::clock_gettime(clockid, tp);
+    }
+
     int gettimeofday(struct timeval* tv, struct timezone* tz) {
         errno = 0;
         return ::gettimeofday(tv, tz);
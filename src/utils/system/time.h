@@ -60,6 +60,8 @@ namespace utils::system {
     struct tm* gmtime(const time_t* timep);
     time_t mktime(struct tm* tm);
 
+    int clock_gettime(clockid_t clockid, struct timespec* tp);
+
     // #include <sys/time.h>
     int gettimeofday(struct timeval* tv, struct timezone* tz);
 
@@ -50,6 +50,7 @@
 
 #include "web/http/http_utils.h"
 
+#include <span>
 #include <tuple>
 #include <utility>
 
@@ -121,27 +122,23 @@ namespace web::http {
     }
 
     std::size_t Parser::readStartLine() {
-        std::size_t consumed = 0;
-        std::size_t ret = 0;
+        const std::span<const char> available = socketContext->peekFromPeer();
 
-        do {
-            char ch = 0;
-            ret = socketContext->readFromPeer(&ch, 1);
-
-            if (ret > 0) {
-                consumed += ret;
-                if (ch == '\r' || ch == '\n') {
-                    if (ch == '\n') {
-                        parseStartLine(line);
-                        line.clear();
-                    }
-                } else {
-                    line += ch;
+        std::size_t scanned = 0;
+        while (scanned < available.size() && parserState == ParserState::FIRSTLINE) {
+            const char ch = available[scanned++];
+
+            if (ch == '\r' || ch == '\n') {
+                if (ch == '\n') {
+                    parseStartLine(line);
+                    line.clear();
                 }
+            } else {
+                line += ch;
             }
-        } while (ret > 0 && parserState == ParserState::FIRSTLINE);
+        }
 
-        return consumed;
+        return socketContext->consumeFromPeer(scanned);
     }
 
     std::size_t Parser::readHeader() {
@@ -47,6 +47,7 @@
 #include <algorithm>
 #include <cctype>
 #include <limits>
+#include <span>
 #include <tuple>
 #include <stdexcept>
 
@@ -120,12 +121,12 @@ namespace web::http::decoder {
 
                 [[fallthrough]];
             case 0: // ChunklLenS
-                do {
-                    char ch = '\0';
+                {
+                    const std::span<const char> available = socketContext->peekFromPeer();
 
-                    ret = socketContext->readFromPeer(&ch, 1);
-                    if (ret > 0) {
-                        consumed++;
+                    std::size_t scanned = 0;
+                    while (!error && scanned < available.size() && !(CR && LF) && chunkLenTotalS.size() <= maxChunkLenTotalS) {
+                        const char ch = available[scanned++];
 
                         if (CR) {
                             if (ch == '\n') {
@@ -139,7 +140,9 @@ namespace web::http::decoder {
                             chunkLenTotalS += ch;
                         }
                     }
-                } while (!error && ret > 0 && !(CR && LF) && chunkLenTotalS.size() <= maxChunkLenTotalS);
+
+                    consumed += socketContext->consumeFromPeer(scanned);
+                }
 
                 if (!(CR && LF)) {
                     error = !error ? chunkLenTotalS.size() > maxChunkLenTotalS : error;
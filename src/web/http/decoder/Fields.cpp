@@ -48,6 +48,7 @@
 #include "web/http/http_utils.h"
 
 #include <cctype>
+#include <span>
 #include <utility>
 
 #endif // DOXYGEN_SHOULD_SKIP_THIS
@@ -77,53 +78,52 @@ namespace web::http::decoder {
             errorReason = "";
         }
 
-        std::size_t ret = 0;
-        do {
-            char ch = '\0';
+        const std::span<const char> available = socketContext->peekFromPeer();
 
-            ret = socketContext->readFromPeer(&ch, 1);
-            consumed += ret;
+        std::size_t scanned = 0;
+        while (scanned < available.size() && !completed && errorCode == 0) {
+            const char ch = available[scanned++];
 
-            if (ret > 0) {
-                if (!line.empty() || ch != ' ') {
-                    line += ch;
+            if (!line.empty() || ch != ' ') {
+                line += ch;
 
-                    if (maxLineLength == 0 || line.size() <= maxLineLength) {
-                        lastButOne = last;
-                        last = ch;
+                if (maxLineLength == 0 || line.size() <= maxLineLength) {
+                    lastButOne = last;
+                    last = ch;
 
-                        if (lastButOne == '\r' && last == '\n') {
-                            line.pop_back(); // Remove \n
-                            line.pop_back(); // Remove \r
+                    if (lastButOne == '\r' && last == '\n') {
+                        line.pop_back(); // Remove \n
+                        line.pop_back(); // Remove \r
 
-                            completed = line.empty();
-                            if (!completed) {
-                                splitLine(line);
+                        completed = line.empty();
+                        if (!completed) {
+                            splitLine(line);
 
-                                if (!fieldsExpected.empty() && fields.size() > fieldsExpected.size()) {
-                                    errorCode = 400;
-                                    errorReason = "Too many fields";
-                                }
-                            } else if (!fieldsExpected.empty() && fields.size() < fieldsExpected.size()) {
+                            if (!fieldsExpected.empty() && fields.size() > fieldsExpected.size()) {
                                 errorCode = 400;
-                                errorReason = "Too view fields";
-
-                                completed = false;
+                                errorReason = "Too many fields";
                             }
-                            line.clear();
-                            lastButOne = '\0';
-                            last = '\0';
+                        } else if (!fieldsExpected.empty() && fields.size() < fieldsExpected.size()) {
+                            errorCode = 400;
+                            errorReason = "Too view fields";
+
+                            completed = false;
                         }
-                    } else {
-                        errorCode = 431;
-                        errorReason = "Line too long: " + line;
+                        line.clear();
+                        lastButOne = '\0';
+                        last = '\0';
                     }
                 } else {
-                    errorCode = 400;
-                    errorReason = "Header Folding";
+                    errorCode = 431;
+                    errorReason = "Line too long: " + line;
                 }
+            } else {
+                errorCode = 400;
+                errorReason = "Header Folding";
             }
-        } while (ret > 0 && !completed && errorCode == 0);
+        }
+
+        consumed += socketContext->consumeFromPeer(scanned);
 
         return consumed;
     }
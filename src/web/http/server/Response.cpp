@@ -490,6 +490,30 @@ namespace web::http::server {
         sendFragment(chunk, chunkLen);
     }
 
+    bool Response::onSourceFile(const std::shared_ptr<const void>& owner, int fd, off_t offset, std::size_t len) {
+        bool accepted = true;
+
+        if (requestMethod != "HEAD" && isConnected()) {
+            accepted = socketContext->canSendFileToPeer();
+
+            if (accepted) {
+                if (transferEncoding == TransferEncoding::Chunked) {
+                    socketContext->sendToPeer(to_hex_str(len).append("\r\n"));
+                }
+
+                socketContext->sendFileToPeer(owner, fd, offset, len);
+                contentSent += len;
+
+                if (transferEncoding == TransferEncoding::Chunked || web::http::ciContains(headers["Content-Type"], "text/event-stream")) {
+                    socketContext->sendToPeer("\r\n");
+                    contentLength += len;
+                }
+            }
+        }
+
+        return accepted;
+    }
+
     void Response::onSourceEof() {
         if (isConnected()) {
             socketContext->streamEof();
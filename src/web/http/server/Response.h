@@ -61,6 +61,7 @@ namespace web::http::server {
 #include <map>
 #include <memory>
 #include <string>
+#include <sys/types.h>
 
 #endif /* DOXYGEN_SHOULD_SKIP_THIS */
 
@@ -110,6 +111,7 @@ namespace web::http::server {
 
         void onSourceConnect(core::pipe::Source* source) override;
         void onSourceData(const char* chunk, std::size_t chunkLen) override;
+        bool onSourceFile(const std::shared_ptr<const void>& owner, int fd, off_t offset, std::size_t len) override;
         void onSourceEof() override;
         void onSourceError(int errnum) override;
 
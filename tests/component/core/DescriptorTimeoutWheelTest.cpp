@@ -0,0 +1,161 @@
+/*
+ * SNode.C - A Slim Toolkit for Network Communication
+ * Copyright (C) Volker Christian <me@vchrist.at>
+ *               2020, 2021, 2022, 2023, 2024, 2025, 2026
+ *
+ * SPDX-License-Identifier: LGPL-3.0-or-later OR MIT
+ */
+
+#include "core/SNodeC.h"
+#include "core/eventreceiver/ReadEventReceiver.h"
+#include "core/pipe/Pipe.h"
+#include "core/system/unistd.h"
+#include "core/timer/Timer.h"
+#include "support/TestResult.h"
+#include "utils/Timeval.h"
+
+#include <chrono>
+#include <fcntl.h>
+#include <string>
+
+namespace {
+
+    using Clock = std::chrono::steady_clock;
+
+    struct Observation {
+        bool timedOut = false;
+        std::chrono::milliseconds elapsed{0};
+        int reads = 0;
+    };
+
+    class TimeoutReceiver final : public core::eventreceiver::ReadEventReceiver {
+    public:
+        TimeoutReceiver(const std::string& name,
+                        const utils::Timeval& timeout,
+                        int readFd,
+                        int writeFd,
+                        Clock::time_point startedAt,
+                        Observation& observation)
+            : core::eventreceiver::ReadEventReceiver(name, timeout)
+            , writeFd(writeFd)
+            , startedAt(startedAt)
+            , observation(observation) {
+            ReadEventReceiver::enable(readFd);
+        }
+
+        void poke() {
+            const char byte = 0;
+            static_cast<void>(core::system::write(writeFd, &byte, 1));
+        }
+
+        void changeTimeout(const utils::Timeval& timeout) {
+            setTimeout(timeout);
+        }
+
+    private:
+        ~TimeoutReceiver() override {
+            core::system::close(getRegisteredFd());
+            core::system::close(writeFd);
+        }
+
+        void readEvent() override {
+            char buffer[16];
+            if (core::system::read(getRegisteredFd(), buffer, sizeof(buffer)) > 0) {
+                observation.reads++;
+            }
+        }
+
+        void readTimeout() override {
+            observation.timedOut = true;
+            observation.elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(Clock::now() - startedAt);
+            ReadEventReceiver::readTimeout();
+        }
+
+        void unobservedEvent() override {
+            delete this;
+        }
+
+        int writeFd;
+        Clock::time_point startedAt;
+        Observation& observation;
+    };
+
+    TimeoutReceiver*
+    makeReceiver(const std::string& name, const utils::Timeval& timeout, Clock::time_point startedAt, Observation& observation) {
+        TimeoutReceiver* receiver = nullptr;
+
+        core::pipe::Pipe pipe(O_CLOEXEC | O_NONBLOCK);
+        if (pipe.hasReadFd() && pipe.hasWriteFd()) {
+            receiver = new TimeoutReceiver(name, timeout, pipe.releaseReadFd(), pipe.releaseWriteFd(), startedAt, observation);
+        }
+
+        return receiver;
+    }
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    tests::support::TestResult testResult;
+    int result = tests::support::cTestSkipReturnCode;
+
+    if (tests::support::shouldSkipRootWithoutSNodeCGroup()) {
+        tests::support::printRootWithoutSNodeCGroupSkipMessage("DescriptorTimeoutWheelTest");
+    } else {
+        char* snodeArguments[] = {argv[0], nullptr};
+        core::SNodeC::init(argc > 0 ? 1 : 0, snodeArguments);
+
+        const Clock::time_point startedAt = Clock::now();
+
+        Observation idleShort;
+        Observation idleLong;
+        Observation keptAlive;
+        Observation shortened;
+        Observation farAway;
+
+        makeReceiver("timeout wheel idle short", utils::Timeval({0, 50000}), startedAt, idleShort);
+        makeReceiver("timeout wheel idle long", utils::Timeval({0, 150000}), startedAt, idleLong);
+        TimeoutReceiver* keptAliveReceiver = makeReceiver("timeout wheel kept alive", utils::Timeval({0, 80000}), startedAt, keptAlive);
+        TimeoutReceiver* shortenedReceiver = makeReceiver("timeout wheel shortened", utils::Timeval({3, 0}), startedAt, shortened);
+        makeReceiver("timeout wheel far away", utils::Timeval({60, 0}), startedAt, farAway);
+
+        core::timer::Timer keepAliveTimer = core::timer::Timer::intervalTimer(
+            [keptAliveReceiver, &keptAlive]() {
+                if (!keptAlive.timedOut) {
+                    keptAliveReceiver->poke();
+                }
+            },
+            utils::Timeval({0, 20000}));
+
+        core::timer::Timer shortenTimer = core::timer::Timer::singleshotTimer(
+            [shortenedReceiver]() {
+                shortenedReceiver->changeTimeout(utils::Timeval({0, 60000}));
+            },
+            utils::Timeval({0, 30000}));
+
+        core::timer::Timer stopTimer = core::timer::Timer::singleshotTimer(
+            [&keepAliveTimer]() {
+                keepAliveTimer.cancel();
+                core::SNodeC::stop();
+            },
+            utils::Timeval({0, 400000}));
+
+        const int startResult = core::SNodeC::start(utils::Timeval({2, 0}));
+
+        testResult.expectEqual(0, startResult, "event loop stops cleanly");
+        testResult.expectTrue(idleShort.timedOut && idleShort.elapsed >= std::chrono::milliseconds(50),
+                              "idle receiver times out, never early");
+        testResult.expectTrue(idleLong.timedOut && idleLong.elapsed >= std::chrono::milliseconds(150),
+                              "longer idle receiver times out, never early");
+        testResult.expectTrue(idleShort.elapsed < idleLong.elapsed, "timeouts expire in deadline order");
+        testResult.expectTrue(!keptAlive.timedOut && keptAlive.reads > 0, "triggered receiver is re-armed and does not time out");
+        testResult.expectTrue(shortened.timedOut && shortened.elapsed >= std::chrono::milliseconds(90) &&
+                                  shortened.elapsed < std::chrono::milliseconds(1000),
+                              "shortened timeout is re-armed at its new deadline");
+        testResult.expectTrue(!farAway.timedOut, "far away timeout does not expire");
+
+        core::SNodeC::free();
+        result = testResult.processResult();
+    }
+
+    return result;
+}
@@ -0,0 +1,148 @@
+/*
+ * SNode.C - A Slim Toolkit for Network Communication
+ * Copyright (C) Volker Christian <me@vchrist.at>
+ *               2020, 2021, 2022, 2023, 2024, 2025, 2026
+ *
+ * SPDX-License-Identifier: LGPL-3.0-or-later OR MIT
+ */
+
+#include "core/EventLoop.h"
+#include "core/SNodeC.h"
+#include "core/file/FileReader.h"
+#include "core/pipe/Sink.h"
+#include "core/pipe/Source.h"
+#include "core/timer/Timer.h"
+#include "support/TestResult.h"
+#include "utils/Timeval.h"
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <unistd.h>
+
+#endif /* DOXYGEN_SHOULD_SKIP_THIS */
+
+namespace {
+
+    constexpr std::size_t jobCount = 8;
+    constexpr std::chrono::milliseconds jobDuration(50);
+
+    class CollectingSink : public core::pipe::Sink {
+    public:
+        std::string data;
+        bool eof = false;
+        int errnum = 0;
+
+    private:
+        void onSourceConnect(core::pipe::Source* source) override {
+            source->start();
+        }
+
+        void onSourceData(const char* chunk, std::size_t chunkLen) override {
+            data.append(chunk, chunkLen);
+        }
+
+        void onSourceEof() override {
+            eof = true;
+        }
+
+        void onSourceError(int errnum) override {
+            this->errnum = errnum;
+        }
+    };
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    tests::support::TestResult testResult;
+    int result = tests::support::cTestSkipReturnCode;
+
+    if (tests::support::shouldSkipRootWithoutSNodeCGroup()) {
+        tests::support::printRootWithoutSNodeCGroupSkipMessage("EventLoopOffloadTest");
+    } else {
+        char arg1[] = "--worker-threads=4";
+        char* snodeArguments[] = {argv[0], arg1, nullptr};
+        core::SNodeC::init(argc > 0 ? 2 : 0, snodeArguments);
+
+        const std::thread::id loopThreadId = std::this_thread::get_id();
+
+        std::atomic<std::size_t> jobsOnLoopThread = 0;
+        std::size_t continuationsOnForeignThread = 0;
+        std::size_t completed = 0;
+        int loopTicksWhileBlocked = 0;
+        std::chrono::steady_clock::duration offloadDuration{};
+
+        const std::string path = "/tmp/snodec-offload-test-" + std::to_string(::getpid());
+        std::string content;
+        for (std::size_t i = 0; content.size() < 200000; i++) {
+            content += std::to_string(i) + '\n';
+        }
+        std::ofstream(path, std::ios::binary) << content;
+
+        CollectingSink sink;
+
+        core::timer::Timer heartbeat = core::timer::Timer::intervalTimer(
+            [&loopTicksWhileBlocked]() {
+                loopTicksWhileBlocked++;
+            },
+            utils::Timeval({0, 5000}));
+
+        core::timer::Timer spawnTimer = core::timer::Timer::singleshotTimer(
+            [&]() {
+                const std::chrono::steady_clock::time_point startedAt = std::chrono::steady_clock::now();
+
+                for (std::size_t job = 0; job < jobCount; job++) {
+                    core::EventLoop::instance().offload(
+                        [&jobsOnLoopThread, loopThreadId]() {
+                            if (std::this_thread::get_id() == loopThreadId) {
+                                jobsOnLoopThread++;
+                            }
+                            std::this_thread::sleep_for(jobDuration);
+                        },
+                        [&, startedAt]() {
+                            if (std::this_thread::get_id() != loopThreadId) {
+                                continuationsOnForeignThread++;
+                            }
+
+                            if (++completed == jobCount) {
+                                offloadDuration = std::chrono::steady_clock::now() - startedAt;
+                                heartbeat.cancel();
+                            }
+                        });
+                }
+
+                core::file::FileReader::open(path, []([[maybe_unused]] int fd) {
+                })->pipe(&sink);
+            },
+            utils::Timeval({0, 1000}));
+
+        const int startResult = core::SNodeC::start(utils::Timeval({2, 0}));
+
+        ::unlink(path.c_str());
+
+        std::printf("EventLoopOffloadTest: %zu jobs of %lld ms offloaded in %lld ms, %d heartbeats meanwhile\n",
+                    jobCount,
+                    static_cast<long long>(jobDuration.count()),
+                    static_cast<long long>(std::chrono::duration_cast<std::chrono::milliseconds>(offloadDuration).count()),
+                    loopTicksWhileBlocked);
+
+        testResult.expectEqual(0, startResult, "loop ends without observers once every continuation has run");
+        testResult.expectTrue(completed == jobCount, "every continuation runs exactly once");
+        testResult.expectTrue(jobsOnLoopThread == 0, "jobs run on worker threads");
+        testResult.expectTrue(continuationsOnForeignThread == 0, "continuations run on the event loop thread");
+        testResult.expectTrue(offloadDuration < jobDuration * jobCount, "jobs run in parallel on the configured workers");
+        testResult.expectTrue(loopTicksWhileBlocked >= 5, "the event loop keeps dispatching while jobs block");
+        testResult.expectTrue(sink.eof && sink.errnum == 0 && sink.data == content, "FileReader streams a file through the pool");
+
+        core::SNodeC::free();
+        result = testResult.processResult();
+    }
+
+    return result;
+}
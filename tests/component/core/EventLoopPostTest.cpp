@@ -0,0 +1,146 @@
+/*
+ * SNode.C - A Slim Toolkit for Network Communication
+ * Copyright (C) Volker Christian <me@vchrist.at>
+ *               2020, 2021, 2022, 2023, 2024, 2025, 2026
+ *
+ * SPDX-License-Identifier: LGPL-3.0-or-later OR MIT
+ */
+
+#include "core/EventLoop.h"
+#include "core/EventMultiplexer.h"
+#include "core/PostQueue.h"
+#include "core/SNodeC.h"
+#include "core/timer/Timer.h"
+#include "support/TestResult.h"
+#include "utils/Timeval.h"
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+#include <string>
+#include <thread>
+#include <vector>
+
+#endif /* DOXYGEN_SHOULD_SKIP_THIS */
+
+namespace {
+
+    constexpr std::size_t producerCount = 4;
+    constexpr std::size_t postsPerProducer = 1000;
+
+    void producers(tests::support::TestResult& testResult, char* program) {
+        std::vector<std::vector<std::size_t>> received(producerCount);
+        std::size_t foreignThreadRuns = 0;
+        std::vector<std::thread> threads;
+
+        char* snodeArguments[] = {program, nullptr};
+        core::SNodeC::init(1, snodeArguments);
+
+        core::EventLoop& eventLoop = core::EventLoop::instance();
+        const std::thread::id loopThreadId = std::this_thread::get_id();
+
+        core::timer::Timer spawnTimer = core::timer::Timer::singleshotTimer(
+            [&]() {
+                for (std::size_t producer = 0; producer < producerCount; producer++) {
+                    // Keeps the loop alive until the producer has posted everything
+                    eventLoop.getEventMultiplexer().getPostQueue().hold();
+
+                    threads.emplace_back([&, producer]() {
+                        for (std::size_t sequence = 0; sequence < postsPerProducer; sequence++) {
+                            eventLoop.post([&, producer, sequence]() {
+                                if (std::this_thread::get_id() != loopThreadId) {
+                                    foreignThreadRuns++;
+                                }
+                                received[producer].push_back(sequence);
+                            });
+                        }
+
+                        eventLoop.getEventMultiplexer().getPostQueue().release();
+                    });
+                }
+            },
+            utils::Timeval({0, 1000}));
+
+        const unsigned long ticksBefore = core::EventLoop::getTickCounter();
+        const int startResult = core::SNodeC::start(utils::Timeval({2, 0}));
+        const unsigned long ticks = core::EventLoop::getTickCounter() - ticksBefore;
+
+        for (std::thread& thread : threads) {
+            thread.join();
+        }
+
+        bool ordered = true;
+        std::size_t total = 0;
+        for (const std::vector<std::size_t>& sequences : received) {
+            total += sequences.size();
+            for (std::size_t i = 0; i < sequences.size(); i++) {
+                ordered = ordered && sequences[i] == i;
+            }
+        }
+
+        std::printf("EventLoopPostTest: %zu posts drained in %lu ticks\n", total, ticks);
+
+        testResult.expectEqual(0, startResult, "loop ends without observers once every hold is released and every post has run");
+        testResult.expectTrue(total == producerCount * postsPerProducer, "every posted task runs exactly once");
+        testResult.expectTrue(ordered, "tasks of one producer run in posting order");
+        testResult.expectEqual(0, static_cast<int>(foreignThreadRuns), "posted tasks run on the loop thread");
+    }
+
+    void crossLoopStop(tests::support::TestResult& testResult, char* program) {
+        std::atomic<bool> watchdogExpired = false;
+        std::chrono::steady_clock::time_point stoppedAt;
+
+        char arg1[] = "--event-loops=2";
+        char* snodeArguments[] = {program, arg1, nullptr};
+        core::SNodeC::init(2, snodeArguments);
+
+        core::EventLoop::atEventLoopStart([&stoppedAt]() {
+            static_cast<void>(core::timer::Timer::singleshotTimer(
+                [&stoppedAt]() {
+                    stoppedAt = std::chrono::steady_clock::now();
+                    core::SNodeC::stop();
+                },
+                utils::Timeval({0, 50000})));
+        });
+
+        core::timer::Timer watchdog = core::timer::Timer::singleshotTimer(
+            [&watchdogExpired]() {
+                watchdogExpired = true;
+                core::SNodeC::stop();
+            },
+            utils::Timeval({3, 0}));
+
+        // Without a wake-up the primary loop would sleep for the whole tick timeout
+        const int startResult = core::SNodeC::start(utils::Timeval({10, 0}));
+        const std::chrono::steady_clock::duration stopLatency = std::chrono::steady_clock::now() - stoppedAt;
+
+        testResult.expectEqual(0, startResult, "event loops stop cleanly");
+        testResult.expectTrue(!watchdogExpired, "a stop requested on the secondary loop wakes the primary loop");
+        testResult.expectTrue(stopLatency < std::chrono::seconds(1), "the primary loop stops without waiting for its tick timeout");
+    }
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    tests::support::TestResult testResult;
+    int result = tests::support::cTestSkipReturnCode;
+
+    if (tests::support::shouldSkipRootWithoutSNodeCGroup()) {
+        tests::support::printRootWithoutSNodeCGroupSkipMessage("EventLoopPostTest");
+    } else {
+        const std::string scenario = argc > 1 ? argv[1] : "producers";
+
+        if (scenario == "cross-loop-stop") {
+            crossLoopStop(testResult, argv[0]);
+        } else {
+            producers(testResult, argv[0]);
+        }
+
+        result = testResult.processResult();
+    }
+
+    return result;
+}
@@ -0,0 +1,96 @@
+/*
+ * SNode.C - A Slim Toolkit for Network Communication
+ * Copyright (C) Volker Christian <me@vchrist.at>
+ *               2020, 2021, 2022, 2023, 2024, 2025, 2026
+ *
+ * SPDX-License-Identifier: LGPL-3.0-or-later OR MIT
+ */
+
+#include "core/EventLoop.h"
+#include "core/EventMultiplexer.h"
+#include "core/SNodeC.h"
+#include "core/timer/Timer.h"
+#include "support/TestResult.h"
+#include "utils/Timeval.h"
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+
+#include <ctime>
+
+#endif /* DOXYGEN_SHOULD_SKIP_THIS */
+
+namespace {
+
+    utils::Timeval monotonicNow() {
+        timespec now{};
+        clock_gettime(CLOCK_MONOTONIC, &now);
+
+        return utils::Timeval({now.tv_sec, now.tv_nsec / 1000});
+    }
+
+    void busyWait(const utils::Timeval& duration) {
+        const utils::Timeval until = monotonicNow() + duration;
+        while (monotonicNow() < until) {
+        }
+    }
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    tests::support::TestResult testResult;
+    int result = tests::support::cTestSkipReturnCode;
+
+    if (tests::support::shouldSkipRootWithoutSNodeCGroup()) {
+        tests::support::printRootWithoutSNodeCGroupSkipMessage("EventLoopTickClockTest");
+    } else {
+        core::SNodeC::init(argc, argv);
+
+        core::EventMultiplexer& eventMultiplexer = core::EventLoop::instance().getEventMultiplexer();
+
+        const utils::Timeval before = monotonicNow();
+        const utils::Timeval currentTime = utils::Timeval::currentTime();
+        const utils::Timeval after = monotonicNow();
+        // Tolerant enough for CLOCK_MONOTONIC_COARSE, far too tight for the wall clock
+        testResult.expectTrue(currentTime > before - utils::Timeval({1, 0}) && currentTime < after + utils::Timeval({1, 0}),
+                              "Timeval::currentTime() reads the monotonic clock");
+
+        const utils::Timeval outsideTick = eventMultiplexer.getCurrentTime();
+        busyWait(utils::Timeval({0, 20000}));
+        testResult.expectTrue(eventMultiplexer.getCurrentTime() > outsideTick, "the clock is read outside of a tick");
+
+        bool sameTickTime = false;
+        bool tickTimeNotAhead = false;
+        utils::Timeval firstTickTime;
+
+        core::timer::Timer sampler = core::timer::Timer::singleshotTimer(
+            [&]() {
+                firstTickTime = eventMultiplexer.getCurrentTime();
+                busyWait(utils::Timeval({0, 2000}));
+
+                sameTickTime = eventMultiplexer.getCurrentTime() == firstTickTime;
+                tickTimeNotAhead = firstTickTime <= monotonicNow();
+            },
+            utils::Timeval({0, 1000}));
+
+        bool nextTickAdvanced = false;
+
+        core::timer::Timer stopTimer = core::timer::Timer::singleshotTimer(
+            [&]() {
+                nextTickAdvanced = eventMultiplexer.getCurrentTime() > firstTickTime;
+                core::SNodeC::stop();
+            },
+            utils::Timeval({0, 20000}));
+
+        const int startResult = core::SNodeC::start(utils::Timeval({1, 0}));
+
+        testResult.expectEqual(0, startResult, "event loop exits cleanly after the stop callback");
+        testResult.expectTrue(sameTickTime, "the tick time is sampled once and cached while the tick dispatches");
+        testResult.expectTrue(tickTimeNotAhead, "the cached tick time never runs ahead of the monotonic clock");
+        testResult.expectTrue(nextTickAdvanced, "a later tick samples a new time");
+
+        core::SNodeC::free();
+        result = testResult.processResult();
+    }
+
+    return result;
+}
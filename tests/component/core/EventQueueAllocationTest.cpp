@@ -0,0 +1,130 @@
+/*
+ * SNode.C - A Slim Toolkit for Network Communication
+ * Copyright (C) Volker Christian <me@vchrist.at>
+ *               2020, 2021, 2022, 2023, 2024, 2025, 2026
+ *
+ * SPDX-License-Identifier: LGPL-3.0-or-later OR MIT
+ */
+
+#include "core/EventLoop.h"
+#include "core/EventMultiplexer.h"
+#include "core/EventReceiver.h"
+#include "core/SNodeC.h"
+#include "support/TestResult.h"
+#include "utils/Timeval.h"
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+
+#include <chrono>
+#include <csignal>
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+#include <vector>
+
+#endif /* DOXYGEN_SHOULD_SKIP_THIS */
+
+namespace {
+
+    std::size_t allocationCount = 0;
+
+    class SpinningReceiver final : public core::EventReceiver {
+    public:
+        SpinningReceiver()
+            : core::EventReceiver("event queue allocation test") {
+        }
+
+        void onEvent([[maybe_unused]] const utils::Timeval& currentTime) override {
+            ++dispatchCount;
+            span();
+        }
+
+        std::size_t dispatchCount = 0;
+
+    private:
+        ~SpinningReceiver() override = default;
+    };
+
+} // namespace
+
+void* operator new(std::size_t size) {
+    ++allocationCount;
+
+    void* pointer = std::malloc(size == 0 ? 1 : size);
+    if (pointer == nullptr) {
+        throw std::bad_alloc();
+    }
+
+    return pointer;
+}
+
+void operator delete(void* pointer) noexcept {
+    std::free(pointer);
+}
+
+void operator delete(void* pointer, [[maybe_unused]] std::size_t size) noexcept {
+    std::free(pointer);
+}
+
+int main(int argc, char* argv[]) {
+    tests::support::TestResult testResult;
+    int result = tests::support::cTestSkipReturnCode;
+
+    if (tests::support::shouldSkipRootWithoutSNodeCGroup()) {
+        tests::support::printRootWithoutSNodeCGroupSkipMessage("EventQueueAllocationTest");
+    } else {
+        constexpr std::size_t receiverCount = 256;
+        constexpr std::size_t warmupTicks = 16;
+        constexpr std::size_t measuredTicks = 1000;
+
+        core::SNodeC::init(argc, argv);
+
+        core::EventMultiplexer& eventMultiplexer = core::EventLoop::instance().getEventMultiplexer();
+
+        sigset_t sigMask;
+        sigemptyset(&sigMask);
+
+        std::vector<SpinningReceiver*> receivers;
+        receivers.reserve(receiverCount);
+        for (std::size_t i = 0; i < receiverCount; i++) {
+            receivers.push_back(new SpinningReceiver());
+            receivers.back()->span();
+        }
+
+        for (std::size_t tick = 0; tick < warmupTicks; tick++) {
+            static_cast<void>(eventMultiplexer.tick(utils::Timeval(), sigMask));
+        }
+
+        const std::size_t allocationsBefore = allocationCount;
+        const std::chrono::steady_clock::time_point startedAt = std::chrono::steady_clock::now();
+
+        for (std::size_t tick = 0; tick < measuredTicks; tick++) {
+            static_cast<void>(eventMultiplexer.tick(utils::Timeval(), sigMask));
+        }
+
+        const std::chrono::nanoseconds elapsed = std::chrono::steady_clock::now() - startedAt;
+        const std::size_t allocations = allocationCount - allocationsBefore;
+
+        std::printf("EventQueueAllocationTest: %zu receivers, %zu ticks, %.2f allocations/tick, %.1f ns/dispatch\n",
+                    receiverCount,
+                    measuredTicks,
+                    static_cast<double>(allocations) / static_cast<double>(measuredTicks),
+                    static_cast<double>(elapsed.count()) / static_cast<double>(receiverCount * measuredTicks));
+
+        bool everyReceiverDispatched = true;
+        for (const SpinningReceiver* receiver : receivers) {
+            everyReceiverDispatched = everyReceiverDispatched && receiver->dispatchCount == warmupTicks + measuredTicks;
+        }
+
+        testResult.expectTrue(allocations == 0, "span, dispatch and relax do not allocate");
+        testResult.expectTrue(everyReceiverDispatched, "every spanned receiver is dispatched once per tick");
+
+        eventMultiplexer.clearEventQueue();
+
+        core::SNodeC::free();
+        result = testResult.processResult();
+    }
+
+    return result;
+}
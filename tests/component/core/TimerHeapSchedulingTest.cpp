@@ -0,0 +1,118 @@
+/*
+ * SNode.C - A Slim Toolkit for Network Communication
+ * Copyright (C) Volker Christian <me@vchrist.at>
+ *               2020, 2021, 2022, 2023, 2024, 2025, 2026
+ *
+ * SPDX-License-Identifier: LGPL-3.0-or-later OR MIT
+ */
+
+#include "core/EventLoop.h"
+#include "core/EventMultiplexer.h"
+#include "core/SNodeC.h"
+#include "core/timer/Timer.h"
+#include "support/TestResult.h"
+#include "utils/Timeval.h"
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+#endif /* DOXYGEN_SHOULD_SKIP_THIS */
+
+int main(int argc, char* argv[]) {
+    tests::support::TestResult testResult;
+    int result = tests::support::cTestSkipReturnCode;
+
+    if (tests::support::shouldSkipRootWithoutSNodeCGroup()) {
+        tests::support::printRootWithoutSNodeCGroupSkipMessage("TimerHeapSchedulingTest");
+    } else {
+        constexpr std::size_t timerCount = 512;
+
+        std::vector<std::size_t> fired;
+        std::vector<int> fireCount(timerCount, 0);
+        std::vector<int> expectedFireCount(timerCount, 0);
+        std::vector<core::timer::Timer> timers;
+        int intervalCount = 0;
+
+        core::SNodeC::init(argc, argv);
+
+        // Armed within one tick so that all deadlines share the same cached tick time and differ by their delay only
+        core::timer::Timer setupTimer = core::timer::Timer::singleshotTimer(
+            [&timers, &fired, &fireCount, &expectedFireCount]() {
+                timers.reserve(timerCount);
+                for (std::size_t i = 0; i < timerCount; i++) {
+                    // Interleaved deadlines between 10 ms and 100 ms, many timers share the same delay
+                    const long delayMs = 10 + (3 * static_cast<long>((i * 37) % 31));
+
+                    timers.push_back(core::timer::Timer::singleshotTimer(
+                        [i, &fired, &fireCount]() {
+                            fired.push_back(i);
+                            fireCount[i]++;
+                        },
+                        utils::Timeval({0, delayMs * 1000})));
+                }
+
+                for (std::size_t i = 0; i < timerCount; i++) {
+                    if (i % 3 == 0) {
+                        timers[i].cancel();
+                    } else {
+                        expectedFireCount[i] = 1;
+                    }
+                }
+            },
+            utils::Timeval({0, 1000}));
+
+        core::timer::Timer intervalTimer = core::timer::Timer::intervalTimer(
+            [&intervalCount]() {
+                intervalCount++;
+            },
+            utils::Timeval({0, 5000}));
+
+        core::EventMultiplexer& eventMultiplexer = core::EventLoop::instance().getEventMultiplexer();
+        utils::Timeval restartedAt;
+        bool restartedFired = false;
+
+        core::timer::Timer restartedTimer = core::timer::Timer::singleshotTimer(
+            [&testResult, &eventMultiplexer, &restartedAt, &restartedFired]() {
+                restartedFired = true;
+                testResult.expectTrue(eventMultiplexer.getCurrentTime() - restartedAt >= utils::Timeval({0, 20000}),
+                                      "restarted timer fires only after its postponed deadline");
+            },
+            utils::Timeval({0, 20000}));
+
+        core::timer::Timer restartTrigger = core::timer::Timer::singleshotTimer(
+            [&restartedTimer, &eventMultiplexer, &restartedAt]() {
+                restartedAt = eventMultiplexer.getCurrentTime();
+                restartedTimer.restart();
+            },
+            utils::Timeval({0, 15000}));
+
+        core::timer::Timer stopTimer = core::timer::Timer::singleshotTimer(
+            [&intervalTimer]() {
+                intervalTimer.cancel();
+                core::SNodeC::stop();
+            },
+            utils::Timeval({0, 150000}));
+
+        const int startResult = core::SNodeC::start(utils::Timeval({2, 0}));
+
+        testResult.expectEqual(0, startResult, "event loop exits cleanly after the stop callback");
+        testResult.expectTrue(fireCount == expectedFireCount, "every live timer fires exactly once, cancelled timers never fire");
+
+        std::vector<long> firedDelays;
+        firedDelays.reserve(fired.size());
+        for (const std::size_t i : fired) {
+            firedDelays.push_back(static_cast<long>((i * 37) % 31));
+        }
+        testResult.expectTrue(std::is_sorted(firedDelays.begin(), firedDelays.end()), "timers fire in deadline order");
+        testResult.expectTrue(restartedFired, "restarted timer fires");
+        testResult.expectTrue(intervalCount >= 10, "interval timer keeps rescheduling itself");
+
+        core::SNodeC::free();
+        result = testResult.processResult();
+    }
+
+    return result;
+}
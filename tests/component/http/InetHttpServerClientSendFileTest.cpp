@@ -0,0 +1,132 @@
+/*
+ * SNode.C - A Slim Toolkit for Network Communication
+ * Copyright (C) Volker Christian <me@vchrist.at>
+ *               2020, 2021, 2022, 2023, 2024, 2025, 2026
+ *
+ * SPDX-License-Identifier: LGPL-3.0-or-later OR MIT
+ */
+
+#include "HttpServerClientBehaviorTest.h"
+
+#include "net/in/SocketAddress.h"
+#include "web/http/legacy/in/Client.h"
+#include "web/http/legacy/in/Server.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <string>
+#include <unistd.h>
+
+namespace {
+
+    // Neither a multiple of the write block size nor of the file range size
+    constexpr std::size_t fileSize = 1024U * 1024U + 4321U;
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    tests::support::TestResult testResult;
+    int result = tests::support::cTestSkipReturnCode;
+
+    if (tests::support::shouldSkipRootWithoutSNodeCGroup()) {
+        tests::support::printRootWithoutSNodeCGroupSkipMessage("InetHttpServerClientSendFileTest");
+    } else {
+        char path[] = "/tmp/snodec-sendfile-XXXXXX";
+        const int fd = mkstemp(path);
+        const std::string content = tests::component::http::makePatternBody(fileSize);
+        if (fd >= 0) {
+            close(fd);
+            std::ofstream(path, std::ios::binary) << content;
+        }
+
+        tests::component::http::BehaviorState state;
+        bool serverCanSendFile = false;
+        int sendFileStatus = -1;
+
+        core::SNodeC::init(argc, argv);
+
+        using Server = web::http::legacy::in::Server;
+        using Client = web::http::legacy::in::Client;
+
+        const Server server("ipv4-http-sendfile-server",
+                            [&state, &serverCanSendFile, &sendFileStatus, &path](const auto& request, const auto& response) {
+                                ++state.serverRequestCount;
+                                state.serverUrls.push_back(request->url);
+                                serverCanSendFile = response->getSocketContext()->canSendFileToPeer();
+
+                                response->set("Connection", "close");
+                                response->sendFile(path, [&sendFileStatus](int errnum) {
+                                    sendFileStatus = errnum;
+                                });
+                            });
+        Client client(
+            "ipv4-http-sendfile-client",
+            [&state](const auto& request) {
+                ++state.httpConnectedCount;
+                request->method = "GET";
+                request->url = "/file";
+                request->set("Connection", "close");
+                if (!request->end(
+                        [&state](const auto&, const auto& response) {
+                            ++state.clientResponseCount;
+                            state.clientStatuses.push_back(response->statusCode);
+                            state.clientBodies.push_back(tests::component::http::toString(response->body));
+                            core::SNodeC::stop();
+                        },
+                        [&state](const auto&, const std::string&) {
+                            ++state.parseErrorCount;
+                            core::SNodeC::stop();
+                        })) {
+                    ++state.unexpectedStateCount;
+                    core::SNodeC::stop();
+                }
+            },
+            [&state](const auto&) {
+                ++state.httpDisconnectedCount;
+            });
+
+        tests::component::http::configureHttpBehaviorTest(server, client, state);
+
+        server.listen(net::in::SocketAddress("127.0.0.1", 0), [&client, &state](const auto& socketAddress, core::socket::State listenState) {
+            if (listenState == core::socket::State::OK) {
+                ++state.listenOkCount;
+                const std::uint16_t effectivePort = socketAddress.getPort();
+                if (effectivePort != 0) {
+                    ++state.effectiveListenEndpointOkCount;
+                    client.connect(net::in::SocketAddress("127.0.0.1", effectivePort), [&state](const auto&, core::socket::State connectState) {
+                        if (connectState == core::socket::State::OK) {
+                            ++state.clientConnectOkCount;
+                        } else {
+                            ++state.unexpectedStateCount;
+                            core::SNodeC::stop();
+                        }
+                    });
+                } else {
+                    ++state.unexpectedStateCount;
+                    core::SNodeC::stop();
+                }
+            } else {
+                ++state.unexpectedStateCount;
+                core::SNodeC::stop();
+            }
+        });
+
+        const int startResult = core::SNodeC::start(utils::Timeval({3, 0}));
+        tests::component::http::expectBehaviorCommon(testResult, state, "send file", startResult);
+        testResult.expectEqual(0, sendFileStatus, "IPv4 legacy HTTP server opens the file");
+        testResult.expectTrue(serverCanSendFile, "IPv4 legacy HTTP server connection sends file ranges with sendfile");
+        testResult.expectEqual(1, state.clientResponseCount, "IPv4 legacy HTTP client observes one file response");
+        testResult.expectTrue(state.clientStatuses == std::vector<std::string>({"200"}), "IPv4 legacy HTTP client observes file status 200");
+        testResult.expectTrue(!state.clientBodies.empty() && state.clientBodies.front().size() == fileSize,
+                              "IPv4 legacy HTTP client observes the file size");
+        testResult.expectTrue(!state.clientBodies.empty() && state.clientBodies.front() == content,
+                              "IPv4 legacy HTTP client observes the exact file content");
+        result = testResult.processResult();
+        core::SNodeC::free();
+
+        std::remove(path);
+    }
+
+    return result;
+}
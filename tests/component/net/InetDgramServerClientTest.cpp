@@ -0,0 +1,230 @@
+/*
+ * SNode.C - A Slim Toolkit for Network Communication
+ * Copyright (C) Volker Christian <me@vchrist.at>
+ *               2020, 2021, 2022, 2023, 2024, 2025, 2026
+ *
+ * SPDX-License-Identifier: LGPL-3.0-or-later OR MIT
+ */
+
+#include "core/SNodeC.h"
+#include "core/socket/State.h"
+#include "core/timer/Timer.h"
+#include "net/in/SocketAddress.h"
+#include "net/in/dgram/SocketClient.h"
+#include "net/in/dgram/SocketServer.h"
+#include "support/TestResult.h"
+#include "utils/Timeval.h"
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#endif /* DOXYGEN_SHOULD_SKIP_THIS */
+
+namespace {
+
+    constexpr std::size_t datagramCount = 200;
+    constexpr std::size_t datagramSize = 100;
+
+    // One server and one client exchanging datagramCount datagrams, queued by the client within a single tick
+    struct Flow {
+        explicit Flow(const std::string& name, bool echo)
+            : echo(echo)
+            , server(
+                  name + "-server",
+                  [this](net::in::dgram::SocketServerEndpoint* endpoint, const core::socket::dgram::Datagram& datagram) {
+                      received(datagram, serverReceived, serverIntact);
+
+                      if (serverReceived == 1) {
+                          peerPort = endpoint->getPeerAddress(datagram).getPort();
+                      }
+                      if (this->echo) {
+                          endpoint->sendTo(datagram, datagram.data, datagram.length);
+                      }
+                      if (!this->echo && serverReceived == datagramCount) {
+                          done = true;
+                      }
+                  },
+                  [this](net::in::dgram::SocketServerEndpoint* endpoint) {
+                      serverEndpoint = endpoint;
+                  },
+                  [this](net::in::dgram::SocketServerEndpoint*) {
+                      serverEndpoint = nullptr;
+                  })
+            , client(
+                  name + "-client",
+                  [this](net::in::dgram::SocketClientEndpoint*, const core::socket::dgram::Datagram& datagram) {
+                      received(datagram, clientReceived, clientIntact);
+
+                      if (clientReceived == datagramCount) {
+                          done = true;
+                      }
+                  },
+                  [this](net::in::dgram::SocketClientEndpoint* endpoint) {
+                      clientEndpoint = endpoint;
+                      clientPort = endpoint->getLocalAddress().getPort();
+
+                      std::vector<char> payload(datagramSize);
+                      for (std::uint32_t index = 0; index < datagramCount; index++) {
+                          std::memcpy(payload.data(), &index, sizeof(index));
+                          endpoint->send(payload.data(), payload.size());
+                      }
+                  },
+                  [this](net::in::dgram::SocketClientEndpoint*) {
+                      clientEndpoint = nullptr;
+                  }) {
+            server.getConfig()->Instance::forceUnrequired();
+            client.getConfig()->Instance::forceUnrequired();
+        }
+
+        void received(const core::socket::dgram::Datagram& datagram, std::size_t& count, bool& intact) {
+            std::uint32_t index = 0;
+            if (datagram.length == datagramSize) {
+                std::memcpy(&index, datagram.data, sizeof(index));
+            }
+
+            intact = intact && datagram.length == datagramSize && index == count;
+            count++;
+        }
+
+        void start(const std::function<void()>& onFailed) {
+            server.listen(net::in::SocketAddress("127.0.0.1", 0),
+                          [this, onFailed](const net::in::SocketAddress& address, core::socket::State state) {
+                              if (state == core::socket::State::OK) {
+                                  client.connect(net::in::SocketAddress("127.0.0.1", address.getPort()),
+                                                 [onFailed](const net::in::SocketAddress&, core::socket::State state) {
+                                                     if (state != core::socket::State::OK) {
+                                                         onFailed();
+                                                     }
+                                                 });
+                              } else {
+                                  onFailed();
+                              }
+                          });
+        }
+
+        void stop() {
+            if (serverEndpoint != nullptr) {
+                serverReadStats = serverEndpoint->getReadStats();
+                serverWriteStats = serverEndpoint->getWriteStats();
+                serverEndpoint->close();
+            }
+            if (clientEndpoint != nullptr) {
+                clientReadStats = clientEndpoint->getReadStats();
+                clientWriteStats = clientEndpoint->getWriteStats();
+                clientEndpoint->close();
+            }
+        }
+
+        bool echo;
+
+        net::in::dgram::SocketServer server;
+        net::in::dgram::SocketClient client;
+
+        net::in::dgram::SocketServerEndpoint* serverEndpoint = nullptr;
+        net::in::dgram::SocketClientEndpoint* clientEndpoint = nullptr;
+
+        std::size_t serverReceived = 0;
+        std::size_t clientReceived = 0;
+        bool serverIntact = true;
+        bool clientIntact = true;
+        bool done = false;
+
+        std::uint16_t clientPort = 0;
+        std::uint16_t peerPort = 0;
+
+        core::socket::dgram::SocketReader::Stats serverReadStats;
+        core::socket::dgram::SocketWriter::Stats serverWriteStats;
+        core::socket::dgram::SocketReader::Stats clientReadStats;
+        core::socket::dgram::SocketWriter::Stats clientWriteStats;
+    };
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    tests::support::TestResult testResult;
+    int result = tests::support::cTestSkipReturnCode;
+
+    if (tests::support::shouldSkipRootWithoutSNodeCGroup()) {
+        tests::support::printRootWithoutSNodeCGroupSkipMessage("InetDgramServerClientTest");
+    } else {
+        core::SNodeC::init(argc, argv);
+
+        bool failed = false;
+
+        Flow echoFlow("dgram-echo", true);
+
+        // The client sends segmented (UDP_SEGMENT), the server receives coalesced (UDP_GRO). Paths without offload fall back.
+        Flow offloadFlow("dgram-offload", false);
+        offloadFlow.client.getConfig()->setGso();
+        offloadFlow.server.getConfig()->setGro();
+
+        const auto onFailed = [&failed]() {
+            failed = true;
+            core::SNodeC::stop();
+        };
+
+        echoFlow.start(onFailed);
+        offloadFlow.start(onFailed);
+
+        core::timer::Timer poll = core::timer::Timer::intervalTimer(
+            [&](const std::function<void()>& stop) {
+                if (echoFlow.done && offloadFlow.done) {
+                    echoFlow.stop();
+                    offloadFlow.stop();
+                    stop();
+                    core::SNodeC::stop();
+                }
+            },
+            utils::Timeval({0, 10000}));
+
+        core::timer::Timer watchdog = core::timer::Timer::singleshotTimer(
+            [&]() {
+                echoFlow.stop();
+                offloadFlow.stop();
+                core::SNodeC::stop();
+            },
+            utils::Timeval({5, 0}));
+
+        const int startResult = core::SNodeC::start(utils::Timeval({10, 0}));
+
+        std::printf("InetDgramServerClientTest: client sendmmsg calls=%zu, server recvmmsg calls=%zu, offload sendmmsg calls=%zu\n",
+                    echoFlow.clientWriteStats.calls,
+                    echoFlow.serverReadStats.calls,
+                    offloadFlow.clientWriteStats.calls);
+
+        testResult.expectEqual(0, startResult, "event loop stops successfully");
+        testResult.expectTrue(!failed, "servers listen and clients connect");
+
+        testResult.expectEqual(
+            static_cast<int>(datagramCount), static_cast<int>(echoFlow.serverReceived), "server receives every datagram");
+        testResult.expectEqual(static_cast<int>(datagramCount), static_cast<int>(echoFlow.clientReceived), "client receives every echo");
+        testResult.expectTrue(echoFlow.serverIntact && echoFlow.clientIntact, "datagrams keep their boundaries and order");
+        testResult.expectTrue(echoFlow.peerPort != 0 && echoFlow.peerPort == echoFlow.clientPort,
+                              "the peer address is the client address");
+
+        testResult.expectTrue(echoFlow.clientWriteStats.calls > 0 && echoFlow.clientWriteStats.calls < datagramCount / 4,
+                              "datagrams queued in one tick leave in batches");
+        testResult.expectTrue(echoFlow.serverReadStats.calls > 0 && echoFlow.serverReadStats.calls < datagramCount,
+                              "datagrams are received in batches");
+        testResult.expectTrue(echoFlow.serverWriteStats.calls < datagramCount, "echoes leave in batches");
+        testResult.expectEqual(0, static_cast<int>(echoFlow.clientWriteStats.dropped), "no datagram is dropped");
+
+        testResult.expectEqual(
+            static_cast<int>(datagramCount), static_cast<int>(offloadFlow.serverReceived), "segmented datagrams are all received");
+        testResult.expectTrue(offloadFlow.serverIntact, "coalesced datagrams are split at their segment size");
+        testResult.expectEqual(static_cast<int>(datagramCount),
+                               static_cast<int>(offloadFlow.clientWriteStats.datagrams),
+                               "segments are counted as datagrams");
+
+        core::SNodeC::free();
+        result = testResult.processResult();
+    }
+
+    return result;
+}
@@ -0,0 +1,328 @@
+/*
+ * SNode.C - A Slim Toolkit for Network Communication
+ * Copyright (C) Volker Christian <me@vchrist.at>
+ *               2020, 2021, 2022, 2023, 2024, 2025, 2026
+ *
+ * SPDX-License-Identifier: LGPL-3.0-or-later OR MIT
+ */
+
+#include "core/SNodeC.h"
+#include "core/socket/State.h"
+#include "core/socket/stream/SocketConnection.h"
+#include "core/socket/stream/SocketContext.h"
+#include "core/socket/stream/SocketContextFactory.h"
+#include "net/dns/Resolver.h"
+#include "net/in/SocketAddress.h"
+#include "net/in/stream/legacy/SocketClient.h"
+#include "net/in/stream/legacy/SocketServer.h"
+#include "support/TestResult.h"
+#include "utils/Timeval.h"
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+
+#include <algorithm>
+#include <arpa/inet.h>
+#include <atomic>
+#include <cctype>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <netinet/in.h>
+#include <poll.h>
+#include <string>
+#include <sys/socket.h>
+#include <thread>
+#include <utility>
+#include <unistd.h>
+#include <vector>
+
+#endif /* DOXYGEN_SHOULD_SKIP_THIS */
+
+namespace {
+
+    // Answers A queries on UDP and TCP: "backend" resolves, "large" only fits into a TCP answer, everything else does not exist
+    class StubNameServer {
+    public:
+        StubNameServer() {
+            sockaddr_in sockAddr{};
+            sockAddr.sin_family = AF_INET;
+            sockAddr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+
+            socklen_t sockAddrLen = sizeof(sockAddr);
+
+            udpFd = socket(AF_INET, SOCK_DGRAM, 0);
+            tcpFd = socket(AF_INET, SOCK_STREAM, 0);
+
+            ready = udpFd >= 0 && tcpFd >= 0 && bind(udpFd, reinterpret_cast<sockaddr*>(&sockAddr), sizeof(sockAddr)) == 0 &&
+                    getsockname(udpFd, reinterpret_cast<sockaddr*>(&sockAddr), &sockAddrLen) == 0 &&
+                    bind(tcpFd, reinterpret_cast<sockaddr*>(&sockAddr), sizeof(sockAddr)) == 0 && listen(tcpFd, 8) == 0;
+            port = ntohs(sockAddr.sin_port);
+
+            if (ready) {
+                thread = std::thread([this]() {
+                    serve();
+                });
+            }
+        }
+
+        ~StubNameServer() {
+            stopped = true;
+            if (thread.joinable()) {
+                thread.join();
+            }
+            close(udpFd);
+            close(tcpFd);
+        }
+
+        StubNameServer(const StubNameServer&) = delete;
+        StubNameServer& operator=(const StubNameServer&) = delete;
+
+        int queries(const std::string& name, bool tcp) {
+            const std::scoped_lock lock(mutex);
+
+            return (tcp ? tcpQueries : udpQueries)[name];
+        }
+
+        bool ready = false;
+        std::uint16_t port = 0;
+
+    private:
+        void serve() {
+            while (!stopped) {
+                pollfd pollFds[] = {{.fd = udpFd, .events = POLLIN, .revents = 0}, {.fd = tcpFd, .events = POLLIN, .revents = 0}};
+
+                if (poll(pollFds, 2, 100) > 0) {
+                    if ((pollFds[0].revents & POLLIN) != 0) {
+                        serveUdp();
+                    }
+                    if ((pollFds[1].revents & POLLIN) != 0) {
+                        serveTcp();
+                    }
+                }
+            }
+        }
+
+        void serveUdp() {
+            char request[512];
+            sockaddr_in peer{};
+            socklen_t peerLen = sizeof(peer);
+
+            const ssize_t n = recvfrom(udpFd, request, sizeof(request), 0, reinterpret_cast<sockaddr*>(&peer), &peerLen);
+
+            if (n > 12) {
+                const std::vector<char> response = answer(std::string(request, static_cast<std::size_t>(n)), false);
+
+                static_cast<void>(sendto(udpFd, response.data(), response.size(), 0, reinterpret_cast<sockaddr*>(&peer), peerLen));
+            }
+        }
+
+        void serveTcp() {
+            const int fd = accept(tcpFd, nullptr, nullptr);
+
+            if (fd >= 0) {
+                std::string request;
+                char chunk[512];
+                ssize_t n = 0;
+
+                const auto complete = [&request]() {
+                    return request.size() >= 2 &&
+                           request.size() >= 2 + (static_cast<std::size_t>(static_cast<std::uint8_t>(request[0])) << 8 |
+                                                  static_cast<std::uint8_t>(request[1]));
+                };
+
+                while (!complete() && (n = recv(fd, chunk, sizeof(chunk), 0)) > 0) {
+                    request.append(chunk, static_cast<std::size_t>(n));
+                }
+
+                if (request.size() > 14) {
+                    const std::vector<char> message = answer(request.substr(2), true);
+
+                    std::vector<char> response{static_cast<char>(message.size() >> 8), static_cast<char>(message.size() & 0xff)};
+                    response.insert(response.end(), message.begin(), message.end());
+
+                    static_cast<void>(send(fd, response.data(), response.size(), MSG_NOSIGNAL));
+                }
+
+                close(fd);
+            }
+        }
+
+        std::vector<char> answer(const std::string& request, bool tcp) {
+            std::string name;
+            std::size_t offset = 12;
+
+            while (offset < request.size() && request[offset] != 0) {
+                const std::size_t labelLength = static_cast<std::uint8_t>(request[offset]);
+
+                for (std::size_t i = offset + 1; i <= offset + labelLength && i < request.size(); i++) {
+                    name += static_cast<char>(std::tolower(static_cast<unsigned char>(request[i])));
+                }
+                name += '.';
+                offset += labelLength + 1;
+            }
+            offset += 5; // Terminating root label, type and class
+
+            {
+                const std::scoped_lock lock(mutex);
+                (tcp ? tcpQueries : udpQueries)[name]++;
+            }
+
+            const bool exists = name == "backend.snodec.test." || name == "large.snodec.test.";
+            const bool truncated = name == "large.snodec.test." && !tcp;
+
+            std::vector<char> response(request.begin(), request.begin() + static_cast<std::ptrdiff_t>(std::min(offset, request.size())));
+            response[2] = static_cast<char>(0x81 | (truncated ? 0x02 : 0x00)); // QR, TC, RD
+            response[3] = static_cast<char>(exists ? 0x80 : 0x83);             // RA, NOERROR or NXDOMAIN
+            response[6] = 0;
+            response[7] = static_cast<char>(exists && !truncated ? 1 : 0);
+            response[8] = response[9] = response[10] = response[11] = 0;
+
+            if (exists && !truncated) {
+                // Name pointer to the question, A, IN, TTL 60, 127.0.0.1
+                const char record[] = {'\xc0', 0x0c, 0, 1, 0, 1, 0, 0, 0, 60, 0, 4, 127, 0, 0, 1};
+                response.insert(response.end(), record, record + sizeof(record));
+            }
+
+            return response;
+        }
+
+        int udpFd = -1;
+        int tcpFd = -1;
+        std::atomic<bool> stopped = false;
+        std::thread thread;
+
+        std::mutex mutex;
+        std::map<std::string, int> udpQueries;
+        std::map<std::string, int> tcpQueries;
+    };
+
+    class TestSocketContext : public core::socket::stream::SocketContext {
+    public:
+        using SocketContext::SocketContext;
+
+    private:
+        void onConnected() override {
+        }
+
+        void onDisconnected() override {
+        }
+
+        std::size_t onReceivedFromPeer() override {
+            char chunk[64];
+
+            return readFromPeer(chunk, sizeof(chunk));
+        }
+
+        bool onSignal([[maybe_unused]] int signum) override {
+            return true;
+        }
+    };
+
+    class TestSocketContextFactory : public core::socket::stream::SocketContextFactory {
+    public:
+        core::socket::stream::SocketContext* create(core::socket::stream::SocketConnection* socketConnection) override {
+            return new TestSocketContext(socketConnection);
+        }
+    };
+
+    using SocketClient = net::in::stream::legacy::SocketClient<TestSocketContextFactory>;
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    tests::support::TestResult testResult;
+    int result = tests::support::cTestSkipReturnCode;
+
+    if (tests::support::shouldSkipRootWithoutSNodeCGroup()) {
+        tests::support::printRootWithoutSNodeCGroupSkipMessage("InetLegacyClientDnsResolverTest");
+    } else {
+        StubNameServer nameServer;
+        testResult.expectTrue(nameServer.ready, "stub name server listens on UDP and TCP");
+
+        core::SNodeC::init(argc, argv);
+
+        net::dns::Resolver& resolver = net::dns::Resolver::instance();
+        resolver.setNameServers({{.address = "127.0.0.1", .port = nameServer.port}});
+        resolver.setTimeout(utils::Timeval({1, 0}));
+
+        const net::in::stream::legacy::SocketServer<TestSocketContextFactory> socketServer("dns-resolver-server");
+        const SocketClient firstClient("dns-resolver-first-client");
+        const SocketClient secondClient("dns-resolver-second-client");
+        const SocketClient missingClient("dns-resolver-missing-client");
+        const SocketClient missingAgainClient("dns-resolver-missing-again-client");
+        const SocketClient largeClient("dns-resolver-large-client");
+
+        for (const SocketClient* socketClient : {&firstClient, &secondClient, &missingClient, &missingAgainClient, &largeClient}) {
+            socketClient->getConfig()->Instance::forceUnrequired();
+        }
+        socketServer.getConfig()->Instance::forceUnrequired();
+
+        // Each connect starts from the status callback of the previous one
+        const std::vector<std::pair<const SocketClient*, std::string>> steps = {{&firstClient, "backend.snodec.test"},
+                                                                                {&secondClient, "Backend.snodec.test."},
+                                                                                {&missingClient, "missing.snodec.test"},
+                                                                                {&missingAgainClient, "missing.snodec.test"},
+                                                                                {&largeClient, "large.snodec.test"}};
+        std::vector<std::string> outcomes;
+        std::vector<std::size_t> queriesSent;
+        std::string firstCanonName;
+        std::uint16_t port = 0;
+
+        std::function<void(std::size_t)> connect = [&](std::size_t step) {
+            if (step < steps.size()) {
+                const std::size_t queries = resolver.getStats().queries;
+
+                steps[step].first->connect(
+                    steps[step].second,
+                    port,
+                    [&, step, queries](const net::in::SocketAddress& remoteAddress, core::socket::State state) {
+                        outcomes.emplace_back(state == core::socket::State::OK ? "ok" : "failed");
+                        queriesSent.push_back(resolver.getStats().queries - queries);
+                        if (step == 0) {
+                            firstCanonName = remoteAddress.getCanonName();
+                        }
+
+                        connect(step + 1);
+                    });
+            } else {
+                core::SNodeC::stop();
+            }
+        };
+
+        socketServer.listen(net::in::SocketAddress("127.0.0.1", 0),
+                            [&port, &connect](const net::in::SocketAddress& socketAddress, core::socket::State state) {
+                                if (state == core::socket::State::OK) {
+                                    port = socketAddress.getPort();
+                                    connect(0);
+                                } else {
+                                    core::SNodeC::stop();
+                                }
+                            });
+
+        const int startResult = core::SNodeC::start(utils::Timeval({5, 0}));
+
+        testResult.expectEqual(0, startResult, "event loop stops successfully");
+        testResult.expectTrue(outcomes == std::vector<std::string>{"ok", "ok", "failed", "failed", "ok"},
+                              "connects succeed for resolvable names and fail for missing ones");
+        testResult.expectTrue(queriesSent == std::vector<std::size_t>{1, 0, 1, 0, 2},
+                              "a name is queried once, further connects are served from the cache");
+        testResult.expectTrue(firstCanonName == "backend.snodec.test", "the canonical name is taken from the answer");
+        testResult.expectEqual(1, nameServer.queries("backend.snodec.test.", false), "the resolvable name is queried once");
+        testResult.expectEqual(1, nameServer.queries("missing.snodec.test.", false), "the negative answer is cached");
+        testResult.expectEqual(1, nameServer.queries("large.snodec.test.", false), "the truncated name is queried once over UDP");
+        testResult.expectEqual(1, nameServer.queries("large.snodec.test.", true), "the truncated answer is retried over TCP");
+
+        const net::dns::Resolver::Stats stats = resolver.getStats();
+        testResult.expectEqual(4, static_cast<int>(stats.queries), "four queries are sent");
+        testResult.expectEqual(3, static_cast<int>(stats.misses), "each name is looked up once");
+        testResult.expectEqual(1, static_cast<int>(stats.tcpFallbacks), "one query falls back to TCP");
+        testResult.expectEqual(0, static_cast<int>(stats.timeouts), "no query times out");
+
+        core::SNodeC::free();
+        result = testResult.processResult();
+    }
+
+    return result;
+}
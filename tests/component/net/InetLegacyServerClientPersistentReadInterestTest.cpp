@@ -0,0 +1,301 @@
+/*
+ * SNode.C - A Slim Toolkit for Network Communication
+ * Copyright (C) Volker Christian <me@vchrist.at>
+ *               2020, 2021, 2022, 2023, 2024, 2025, 2026
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "core/DescriptorEventPublisher.h"
+#include "core/EventLoop.h"
+#include "core/EventMultiplexer.h"
+#include "core/SNodeC.h"
+#include "core/socket/State.h"
+#include "core/socket/stream/SocketConnection.h"
+#include "core/socket/stream/SocketContext.h"
+#include "core/socket/stream/SocketContextFactory.h"
+#include "net/in/SocketAddress.h"
+#include "net/in/stream/legacy/SocketClient.h"
+#include "net/in/stream/legacy/SocketServer.h"
+#include "support/TestResult.h"
+#include "utils/Timeval.h"
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <string_view>
+
+#endif /* DOXYGEN_SHOULD_SKIP_THIS */
+
+namespace {
+
+    constexpr int roundTrips = 32;
+
+    constexpr std::string_view clientPayload = "snodec-ipv4-interest-ping";
+    constexpr std::string_view serverReply = "snodec-ipv4-interest-pong";
+
+    enum Phase { SuspendingInterest = 0, PersistentInterest = 1, PhaseCount = 2 };
+
+    struct TestState {
+        int serverListenOkCount = 0;
+        int clientConnectOkCount = 0;
+        int serverPayloadReceivedCount = 0;
+        int clientReplyReceivedCount[PhaseCount] = {};
+        unsigned long steadyStateStartInterestUpdates[PhaseCount] = {};
+        unsigned long steadyStateInterestUpdates[PhaseCount] = {};
+        int unexpectedStateCount = 0;
+        int unexpectedPayloadCount = 0;
+
+        std::function<void()> startPersistentPhase;
+    };
+
+    unsigned long readInterestUpdateCount() {
+        return core::EventLoop::instance()
+            .getEventMultiplexer()
+            .getDescriptorEventPublisher(core::EventMultiplexer::DISP_TYPE::RD)
+            .getInterestUpdateCount();
+    }
+
+    class TestServerSocketContext : public core::socket::stream::SocketContext {
+    public:
+        TestServerSocketContext(core::socket::stream::SocketConnection* socketConnection, TestState& testState)
+            : core::socket::stream::SocketContext(socketConnection)
+            , testState(testState) {
+        }
+
+    private:
+        void onConnected() override {
+        }
+
+        void onDisconnected() override {
+        }
+
+        std::size_t onReceivedFromPeer() override {
+            char chunk[4096];
+
+            const std::size_t chunkLen = readFromPeer(chunk, sizeof(chunk));
+
+            if (chunkLen > 0) {
+                if (std::string(chunk, chunkLen) == clientPayload) {
+                    ++testState.serverPayloadReceivedCount;
+                    sendToPeer(serverReply.data(), serverReply.size());
+                } else {
+                    ++testState.unexpectedPayloadCount;
+                    core::SNodeC::stop();
+                }
+            }
+
+            return chunkLen;
+        }
+
+        bool onSignal([[maybe_unused]] int signum) override {
+            return true;
+        }
+
+        TestState& testState;
+    };
+
+    // Ping-pong roundTrips times and record the read interest updates issued between the first and the last reply
+    class TestClientSocketContext : public core::socket::stream::SocketContext {
+    public:
+        TestClientSocketContext(core::socket::stream::SocketConnection* socketConnection, TestState& testState, Phase phase)
+            : core::socket::stream::SocketContext(socketConnection)
+            , testState(testState)
+            , phase(phase) {
+        }
+
+    private:
+        void onConnected() override {
+            sendToPeer(clientPayload.data(), clientPayload.size());
+        }
+
+        void onDisconnected() override {
+        }
+
+        std::size_t onReceivedFromPeer() override {
+            char chunk[4096];
+
+            const std::size_t chunkLen = readFromPeer(chunk, sizeof(chunk));
+
+            if (chunkLen > 0) {
+                if (std::string(chunk, chunkLen) == serverReply) {
+                    const int replies = ++testState.clientReplyReceivedCount[phase];
+
+                    if (replies == 1) {
+                        testState.steadyStateStartInterestUpdates[phase] = readInterestUpdateCount();
+                    }
+
+                    if (replies < roundTrips) {
+                        sendToPeer(clientPayload.data(), clientPayload.size());
+                    } else {
+                        testState.steadyStateInterestUpdates[phase] =
+                            readInterestUpdateCount() - testState.steadyStateStartInterestUpdates[phase];
+
+                        if (phase == SuspendingInterest) {
+                            testState.startPersistentPhase();
+                        } else {
+                            core::SNodeC::stop();
+                        }
+                    }
+                } else {
+                    ++testState.unexpectedPayloadCount;
+                    core::SNodeC::stop();
+                }
+            }
+
+            return chunkLen;
+        }
+
+        bool onSignal([[maybe_unused]] int signum) override {
+            return true;
+        }
+
+        TestState& testState;
+        Phase phase;
+    };
+
+    class TestServerSocketContextFactory : public core::socket::stream::SocketContextFactory {
+    public:
+        explicit TestServerSocketContextFactory(TestState& testState)
+            : testState(testState) {
+        }
+
+        core::socket::stream::SocketContext* create(core::socket::stream::SocketConnection* socketConnection) override {
+            return new TestServerSocketContext(socketConnection, testState);
+        }
+
+    private:
+        TestState& testState;
+    };
+
+    class TestClientSocketContextFactory : public core::socket::stream::SocketContextFactory {
+    public:
+        TestClientSocketContextFactory(TestState& testState, Phase phase)
+            : testState(testState)
+            , phase(phase) {
+        }
+
+        core::socket::stream::SocketContext* create(core::socket::stream::SocketConnection* socketConnection) override {
+            return new TestClientSocketContext(socketConnection, testState, phase);
+        }
+
+    private:
+        TestState& testState;
+        Phase phase;
+    };
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    tests::support::TestResult testResult;
+    int result = tests::support::cTestSkipReturnCode;
+
+    if (tests::support::shouldSkipRootWithoutSNodeCGroup()) {
+        tests::support::printRootWithoutSNodeCGroupSkipMessage("InetLegacyServerClientPersistentReadInterestTest");
+    } else {
+        TestState testState;
+        core::SNodeC::init(argc, argv);
+
+        using SocketClient = net::in::stream::legacy::SocketClient<TestClientSocketContextFactory, TestState&, Phase>;
+        using SocketServer = net::in::stream::legacy::SocketServer<TestServerSocketContextFactory, TestState&>;
+
+        SocketClient suspendingClient("ipv4-suspending-interest-client", testState, SuspendingInterest);
+        SocketClient persistentClient("ipv4-persistent-interest-client", testState, PersistentInterest);
+        const SocketServer suspendingServer("ipv4-suspending-interest-server", testState);
+        const SocketServer persistentServer("ipv4-persistent-interest-server", testState);
+
+        suspendingClient.getConfig()->Instance::forceUnrequired();
+        persistentClient.getConfig()->Instance::forceUnrequired();
+        suspendingServer.getConfig()->Instance::forceUnrequired();
+        persistentServer.getConfig()->Instance::forceUnrequired();
+
+        suspendingClient.getConfig()->setReadPersistentInterest(false);
+        suspendingServer.getConfig()->setReadPersistentInterest(false);
+        persistentClient.getConfig()->setReadPersistentInterest(true);
+        persistentServer.getConfig()->setReadPersistentInterest(true);
+
+        const auto listen = [&testState](const SocketServer& socketServer, SocketClient& socketClient) {
+            socketServer.listen(net::in::SocketAddress("127.0.0.1", 0),
+                                [&socketClient, &testState](const net::in::SocketAddress& socketAddress, core::socket::State state) {
+                                    if (state == core::socket::State::OK) {
+                                        ++testState.serverListenOkCount;
+                                        socketClient.connect(
+                                            net::in::SocketAddress("127.0.0.1", socketAddress.getPort()),
+                                            [&testState](const net::in::SocketAddress&, core::socket::State connectState) {
+                                                if (connectState == core::socket::State::OK) {
+                                                    ++testState.clientConnectOkCount;
+                                                } else {
+                                                    ++testState.unexpectedStateCount;
+                                                    core::SNodeC::stop();
+                                                }
+                                            });
+                                    } else {
+                                        ++testState.unexpectedStateCount;
+                                        core::SNodeC::stop();
+                                    }
+                                });
+        };
+
+        testState.startPersistentPhase = [&listen, &persistentServer, &persistentClient]() {
+            listen(persistentServer, persistentClient);
+        };
+
+        listen(suspendingServer, suspendingClient);
+
+        const int startResult = core::SNodeC::start(utils::Timeval({2, 0}));
+
+        testResult.expectEqual(0, startResult, "event loop stops successfully after both ping-pong phases");
+        testResult.expectEqual(2, testState.serverListenOkCount, "both legacy servers report OK");
+        testResult.expectEqual(2, testState.clientConnectOkCount, "both legacy clients connect");
+        testResult.expectEqual(2 * roundTrips, testState.serverPayloadReceivedCount, "servers receive every ping of both phases");
+        testResult.expectEqual(roundTrips, testState.clientReplyReceivedCount[SuspendingInterest], "suspending client receives every pong");
+        testResult.expectEqual(roundTrips, testState.clientReplyReceivedCount[PersistentInterest], "persistent client receives every pong");
+        testResult.expectTrue(testState.steadyStateInterestUpdates[SuspendingInterest] >= 2 * (roundTrips - 1),
+                              "suspending readers update the read interest on every received chunk");
+        testResult.expectTrue(testState.steadyStateInterestUpdates[PersistentInterest] == 0,
+                              "persistent readers issue no read interest updates in the steady state");
+        testResult.expectEqual(0, testState.unexpectedStateCount, "listen and connect callbacks report no unexpected states");
+        testResult.expectEqual(0, testState.unexpectedPayloadCount, "servers and clients receive no unexpected payloads");
+
+        result = testResult.processResult();
+        core::SNodeC::free();
+    }
+
+    return result;
+}
@@ -0,0 +1,260 @@
+/*
+ * SNode.C - A Slim Toolkit for Network Communication
+ * Copyright (C) Volker Christian <me@vchrist.at>
+ *               2020, 2021, 2022, 2023, 2024, 2025, 2026
+ *
+ * SPDX-License-Identifier: LGPL-3.0-or-later OR MIT
+ */
+
+#include "core/SNodeC.h"
+#include "core/socket/State.h"
+#include "core/socket/stream/SocketConnection.h"
+#include "core/socket/stream/SocketContext.h"
+#include "core/socket/stream/SocketContextFactory.h"
+#include "core/timer/Timer.h"
+#include "net/in/SocketAddress.h"
+#include "net/in/stream/legacy/SocketClient.h"
+#include "net/in/stream/legacy/SocketServer.h"
+#include "support/TestResult.h"
+#include "utils/Timeval.h"
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+
+#include <algorithm>
+#include <cerrno>
+#include <cstddef>
+#include <span>
+#include <string>
+
+#endif /* DOXYGEN_SHOULD_SKIP_THIS */
+
+namespace {
+
+    constexpr std::size_t chunkSize = 16 * 1024;
+    constexpr std::size_t highWatermark = 4 * chunkSize;
+    constexpr std::size_t lowWatermark = chunkSize;
+    constexpr std::size_t hardLimit = 4 * chunkSize;
+    constexpr std::size_t total = 4 * 1024 * 1024;
+
+    struct TestState {
+        // Server: keep producing while below the high watermark or ignore it and run into the hard limit
+        bool throttle = true;
+
+        std::size_t produced = 0;
+        bool shutdown = false;
+        std::size_t maxBacklog = 0;
+        std::size_t highCount = 0;
+        std::size_t drainCount = 0;
+        int writeError = 0;
+
+        std::size_t received = 0;
+        bool intact = true;
+        bool clientDisconnected = false;
+    };
+
+    char patternAt(std::size_t position) {
+        return static_cast<char>('a' + (position * 7 + position / 4093) % 26);
+    }
+
+    class ServerSocketContext : public core::socket::stream::SocketContext {
+    public:
+        ServerSocketContext(core::socket::stream::SocketConnection* socketConnection, TestState& testState)
+            : core::socket::stream::SocketContext(socketConnection)
+            , testState(testState) {
+        }
+
+    private:
+        void produce() {
+            std::string chunk(chunkSize, '\0');
+
+            while (testState.produced < total && testState.writeError == 0 && !(testState.throttle && isWriteBufferHigh())) {
+                for (std::size_t i = 0; i < chunkSize; i++) {
+                    chunk[i] = patternAt(testState.produced + i);
+                }
+                sendToPeer(chunk.data(), chunk.size());
+                testState.produced += chunkSize;
+
+                testState.maxBacklog = std::max(testState.maxBacklog, getTotalQueued() - getTotalSent());
+            }
+
+            if (testState.produced == total && testState.writeError == 0 && !testState.shutdown) {
+                testState.shutdown = true;
+                shutdownWrite();
+            }
+        }
+
+        void onConnected() override {
+            produce();
+        }
+
+        void onDisconnected() override {
+        }
+
+        void onWriteBufferHigh() override {
+            testState.highCount++;
+        }
+
+        void onDrain() override {
+            testState.drainCount++;
+
+            produce();
+        }
+
+        void onWriteError(int errnum) override {
+            testState.writeError = errnum;
+
+            core::socket::stream::SocketContext::onWriteError(errnum);
+        }
+
+        std::size_t onReceivedFromPeer() override {
+            return consumeFromPeer(peekFromPeer().size());
+        }
+
+        bool onSignal([[maybe_unused]] int signum) override {
+            return true;
+        }
+
+        TestState& testState;
+    };
+
+    class ClientSocketContext : public core::socket::stream::SocketContext {
+    public:
+        ClientSocketContext(core::socket::stream::SocketConnection* socketConnection, TestState& testState)
+            : core::socket::stream::SocketContext(socketConnection)
+            , testState(testState) {
+        }
+
+    private:
+        void onConnected() override {
+        }
+
+        void onDisconnected() override {
+            testState.clientDisconnected = true;
+
+            core::SNodeC::stop();
+        }
+
+        std::size_t onReceivedFromPeer() override {
+            const std::span<const char> data = peekFromPeer();
+
+            for (std::size_t i = 0; i < data.size(); i++) {
+                testState.intact = testState.intact && data[i] == patternAt(testState.received + i);
+            }
+            testState.received += data.size();
+
+            return consumeFromPeer(data.size());
+        }
+
+        bool onSignal([[maybe_unused]] int signum) override {
+            return true;
+        }
+
+        TestState& testState;
+    };
+
+    template <typename SocketContext>
+    class SocketContextFactory : public core::socket::stream::SocketContextFactory {
+    public:
+        explicit SocketContextFactory(TestState& testState)
+            : testState(testState) {
+        }
+
+        core::socket::stream::SocketContext* create(core::socket::stream::SocketConnection* socketConnection) override {
+            return new SocketContext(socketConnection, testState);
+        }
+
+    private:
+        TestState& testState;
+    };
+
+    using SocketServer = net::in::stream::legacy::SocketServer<SocketContextFactory<ServerSocketContext>, TestState&>;
+    using SocketClient = net::in::stream::legacy::SocketClient<SocketContextFactory<ClientSocketContext>, TestState&>;
+
+    TestState run(char* program, const std::string& scenario) {
+        TestState testState;
+        testState.throttle = scenario == "watermarks";
+
+        char* snodeArguments[] = {program, nullptr};
+        core::SNodeC::init(1, snodeArguments);
+
+        const SocketServer server("backpressure-server", testState);
+        server.getConfig()->Instance::forceUnrequired();
+        server.getConfig()->setWriteHighWatermark(highWatermark)->setWriteLowWatermark(lowWatermark);
+        if (scenario != "watermarks") {
+            server.getConfig()->setWriteHardLimit(hardLimit)->setWriteHardLimitPolicy(scenario);
+        }
+
+        const SocketClient client("backpressure-client", testState);
+        client.getConfig()->Instance::forceUnrequired();
+
+        const auto onListening = [&client](const net::in::SocketAddress& socketAddress, core::socket::State state) {
+            if (state == core::socket::State::OK) {
+                client.connect("127.0.0.1", socketAddress.getPort(), [](const net::in::SocketAddress&, core::socket::State) {
+                });
+            }
+        };
+
+        server.listen(net::in::SocketAddress("127.0.0.1", 0), onListening);
+
+        const core::timer::Timer watchdog = core::timer::Timer::singleshotTimer(
+            []() {
+                core::SNodeC::stop();
+            },
+            utils::Timeval({10, 0}));
+
+        core::SNodeC::start(utils::Timeval({20, 0}));
+        core::SNodeC::free();
+
+        return testState;
+    }
+
+    void watermarks(tests::support::TestResult& testResult, char* program) {
+        const TestState testState = run(program, "watermarks");
+
+        testResult.expectTrue(testState.received == total && testState.intact, "watermarks: everything arrives in order");
+        testResult.expectTrue(testState.highCount > 0, "watermarks: the producer is told to stop");
+        testResult.expectEqual(static_cast<int>(testState.highCount), static_cast<int>(testState.drainCount),
+                               "watermarks: every stop is followed by a drain notification");
+        testResult.expectTrue(testState.maxBacklog <= highWatermark + chunkSize, "watermarks: the write buffer stays bounded");
+    }
+
+    void dropPolicy(tests::support::TestResult& testResult, char* program) {
+        const TestState testState = run(program, "drop");
+
+        testResult.expectEqual(0, testState.writeError, "drop: the connection stays up");
+        testResult.expectTrue(testState.received == hardLimit && testState.intact, "drop: what fits below the hard limit arrives");
+        testResult.expectTrue(testState.clientDisconnected, "drop: the connection is shut down normally");
+    }
+
+    void closePolicy(tests::support::TestResult& testResult, char* program) {
+        const TestState testState = run(program, "close");
+
+        testResult.expectEqual(ENOBUFS, testState.writeError, "close: exceeding the hard limit is a write error");
+        testResult.expectTrue(testState.received <= hardLimit && testState.intact, "close: nothing beyond the hard limit is sent");
+        testResult.expectTrue(testState.clientDisconnected, "close: the connection is closed");
+    }
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    tests::support::TestResult testResult;
+    int result = tests::support::cTestSkipReturnCode;
+
+    if (tests::support::shouldSkipRootWithoutSNodeCGroup()) {
+        tests::support::printRootWithoutSNodeCGroupSkipMessage("InetLegacyServerClientWriteBackpressureTest");
+    } else {
+        const std::string scenario = argc > 1 ? argv[1] : "watermarks";
+
+        if (scenario == "drop") {
+            dropPolicy(testResult, argv[0]);
+        } else if (scenario == "close") {
+            closePolicy(testResult, argv[0]);
+        } else {
+            watermarks(testResult, argv[0]);
+        }
+
+        result = testResult.processResult();
+    }
+
+    return result;
+}
@@ -0,0 +1,194 @@
+/*
+ * SNode.C - A Slim Toolkit for Network Communication
+ * Copyright (C) Volker Christian <me@vchrist.at>
+ *               2020, 2021, 2022, 2023, 2024, 2025, 2026
+ *
+ * SPDX-License-Identifier: LGPL-3.0-or-later OR MIT
+ */
+
+#include "core/SNodeC.h"
+#include "core/socket/State.h"
+#include "core/socket/stream/SocketConnection.h"
+#include "core/socket/stream/SocketContext.h"
+#include "core/socket/stream/SocketContextFactory.h"
+#include "net/in/SocketAddress.h"
+#include "net/in/stream/legacy/SocketClient.h"
+#include "net/in/stream/legacy/SocketServer.h"
+#include "support/TestResult.h"
+#include "utils/Timeval.h"
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <sys/socket.h>
+
+#endif /* DOXYGEN_SHOULD_SKIP_THIS */
+
+namespace {
+
+    constexpr std::size_t replySize = 8 * 1024 * 1024;
+    constexpr std::size_t zeroCopyThreshold = 16 * 1024;
+
+    std::string makePayload(std::size_t size) {
+        std::string payload(size, '\0');
+        for (std::size_t i = 0; i < size; i++) {
+            payload[i] = static_cast<char>('a' + (i * 7 + i / 4093) % 26);
+        }
+        return payload;
+    }
+
+    struct TestState {
+        std::shared_ptr<const std::string> reply = std::make_shared<const std::string>(makePayload(replySize));
+        int serverZeroCopyEnabled = 0;
+        std::string received;
+        bool replyIntact = false;
+    };
+
+    class TestServerSocketContext : public core::socket::stream::SocketContext {
+    public:
+        TestServerSocketContext(core::socket::stream::SocketConnection* socketConnection, TestState& testState)
+            : SocketContext(socketConnection)
+            , testState(testState) {
+        }
+
+    private:
+        void onConnected() override {
+            socklen_t optLen = sizeof(testState.serverZeroCopyEnabled);
+            static_cast<void>(
+                getsockopt(getSocketConnection()->getFd(), SOL_SOCKET, SO_ZEROCOPY, &testState.serverZeroCopyEnabled, &optLen));
+        }
+
+        void onDisconnected() override {
+        }
+
+        std::size_t onReceivedFromPeer() override {
+            char chunk[64];
+            const std::size_t n = readFromPeer(chunk, sizeof(chunk));
+
+            if (n > 0) {
+                // Copied head, then one referenced 8 MiB payload flushed as zero-copy sends
+                sendToPeer("reply:", 6);
+                sendToPeer(testState.reply);
+                shutdownWrite();
+            }
+
+            return n;
+        }
+
+        bool onSignal([[maybe_unused]] int signum) override {
+            return true;
+        }
+
+        TestState& testState;
+    };
+
+    class TestClientSocketContext : public core::socket::stream::SocketContext {
+    public:
+        TestClientSocketContext(core::socket::stream::SocketConnection* socketConnection, TestState& testState)
+            : SocketContext(socketConnection)
+            , testState(testState) {
+        }
+
+    private:
+        void onConnected() override {
+            sendToPeer("get", 3);
+        }
+
+        void onDisconnected() override {
+            testState.replyIntact = testState.received == "reply:" + *testState.reply;
+            core::SNodeC::stop();
+        }
+
+        std::size_t onReceivedFromPeer() override {
+            char chunk[16384];
+            const std::size_t n = readFromPeer(chunk, sizeof(chunk));
+
+            testState.received.append(chunk, n);
+
+            return n;
+        }
+
+        bool onSignal([[maybe_unused]] int signum) override {
+            return true;
+        }
+
+        TestState& testState;
+    };
+
+    class TestServerSocketContextFactory : public core::socket::stream::SocketContextFactory {
+    public:
+        explicit TestServerSocketContextFactory(TestState& testState)
+            : testState(testState) {
+        }
+
+        core::socket::stream::SocketContext* create(core::socket::stream::SocketConnection* socketConnection) override {
+            return new TestServerSocketContext(socketConnection, testState);
+        }
+
+    private:
+        TestState& testState;
+    };
+
+    class TestClientSocketContextFactory : public core::socket::stream::SocketContextFactory {
+    public:
+        explicit TestClientSocketContextFactory(TestState& testState)
+            : testState(testState) {
+        }
+
+        core::socket::stream::SocketContext* create(core::socket::stream::SocketConnection* socketConnection) override {
+            return new TestClientSocketContext(socketConnection, testState);
+        }
+
+    private:
+        TestState& testState;
+    };
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    tests::support::TestResult testResult;
+    int result = tests::support::cTestSkipReturnCode;
+
+    if (tests::support::shouldSkipRootWithoutSNodeCGroup()) {
+        tests::support::printRootWithoutSNodeCGroupSkipMessage("InetLegacyServerClientZeroCopyTest");
+    } else {
+        TestState testState;
+        core::SNodeC::init(argc, argv);
+
+        net::in::stream::legacy::SocketClient<TestClientSocketContextFactory, TestState&> socketClient("ipv4-zerocopy-client",
+                                                                                                       testState);
+        const net::in::stream::legacy::SocketServer<TestServerSocketContextFactory, TestState&> socketServer("ipv4-zerocopy-server",
+                                                                                                             testState);
+        socketClient.getConfig()->Instance::forceUnrequired();
+        socketServer.getConfig()->Instance::forceUnrequired();
+        socketServer.getConfig()->setZeroCopy()->setZeroCopyThreshold(zeroCopyThreshold);
+
+        int connectState = -1;
+        socketServer.listen(net::in::SocketAddress("127.0.0.1", 0),
+                            [&socketClient, &connectState](const net::in::SocketAddress& socketAddress, core::socket::State state) {
+                                if (state == core::socket::State::OK) {
+                                    socketClient.connect(net::in::SocketAddress("127.0.0.1", socketAddress.getPort()),
+                                                         [&connectState](const net::in::SocketAddress&, core::socket::State state) {
+                                                             connectState = state == core::socket::State::OK ? 0 : 1;
+                                                         });
+                                } else {
+                                    core::SNodeC::stop();
+                                }
+                            });
+
+        const int startResult = core::SNodeC::start(utils::Timeval({5, 0}));
+
+        testResult.expectEqual(0, startResult, "event loop stops successfully");
+        testResult.expectEqual(0, connectState, "client connects");
+        testResult.expectEqual(1, testState.serverZeroCopyEnabled, "server connection has SO_ZEROCOPY enabled");
+        testResult.expectTrue(testState.received.size() == replySize + 6, "client receives the whole reply");
+        testResult.expectTrue(testState.replyIntact, "zero-copy reply arrives intact and in order");
+
+        core::SNodeC::free();
+        result = testResult.processResult();
+    }
+
+    return result;
+}
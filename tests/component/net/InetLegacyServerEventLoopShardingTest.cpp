@@ -0,0 +1,297 @@
+/*
+ * SNode.C - A Slim Toolkit for Network Communication
+ * Copyright (C) Volker Christian <me@vchrist.at>
+ *               2020, 2021, 2022, 2023, 2024, 2025, 2026
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "core/SNodeC.h"
+#include "core/socket/State.h"
+#include "core/socket/stream/SocketConnection.h"
+#include "core/socket/stream/SocketContext.h"
+#include "core/socket/stream/SocketContextFactory.h"
+#include "core/timer/Timer.h"
+#include "net/in/SocketAddress.h"
+#include "net/in/stream/legacy/SocketClient.h"
+#include "net/in/stream/legacy/SocketServer.h"
+#include "support/TestResult.h"
+#include "utils/Timeval.h"
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+
+#include <arpa/inet.h>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <netinet/in.h>
+#include <set>
+#include <string>
+#include <string_view>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#endif /* DOXYGEN_SHOULD_SKIP_THIS */
+
+namespace {
+
+    constexpr int clientCount = 16;
+
+    constexpr std::string_view clientPayload = "snodec-ipv4-sharding-request";
+    constexpr std::string_view serverReply = "snodec-ipv4-sharding-reply";
+
+    struct TestState {
+        std::atomic<int> serverListenOkCount = 0;
+        std::atomic<int> clientConnectOkCount = 0;
+        std::atomic<int> serverConnectedCount = 0;
+        std::atomic<int> serverPayloadReceivedCount = 0;
+        std::atomic<int> clientReplyReceivedCount = 0;
+        std::atomic<int> unexpectedStateCount = 0;
+        std::atomic<int> unexpectedPayloadCount = 0;
+
+        std::mutex serverEventLoopsMutex;
+        std::set<std::size_t> serverEventLoops;
+    };
+
+    // Reserve a currently unused port. SO_REUSEPORT sharding needs a fixed port as every shard binds on its own.
+    std::uint16_t reserveLoopbackPort() {
+        std::uint16_t port = 0;
+
+        const int fd = ::socket(AF_INET, SOCK_STREAM, 0);
+        if (fd >= 0) {
+            sockaddr_in address{};
+            address.sin_family = AF_INET;
+            address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+            address.sin_port = 0;
+
+            socklen_t addressLength = sizeof(address);
+            if (::bind(fd, reinterpret_cast<sockaddr*>(&address), sizeof(address)) == 0 &&
+                ::getsockname(fd, reinterpret_cast<sockaddr*>(&address), &addressLength) == 0) {
+                port = ntohs(address.sin_port);
+            }
+
+            ::close(fd);
+        }
+
+        return port;
+    }
+
+    class TestServerSocketContext : public core::socket::stream::SocketContext {
+    public:
+        TestServerSocketContext(core::socket::stream::SocketConnection* socketConnection, TestState& testState)
+            : core::socket::stream::SocketContext(socketConnection)
+            , testState(testState) {
+        }
+
+    private:
+        void onConnected() override {
+            ++testState.serverConnectedCount;
+
+            const std::lock_guard<std::mutex> guard(testState.serverEventLoopsMutex);
+            testState.serverEventLoops.insert(core::SNodeC::eventLoopIndex());
+        }
+
+        void onDisconnected() override {
+        }
+
+        std::size_t onReceivedFromPeer() override {
+            char chunk[4096];
+
+            const std::size_t chunkLen = readFromPeer(chunk, sizeof(chunk));
+
+            if (chunkLen > 0) {
+                if (std::string(chunk, chunkLen) == clientPayload) {
+                    ++testState.serverPayloadReceivedCount;
+                    sendToPeer(serverReply.data(), serverReply.size());
+                } else {
+                    ++testState.unexpectedPayloadCount;
+                    core::SNodeC::stop();
+                }
+            }
+
+            return chunkLen;
+        }
+
+        bool onSignal([[maybe_unused]] int signum) override {
+            return true;
+        }
+
+        TestState& testState;
+    };
+
+    class TestClientSocketContext : public core::socket::stream::SocketContext {
+    public:
+        TestClientSocketContext(core::socket::stream::SocketConnection* socketConnection, TestState& testState)
+            : core::socket::stream::SocketContext(socketConnection)
+            , testState(testState) {
+        }
+
+    private:
+        void onConnected() override {
+            sendToPeer(clientPayload.data(), clientPayload.size());
+        }
+
+        void onDisconnected() override {
+        }
+
+        std::size_t onReceivedFromPeer() override {
+            char chunk[4096];
+
+            const std::size_t chunkLen = readFromPeer(chunk, sizeof(chunk));
+
+            if (chunkLen > 0) {
+                if (std::string(chunk, chunkLen) == serverReply) {
+                    if (++testState.clientReplyReceivedCount == clientCount) {
+                        core::SNodeC::stop();
+                    }
+                } else {
+                    ++testState.unexpectedPayloadCount;
+                    core::SNodeC::stop();
+                }
+            }
+
+            return chunkLen;
+        }
+
+        bool onSignal([[maybe_unused]] int signum) override {
+            return true;
+        }
+
+        TestState& testState;
+    };
+
+    class TestServerSocketContextFactory : public core::socket::stream::SocketContextFactory {
+    public:
+        explicit TestServerSocketContextFactory(TestState& testState)
+            : testState(testState) {
+        }
+
+        core::socket::stream::SocketContext* create(core::socket::stream::SocketConnection* socketConnection) override {
+            return new TestServerSocketContext(socketConnection, testState);
+        }
+
+    private:
+        TestState& testState;
+    };
+
+    class TestClientSocketContextFactory : public core::socket::stream::SocketContextFactory {
+    public:
+        explicit TestClientSocketContextFactory(TestState& testState)
+            : testState(testState) {
+        }
+
+        core::socket::stream::SocketContext* create(core::socket::stream::SocketConnection* socketConnection) override {
+            return new TestClientSocketContext(socketConnection, testState);
+        }
+
+    private:
+        TestState& testState;
+    };
+
+} // namespace
+
+int main([[maybe_unused]] int argc, char* argv[]) {
+    tests::support::TestResult testResult;
+    int result = tests::support::cTestSkipReturnCode;
+
+    if (tests::support::shouldSkipRootWithoutSNodeCGroup()) {
+        tests::support::printRootWithoutSNodeCGroupSkipMessage("InetLegacyServerEventLoopShardingTest");
+    } else {
+        TestState testState;
+
+        const std::uint16_t port = reserveLoopbackPort();
+        testResult.expectTrue(port != 0, "a free loopback port is reserved for the sharded listener");
+
+        char arg1[] = "--event-loops=2";
+        char* loopArgs[] = {argv[0], arg1, nullptr};
+        core::SNodeC::init(2, loopArgs);
+
+        net::in::stream::legacy::SocketClient<TestClientSocketContextFactory, TestState&> socketClient("ipv4-sharding-client", testState);
+        const net::in::stream::legacy::SocketServer<TestServerSocketContextFactory, TestState&> socketServer("ipv4-sharding-server",
+                                                                                                             testState);
+
+        socketClient.getConfig()->Instance::forceUnrequired();
+        socketServer.getConfig()->Instance::forceUnrequired();
+        socketServer.getConfig()->setReusePort();
+
+        core::timer::Timer connectTimer;
+
+        socketServer.listen(
+            net::in::SocketAddress("127.0.0.1", port),
+            [&socketClient, &connectTimer, &testState, port](const net::in::SocketAddress&, core::socket::State state) {
+                if (state == core::socket::State::OK) {
+                    ++testState.serverListenOkCount;
+
+                    // Give the secondary event loop time to bring up its listener shard
+                    connectTimer = core::timer::Timer::singleshotTimer(
+                        [&socketClient, &testState, port]() {
+                            for (int client = 0; client < clientCount; ++client) {
+                                socketClient.connect(net::in::SocketAddress("127.0.0.1", port),
+                                                     [&testState](const net::in::SocketAddress&, core::socket::State connectState) {
+                                                         if (connectState == core::socket::State::OK) {
+                                                             ++testState.clientConnectOkCount;
+                                                         } else {
+                                                             ++testState.unexpectedStateCount;
+                                                             core::SNodeC::stop();
+                                                         }
+                                                     });
+                            }
+                        },
+                        utils::Timeval({0, 250000}));
+                } else {
+                    ++testState.unexpectedStateCount;
+                    core::SNodeC::stop();
+                }
+            });
+
+        const int startResult = core::SNodeC::start(utils::Timeval({1, 0}));
+
+        testResult.expectEqual(0, startResult, "event loops stop successfully after all client replies");
+        testResult.expectEqual(1, testState.serverListenOkCount.load(), "primary listener reports OK exactly once");
+        testResult.expectEqual(clientCount, testState.clientConnectOkCount.load(), "every client connect reports OK");
+        testResult.expectEqual(clientCount, testState.serverConnectedCount.load(), "every connection reaches the server");
+        testResult.expectEqual(clientCount, testState.serverPayloadReceivedCount.load(), "server receives every client payload");
+        testResult.expectEqual(clientCount, testState.clientReplyReceivedCount.load(), "every client receives its reply");
+        testResult.expectTrue(testState.serverEventLoops.size() == 2, "connections are accepted on both event loops");
+        testResult.expectEqual(0, testState.unexpectedStateCount.load(), "listen and connect callbacks report no unexpected states");
+        testResult.expectEqual(0, testState.unexpectedPayloadCount.load(), "server and clients receive no unexpected payloads");
+
+        result = testResult.processResult();
+    }
+
+    return result;
+}
@@ -0,0 +1,352 @@
+/*
+ * SNode.C - A Slim Toolkit for Network Communication
+ * Copyright (C) Volker Christian <me@vchrist.at>
+ *               2020, 2021, 2022, 2023, 2024, 2025, 2026
+ *
+ * SPDX-License-Identifier: LGPL-3.0-or-later OR MIT
+ */
+
+#include "core/SNodeC.h"
+#include "core/socket/ListenerRegistry.h"
+#include "core/socket/State.h"
+#include "core/socket/stream/SocketConnection.h"
+#include "core/socket/stream/SocketContext.h"
+#include "core/socket/stream/SocketContextFactory.h"
+#include "core/timer/Timer.h"
+#include "net/in/SocketAddress.h"
+#include "net/in/stream/legacy/SocketClient.h"
+#include "net/in/stream/legacy/SocketServer.h"
+#include "net/un/stream/HandOff.h"
+#include "support/TestResult.h"
+#include "utils/Timeval.h"
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+
+#include <arpa/inet.h>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <string>
+#include <sys/socket.h>
+#include <sys/wait.h>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+
+#endif /* DOXYGEN_SHOULD_SKIP_THIS */
+
+namespace {
+
+    struct TestState {
+        std::string identity;
+        std::size_t served = 0;
+        bool stopAfterServe = false;
+        std::vector<std::string> replies;
+        std::size_t expectedReplies = 1;
+    };
+
+    // Announces which process accepted the connection
+    class ServerSocketContext : public core::socket::stream::SocketContext {
+    public:
+        ServerSocketContext(core::socket::stream::SocketConnection* socketConnection, TestState& testState)
+            : core::socket::stream::SocketContext(socketConnection)
+            , testState(testState) {
+        }
+
+    private:
+        void onConnected() override {
+            testState.served++;
+            sendToPeer(testState.identity.data(), testState.identity.size());
+        }
+
+        void onDisconnected() override {
+            if (testState.stopAfterServe) {
+                core::SNodeC::stop();
+            }
+        }
+
+        std::size_t onReceivedFromPeer() override {
+            char chunk[256];
+
+            return readFromPeer(chunk, sizeof(chunk));
+        }
+
+        bool onSignal([[maybe_unused]] int signum) override {
+            return true;
+        }
+
+        TestState& testState;
+    };
+
+    class ClientSocketContext : public core::socket::stream::SocketContext {
+    public:
+        ClientSocketContext(core::socket::stream::SocketConnection* socketConnection, TestState& testState)
+            : core::socket::stream::SocketContext(socketConnection)
+            , testState(testState) {
+        }
+
+    private:
+        void onConnected() override {
+        }
+
+        void onDisconnected() override {
+        }
+
+        std::size_t onReceivedFromPeer() override {
+            char chunk[256];
+
+            const std::size_t chunkLen = readFromPeer(chunk, sizeof(chunk));
+
+            if (chunkLen > 0) {
+                testState.replies.emplace_back(chunk, chunkLen);
+                close();
+
+                if (testState.replies.size() == testState.expectedReplies) {
+                    core::SNodeC::stop();
+                }
+            }
+
+            return chunkLen;
+        }
+
+        bool onSignal([[maybe_unused]] int signum) override {
+            return true;
+        }
+
+        TestState& testState;
+    };
+
+    template <typename SocketContext>
+    class SocketContextFactory : public core::socket::stream::SocketContextFactory {
+    public:
+        explicit SocketContextFactory(TestState& testState)
+            : testState(testState) {
+        }
+
+        core::socket::stream::SocketContext* create(core::socket::stream::SocketConnection* socketConnection) override {
+            return new SocketContext(socketConnection, testState);
+        }
+
+    private:
+        TestState& testState;
+    };
+
+    using SocketServer = net::in::stream::legacy::SocketServer<SocketContextFactory<ServerSocketContext>, TestState&>;
+    using SocketClient = net::in::stream::legacy::SocketClient<SocketContextFactory<ClientSocketContext>, TestState&>;
+
+    // A listening socket on the loopback interface as created by a service manager
+    int listeningSocket(std::uint16_t& port) {
+        const int fd = ::socket(AF_INET, SOCK_STREAM, 0);
+
+        sockaddr_in sockAddr{};
+        sockAddr.sin_family = AF_INET;
+        sockAddr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        socklen_t sockAddrLen = sizeof(sockAddr);
+
+        if (fd >= 0 && (::bind(fd, reinterpret_cast<sockaddr*>(&sockAddr), sockAddrLen) != 0 || ::listen(fd, 5) != 0 ||
+                        ::getsockname(fd, reinterpret_cast<sockaddr*>(&sockAddr), &sockAddrLen) != 0)) {
+            ::close(fd);
+            return -1;
+        }
+
+        port = ntohs(sockAddr.sin_port);
+
+        return fd;
+    }
+
+    int successor(char* program, const std::string& handOffPath) {
+        TestState testState{"successor", 0, true, {}, 1};
+        bool adopted = false;
+
+        char* snodeArguments[] = {program, nullptr};
+        core::SNodeC::init(1, snodeArguments);
+
+        std::size_t received = 0;
+        for (int attempt = 0; attempt < 100 && received == 0; attempt++) {
+            received = net::un::stream::HandOff::receive(handOffPath, utils::Timeval({1, 0}));
+
+            if (received == 0) {
+                std::this_thread::sleep_for(std::chrono::milliseconds(20));
+            }
+        }
+
+        const SocketServer server("handoff-server", testState);
+        server.getConfig()->Instance::forceUnrequired();
+
+        // The configured port is irrelevant, the inherited listener is found by its instance name
+        server.listen(net::in::SocketAddress("127.0.0.1", 0), [&adopted](const net::in::SocketAddress&, core::socket::State state) {
+            adopted = state == core::socket::State::OK && core::socket::ListenerRegistry::instance().getInheritedCount() == 0;
+        });
+
+        const core::timer::Timer watchdog = core::timer::Timer::singleshotTimer(
+            []() {
+                core::SNodeC::stop();
+            },
+            utils::Timeval({5, 0}));
+
+        core::SNodeC::start(utils::Timeval({10, 0}));
+        core::SNodeC::free();
+
+        std::printf("InetLegacyServerHandOffTest: successor received %zu listener(s), adopted %d, served %zu\n",
+                    received,
+                    adopted ? 1 : 0,
+                    testState.served);
+
+        return received == 1 && adopted && testState.served == 1 ? EXIT_SUCCESS : EXIT_FAILURE;
+    }
+
+    void handOff(tests::support::TestResult& testResult, char* program) {
+        const std::string handOffPath = "/tmp/snodec-handoff-test-" + std::to_string(::getpid()) + ".sock";
+
+        const pid_t successorPid = ::fork();
+        if (successorPid == 0) {
+            ::_exit(successor(program, handOffPath));
+        }
+
+        TestState testState{"predecessor", 0, false, {}, 1};
+        std::size_t handedOver = 0;
+        bool offered = false;
+
+        char* snodeArguments[] = {program, nullptr};
+        core::SNodeC::init(1, snodeArguments);
+
+        const SocketServer server("handoff-server", testState);
+        server.getConfig()->Instance::forceUnrequired();
+
+        const SocketClient client("handoff-client", testState);
+        client.getConfig()->Instance::forceUnrequired();
+
+        core::timer::Timer connectTimer;
+
+        server.listen(net::in::SocketAddress("127.0.0.1", 0), [&](const net::in::SocketAddress& socketAddress, core::socket::State state) {
+            if (state == core::socket::State::OK) {
+                offered = net::un::stream::HandOff::offer(handOffPath, [&, port = socketAddress.getPort()](std::size_t count) {
+                    handedOver = count;
+
+                    // The predecessor does not accept anymore, the connection waits in the queue the successor now serves
+                    connectTimer = core::timer::Timer::singleshotTimer(
+                        [&client, port]() {
+                            client.connect("127.0.0.1", port, [](const net::in::SocketAddress&, core::socket::State) {
+                            });
+                        },
+                        utils::Timeval({0, 100000}));
+                });
+            }
+        });
+
+        const core::timer::Timer watchdog = core::timer::Timer::singleshotTimer(
+            []() {
+                core::SNodeC::stop();
+            },
+            utils::Timeval({5, 0}));
+
+        core::SNodeC::start(utils::Timeval({10, 0}));
+        core::SNodeC::free();
+
+        int status = 0;
+        ::waitpid(successorPid, &status, 0);
+
+        testResult.expectTrue(offered, "hand-off: the predecessor waits for its successor");
+        testResult.expectEqual(1, static_cast<int>(handedOver), "hand-off: the running listener is handed over");
+        testResult.expectEqual(0, static_cast<int>(testState.served), "hand-off: the predecessor stops accepting");
+        testResult.expectTrue(testState.replies.size() == 1 && testState.replies.front() == "successor",
+                              "hand-off: a connection to the handed over port reaches the successor");
+        testResult.expectTrue(WIFEXITED(status) && WEXITSTATUS(status) == EXIT_SUCCESS,
+                              "hand-off: the successor adopts the listener instead of binding");
+    }
+
+    void socketActivation(tests::support::TestResult& testResult, char* program) {
+        TestState testState{"activated", 0, false, {}, 2};
+        std::uint16_t namedPort = 0;
+        std::uint16_t unnamedPort = 0;
+
+        // Socket activation passes its descriptors starting at 3
+        if (::fcntl(3, F_GETFD) != -1 || ::fcntl(4, F_GETFD) != -1) {
+            std::printf("InetLegacyServerHandOffTest: descriptors 3 and 4 are in use, socket activation not tested\n");
+            return;
+        }
+
+        const int namedFd = listeningSocket(namedPort);
+        ::dup2(namedFd, 3);
+        ::close(namedFd);
+
+        const int unnamedFd = listeningSocket(unnamedPort);
+        ::dup2(unnamedFd, 4);
+        ::close(unnamedFd);
+
+        ::setenv("LISTEN_PID", std::to_string(::getpid()).c_str(), 1);
+        ::setenv("LISTEN_FDS", "2", 1);
+        ::setenv("LISTEN_FDNAMES", "activated-server:unknown", 1);
+
+        char* snodeArguments[] = {program, nullptr};
+        core::SNodeC::init(1, snodeArguments);
+
+        std::vector<std::uint16_t> listenPorts;
+
+        const auto onStatus = [&listenPorts](const net::in::SocketAddress& socketAddress, core::socket::State state) {
+            listenPorts.push_back(state == core::socket::State::OK ? socketAddress.getPort() : 0);
+        };
+
+        const SocketServer namedServer("activated-server", testState);
+        namedServer.getConfig()->Instance::forceUnrequired();
+        namedServer.listen(net::in::SocketAddress("127.0.0.1", 0), onStatus);
+
+        // Binding would fail with EADDRINUSE, the unnamed listener is matched by its address
+        const SocketServer addressedServer("addressed-server", testState);
+        addressedServer.getConfig()->Instance::forceUnrequired();
+        addressedServer.listen(net::in::SocketAddress("127.0.0.1", unnamedPort), onStatus);
+
+        const SocketClient client("activated-client", testState);
+        client.getConfig()->Instance::forceUnrequired();
+
+        const core::timer::Timer connectTimer = core::timer::Timer::singleshotTimer(
+            [&client, namedPort, unnamedPort]() {
+                for (const std::uint16_t port : {namedPort, unnamedPort}) {
+                    client.connect("127.0.0.1", port, [](const net::in::SocketAddress&, core::socket::State) {
+                    });
+                }
+            },
+            utils::Timeval({0, 100000}));
+
+        const core::timer::Timer watchdog = core::timer::Timer::singleshotTimer(
+            []() {
+                core::SNodeC::stop();
+            },
+            utils::Timeval({5, 0}));
+
+        core::SNodeC::start(utils::Timeval({10, 0}));
+        core::SNodeC::free();
+
+        testResult.expectTrue(listenPorts.size() == 2 && listenPorts[0] == namedPort && listenPorts[1] == unnamedPort,
+                              "socket activation: both servers listen on the inherited sockets");
+        testResult.expectEqual(2, static_cast<int>(testState.served), "socket activation: both inherited sockets accept");
+        testResult.expectEqual(2, static_cast<int>(testState.replies.size()), "socket activation: both clients get a reply");
+        testResult.expectTrue(std::getenv("LISTEN_FDS") == nullptr, "socket activation: the environment is not passed on");
+    }
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    tests::support::TestResult testResult;
+    int result = tests::support::cTestSkipReturnCode;
+
+    if (tests::support::shouldSkipRootWithoutSNodeCGroup()) {
+        tests::support::printRootWithoutSNodeCGroupSkipMessage("InetLegacyServerHandOffTest");
+    } else {
+        const std::string scenario = argc > 1 ? argv[1] : "hand-off";
+
+        if (scenario == "socket-activation") {
+            socketActivation(testResult, argv[0]);
+        } else {
+            handOff(testResult, argv[0]);
+        }
+
+        result = testResult.processResult();
+    }
+
+    return result;
+}
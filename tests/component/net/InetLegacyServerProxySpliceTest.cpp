@@ -0,0 +1,253 @@
+/*
+ * SNode.C - A Slim Toolkit for Network Communication
+ * Copyright (C) Volker Christian <me@vchrist.at>
+ *               2020, 2021, 2022, 2023, 2024, 2025, 2026
+ *
+ * SPDX-License-Identifier: LGPL-3.0-or-later OR MIT
+ */
+
+#include "core/SNodeC.h"
+#include "core/socket/State.h"
+#include "core/socket/stream/ProxySocketContext.h"
+#include "core/socket/stream/SocketConnection.h"
+#include "core/socket/stream/SocketContext.h"
+#include "core/socket/stream/SocketContextFactory.h"
+#include "core/timer/Timer.h"
+#include "net/in/SocketAddress.h"
+#include "net/in/stream/legacy/SocketClient.h"
+#include "net/in/stream/legacy/SocketServer.h"
+#include "support/TestResult.h"
+#include "utils/Timeval.h"
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <string>
+#include <vector>
+
+#endif /* DOXYGEN_SHOULD_SKIP_THIS */
+
+namespace {
+
+    using core::socket::stream::ProxyBridge;
+    using core::socket::stream::ProxySocketContext;
+
+    constexpr std::size_t payloadSize = 4 * 1024 * 1024;
+
+    struct TestState {
+        std::string payload;
+        std::string echoed;
+        std::vector<ProxySocketContext*> proxyContexts;
+        std::size_t splicing = 0;
+        std::size_t forwarded = 0;
+        bool upstreamFailed = false;
+    };
+
+    class EchoSocketContext : public core::socket::stream::SocketContext {
+    public:
+        using core::socket::stream::SocketContext::SocketContext;
+
+    private:
+        void onConnected() override {
+        }
+
+        void onDisconnected() override {
+        }
+
+        std::size_t onReceivedFromPeer() override {
+            const std::span<const char> data = peekFromPeer();
+
+            sendToPeer(data.data(), data.size());
+
+            return consumeFromPeer(data.size());
+        }
+
+        bool onSignal([[maybe_unused]] int signum) override {
+            return true;
+        }
+    };
+
+    class ClientSocketContext : public core::socket::stream::SocketContext {
+    public:
+        ClientSocketContext(core::socket::stream::SocketConnection* socketConnection, TestState& testState)
+            : core::socket::stream::SocketContext(socketConnection)
+            , testState(testState) {
+        }
+
+    private:
+        void onConnected() override {
+            sendToPeer(std::string(testState.payload));
+        }
+
+        void onDisconnected() override {
+            core::SNodeC::stop();
+        }
+
+        std::size_t onReceivedFromPeer() override {
+            const std::span<const char> data = peekFromPeer();
+
+            testState.echoed.append(data.data(), data.size());
+
+            if (testState.echoed.size() >= testState.payload.size()) {
+                // Both proxy connections are still up while the last bytes arrive
+                for (const ProxySocketContext* proxyContext : testState.proxyContexts) {
+                    testState.splicing += proxyContext->isSplicing() ? 1 : 0;
+                    testState.forwarded += proxyContext->getForwarded();
+                }
+
+                close();
+            }
+
+            return consumeFromPeer(data.size());
+        }
+
+        bool onSignal([[maybe_unused]] int signum) override {
+            return true;
+        }
+
+        TestState& testState;
+    };
+
+    class EchoSocketContextFactory : public core::socket::stream::SocketContextFactory {
+    public:
+        core::socket::stream::SocketContext* create(core::socket::stream::SocketConnection* socketConnection) override {
+            return new EchoSocketContext(socketConnection);
+        }
+    };
+
+    class ClientSocketContextFactory : public core::socket::stream::SocketContextFactory {
+    public:
+        explicit ClientSocketContextFactory(TestState& testState)
+            : testState(testState) {
+        }
+
+        core::socket::stream::SocketContext* create(core::socket::stream::SocketConnection* socketConnection) override {
+            return new ClientSocketContext(socketConnection, testState);
+        }
+
+    private:
+        TestState& testState;
+    };
+
+    // Remembers the proxy contexts to inspect them while the transfer is running
+    class ProxySocketContextFactory : public core::socket::stream::ProxySocketContextFactory {
+    public:
+        ProxySocketContextFactory(const std::shared_ptr<ProxyBridge>& bridge, ProxyBridge::Side side, TestState& testState)
+            : core::socket::stream::ProxySocketContextFactory(bridge, side)
+            , testState(testState) {
+        }
+
+        core::socket::stream::SocketContext* create(core::socket::stream::SocketConnection* socketConnection) override {
+            auto* proxyContext =
+                static_cast<ProxySocketContext*>(core::socket::stream::ProxySocketContextFactory::create(socketConnection));
+
+            testState.proxyContexts.push_back(proxyContext);
+
+            return proxyContext;
+        }
+
+    private:
+        TestState& testState;
+    };
+
+    using EchoServer = net::in::stream::legacy::SocketServer<EchoSocketContextFactory>;
+    using ProxyServer = net::in::stream::legacy::SocketServer<ProxySocketContextFactory,
+                                                              const std::shared_ptr<ProxyBridge>&,
+                                                              ProxyBridge::Side,
+                                                              TestState&>;
+    using ProxyClient = net::in::stream::legacy::SocketClient<ProxySocketContextFactory,
+                                                              const std::shared_ptr<ProxyBridge>&,
+                                                              ProxyBridge::Side,
+                                                              TestState&>;
+    using Client = net::in::stream::legacy::SocketClient<ClientSocketContextFactory, TestState&>;
+
+    void proxy(tests::support::TestResult& testResult, char* program, ProxyBridge::Mode mode) {
+        const std::string label = mode == ProxyBridge::Mode::Splice ? "splice: " : "copy: ";
+
+        TestState testState;
+        testState.payload.reserve(payloadSize);
+        for (std::size_t i = 0; i < payloadSize; i++) {
+            testState.payload.push_back(static_cast<char>((i * 31 + i / 4096) & 0xFF));
+        }
+
+        char* snodeArguments[] = {program, nullptr};
+        core::SNodeC::init(1, snodeArguments);
+
+        const auto bridge = std::make_shared<ProxyBridge>(mode);
+
+        const EchoServer echoServer("proxy-backend");
+        echoServer.getConfig()->Instance::forceUnrequired();
+
+        const ProxyServer proxyServer("proxy-server", bridge, ProxyBridge::Side::Downstream, testState);
+        proxyServer.getConfig()->Instance::forceUnrequired();
+
+        const ProxyClient proxyClient("proxy-upstream", bridge, ProxyBridge::Side::Upstream, testState);
+        proxyClient.getConfig()->Instance::forceUnrequired();
+
+        const Client client("proxy-client", testState);
+        client.getConfig()->Instance::forceUnrequired();
+
+        const auto onProxyListening = [&client](const net::in::SocketAddress& proxyAddress, core::socket::State state) {
+            if (state == core::socket::State::OK) {
+                client.connect("127.0.0.1", proxyAddress.getPort(), [](const net::in::SocketAddress&, core::socket::State) {
+                });
+            }
+        };
+
+        const auto onBackendListening = [&](const net::in::SocketAddress& backendAddress, core::socket::State state) {
+            if (state == core::socket::State::OK) {
+                bridge->setConnectUpstream([&, backendPort = backendAddress.getPort()]() {
+                    proxyClient.connect("127.0.0.1", backendPort, [&](const net::in::SocketAddress&, core::socket::State upstreamState) {
+                        if (upstreamState != core::socket::State::OK) {
+                            testState.upstreamFailed = true;
+                            bridge->upstreamFailed();
+                        }
+                    });
+                });
+
+                proxyServer.listen(net::in::SocketAddress("127.0.0.1", 0), onProxyListening);
+            }
+        };
+
+        echoServer.listen(net::in::SocketAddress("127.0.0.1", 0), onBackendListening);
+
+        const core::timer::Timer watchdog = core::timer::Timer::singleshotTimer(
+            []() {
+                core::SNodeC::stop();
+            },
+            utils::Timeval({10, 0}));
+
+        core::SNodeC::start(utils::Timeval({20, 0}));
+        core::SNodeC::free();
+
+        testResult.expectTrue(!testState.upstreamFailed, label + "the upstream connection is established");
+        testResult.expectEqual(2, static_cast<int>(testState.proxyContexts.size()), label + "the proxy pairs one connection per side");
+        testResult.expectTrue(testState.echoed == testState.payload, label + "the payload arrives unchanged in both directions");
+        testResult.expectEqual(
+            static_cast<int>(2 * payloadSize), static_cast<int>(testState.forwarded), label + "the proxy forwards every byte once");
+        testResult.expectEqual(mode == ProxyBridge::Mode::Splice ? 2 : 0,
+                               static_cast<int>(testState.splicing),
+                               label + "plain TCP connections are spliced only if asked to");
+    }
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    tests::support::TestResult testResult;
+    int result = tests::support::cTestSkipReturnCode;
+
+    if (tests::support::shouldSkipRootWithoutSNodeCGroup()) {
+        tests::support::printRootWithoutSNodeCGroupSkipMessage("InetLegacyServerProxySpliceTest");
+    } else {
+        const std::string scenario = argc > 1 ? argv[1] : "splice";
+
+        proxy(testResult, argv[0], scenario == "copy" ? ProxyBridge::Mode::Copy : ProxyBridge::Mode::Splice);
+
+        result = testResult.processResult();
+    }
+
+    return result;
+}
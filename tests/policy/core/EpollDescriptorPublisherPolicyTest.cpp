@@ -13,7 +13,7 @@ namespace {
             return true;
         }
 
-        std::cerr << "Missing inner epoll diagnostic evidence: " << description << "\nExpected fragment: " << fragment << '\n';
+        std::cerr << "Missing epoll diagnostic evidence: " << description << "\nExpected fragment: " << fragment << '\n';
         return false;
     }
 
@@ -22,7 +22,7 @@ namespace {
             return true;
         }
 
-        std::cerr << "Forbidden inner epoll diagnostic pattern: " << description << "\nForbidden fragment: " << fragment << '\n';
+        std::cerr << "Forbidden epoll diagnostic pattern: " << description << "\nForbidden fragment: " << fragment << '\n';
         return false;
     }
 
@@ -33,38 +33,41 @@ int main() {
     if (root.empty()) {
         return 1;
     }
-    const std::filesystem::path sourcePath = root / "src" / "core" / "multiplexer" / "epoll" / "DescriptorEventPublisher.cpp";
+    const std::filesystem::path sourcePath = root / "src" / "core" / "multiplexer" / "epoll" / "EventMultiplexer.cpp";
     const std::string source = source_policy::readSourcePolicyFile(sourcePath);
     if (source.empty()) {
         std::cerr << "Unable to read " << sourcePath << '\n';
         return 1;
     }
+    const std::filesystem::path publisherPath = root / "src" / "core" / "multiplexer" / "epoll" / "DescriptorEventPublisher.cpp";
+    const std::string publisher = source_policy::readSourcePolicyFile(publisherPath);
+    if (publisher.empty()) {
+        std::cerr << "Unable to read " << publisherPath << '\n';
+        return 1;
+    }
 
     bool ok = true;
-    ok &= requireContains(source, "epfd = core::system::epoll_create1(EPOLL_CLOEXEC);", "inner epoll_create1 call remains local");
+    ok &= requireContains(source, "epfd(core::system::epoll_create1(EPOLL_CLOEXEC))", "the single epoll_create1 call remains local");
     ok &= requireContains(source, "if (epfd < 0)", "invalid epfd guard after create and before follow-on syscalls");
-    ok &= requireContains(source, "core.mux epoll_create1 failed", "epoll_create1 failure is logged");
+    ok &= requireContains(source, "Core::multiplexer epoll_create1 failed", "epoll_create1 failure is logged");
     ok &= requireContains(source, "const int errnum = errno;", "errno is captured immediately for failing syscalls");
     ok &= requireContains(source, "EPOLL_CTL_ADD", "ADD operation remains explicit");
     ok &= requireContains(source, "errnum == EEXIST", "EEXIST ADD fallback is preserved");
     ok &= requireContains(source, "core.mux epoll_ctl ADD failed: fd={}", "ADD failures other than EEXIST are logged");
     ok &= requireContains(source, "EPOLL_CTL_DEL", "DEL operation remains explicit");
-    ok &= requireContains(source, "errnum == EBADF", "EBADF cleanup tolerance is preserved");
+    ok &= requireContains(source, "errnum != EBADF", "EBADF cleanup tolerance is preserved");
     ok &= requireContains(source, "core.mux epoll_ctl DEL failed: fd={}", "DEL failures other than EBADF are logged");
     ok &= requireContains(source, "EPOLL_CTL_MOD", "MOD operation remains explicit");
     ok &= requireContains(source, "core.mux epoll_ctl MOD failed: fd={}", "MOD failures are logged");
-    ok &= requireContains(source, "const int count = core::system::epoll_wait", "inner non-blocking epoll_wait remains local");
-    ok &= requireContains(source, "if (count < 0)", "epoll_wait failure count is checked");
-    ok &= requireContains(source, "errnum != EINTR", "EINTR wait failures are not escalated as system errors");
-    ok &= requireContains(source, "core.mux epoll_wait failed: interestCount={}", "non-EINTR wait failures are logged");
     ok &= requireContains(source, ".sysError(logger::LogLevel::Error, errnum", "errno-backed sysError diagnostics are used");
-    ok &= requireContains(source, "if (interestCount > 0)", "unsigned interestCount decrement is guarded");
+    ok &= requireContains(source, "ePollFd.enabledEvents != enabledEvents", "unchanged interest masks issue no MOD");
+
+    ok &= requireContains(source,
+                          "core.mux epoll_ctl DEL failed: fd={}\", fd);\n                    return;",
+                          "real DEL failure path keeps the entry the kernel still references");
 
-    ok &= requireAbsent(source,
-                        "core.mux epoll_ctl DEL failed: fd={}\", fd);\n                interestCount--",
-                        "real DEL failure path must not decrement unsigned interestCount");
-    ok &= requireAbsent(source, "--interestCount", "raw pre-decrement can underflow unsigned interestCount");
-    ok &= requireAbsent(source, "interestCount -=", "compound decrement can underflow unsigned interestCount");
+    ok &= requireAbsent(source, "core::system::epoll_wait", "descriptors are not collected by a nested epoll_wait");
+    ok &= requireAbsent(publisher, "core::system::epoll_", "publishers dispatch from the shared epoll set without own syscalls");
 
     return ok ? 0 : 1;
 }
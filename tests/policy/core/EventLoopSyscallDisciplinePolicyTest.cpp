@@ -48,7 +48,7 @@ int main() {
     const std::string epollMux =
         source_policy::readSourcePolicyFile(root / "src" / "core" / "multiplexer" / "epoll" / "EventMultiplexer.cpp");
     const std::string eventLoop = source_policy::readSourcePolicyFile(root / "src" / "core" / "EventLoop.cpp");
-    const std::string innerEpoll =
+    const std::string epollPublisher =
         source_policy::readSourcePolicyFile(root / "src" / "core" / "multiplexer" / "epoll" / "DescriptorEventPublisher.cpp");
     const std::string pollMux =
         source_policy::readSourcePolicyFile(root / "src" / "core" / "multiplexer" / "poll" / "EventMultiplexer.cpp");
@@ -60,22 +60,18 @@ int main() {
     const std::string coreMux = source_policy::readSourcePolicyFile(root / "src" / "core" / "EventMultiplexer.cpp");
 
     bool ok = true;
-    ok &= requireContains(epollMux, ", epfd(core::system::epoll_create1(EPOLL_CLOEXEC))", "outer epoll_create1 remains in the initializer");
+    ok &= requireContains(epollMux, ": epfd(core::system::epoll_create1(EPOLL_CLOEXEC))", "epoll_create1 remains in the initializer");
     ok &= requireOrdered(epollMux,
                          {"epfd(core::system::epoll_create1(EPOLL_CLOEXEC)) {",
                           "if (epfd < 0)",
                           "const int errnum = errno;",
                           "Core::multiplexer epoll_create1 failed",
                           "return;"},
-                         "outer epoll_create1 is checked first and skips follow-on ctl calls");
-    ok &= requireContains(epollMux, "core::system::epoll_ctl(epfd, EPOLL_CTL_ADD", "outer epoll_ctl ADD calls remain explicit");
-    ok &= requireContains(epollMux,
-                          "Core::multiplexer epoll_ctl ADD failed: fd={} publisher={}",
-                          "outer epoll_ctl ADD failures are logged with fd and publisher");
-    ok &= requireOrdered(
-        epollMux,
-        {"bool setupSucceeded = true;", "setupSucceeded &= addPublisherToOuterEpoll", "if (setupSucceeded)", "Core::multiplexer: epoll"},
-        "outer epoll success-looking debug line is gated on setup success");
+                         "epoll_create1 is checked first and skips follow-on calls");
+    ok &= requireContains(epollMux, "core::system::epoll_ctl(epfd, EPOLL_CTL_ADD", "epoll_ctl ADD calls remain explicit");
+    ok &= requireOrdered(epollMux,
+                         {"if (ePollFdsManager.getEPFd() >= 0)", "Core::multiplexer: epoll"},
+                         "epoll success-looking debug line is gated on setup success");
 
     ok &= requireContains(eventLoop, "logSignalFailure(sigemptyset", "sigemptyset return values are checked");
     ok &= requireContains(eventLoop, "logSigaddsetFailure(sigaddset", "sigaddset return values are checked");
@@ -90,12 +86,10 @@ int main() {
         {"SIGPIPE, &oldPipeAct", "SIGTERM, &oldTermAct", "SIGALRM, &oldAlarmAct", "SIGHUP, &oldHupAct", "free();", "SIGINT, &oldIntAct"},
         "start restore ordering, including SIGINT restore-last behavior, is preserved");
 
-    ok &= requireContains(innerEpoll, "core.mux epoll_create1 failed", "inner epoll PR #171 create diagnostics remain present");
-    ok &= requireContains(innerEpoll, "core.mux epoll_ctl ADD failed: fd={}", "inner epoll ADD diagnostics remain present");
-    ok &= requireContains(innerEpoll, "core.mux epoll_wait failed: interestCount={}", "inner epoll wait diagnostics remain present");
-    ok &= requireContains(innerEpoll, "errnum == EEXIST", "inner epoll EEXIST behavior remains present");
-    ok &= requireContains(innerEpoll, "errnum == EBADF", "inner epoll EBADF behavior remains present");
-    ok &= requireContains(innerEpoll, "if (interestCount > 0)", "inner epoll interestCount underflow guard remains present");
+    ok &= requireContains(epollMux, "core.mux epoll_ctl ADD failed: fd={}", "epoll ADD diagnostics remain present");
+    ok &= requireContains(epollMux, "errnum == EEXIST", "epoll EEXIST behavior remains present");
+    ok &= requireContains(epollMux, "errnum != EBADF", "epoll EBADF behavior remains present");
+    ok &= requireContains(epollPublisher, "ePollFds.getActiveEvents()", "publishers dispatch the events of the single epoll_pwait");
 
     ok &= requireContains(pollMux, "return core::system::ppoll", "poll outer monitor path directly returns ppoll");
     ok &= requireContains(selectMux, "return core::system::pselect", "select outer monitor path directly returns pselect");
@@ -23,6 +23,10 @@ namespace {
         TestSocketAddress getSocketAddress() const {
             return {};
         }
+
+        bool resolve(const std::function<void()>&) {
+            return false;
+        }
     };
 
     class TestConfigInstance
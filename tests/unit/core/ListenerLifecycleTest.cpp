@@ -15,6 +15,7 @@
 #include <memory>
 #include <nlohmann/json.hpp>
 #include <string>
+#include <sys/socket.h>
 #include <system_error>
 #include <utility>
 
@@ -55,6 +56,17 @@ namespace {
         std::string toString(bool = true) const override {
             return "deterministic-listener-address";
         }
+
+        const sockaddr& getSockAddr() {
+            return sockAddr;
+        }
+
+        socklen_t getSockAddrLen() const {
+            return 0;
+        }
+
+    private:
+        sockaddr sockAddr{};
     };
 
     struct TestAddressConfig {
@@ -108,6 +120,11 @@ namespace {
             return -1;
         }
 
+        int adopt(int, Flags) {
+            errno = EBADF;
+            return -1;
+        }
+
         int bind(const SocketAddress&) {
             return 0;
         }
@@ -121,6 +138,9 @@ namespace {
             return -1;
         }
 
+        void disown() {
+        }
+
         bool isValid() const {
             return false;
         }
@@ -0,0 +1,88 @@
+/*
+ * SNode.C - A Slim Toolkit for Network Communication
+ * Copyright (C) Volker Christian <me@vchrist.at>
+ *               2020, 2021, 2022, 2023, 2024, 2025, 2026
+ *
+ * SPDX-License-Identifier: LGPL-3.0-or-later OR MIT
+ */
+
+#include "core/socket/stream/ReadBufferPool.h"
+#include "support/TestResult.h"
+
+#include <cstddef>
+#include <thread>
+#include <vector>
+
+using core::socket::stream::ReadBufferPool;
+
+int main() {
+    tests::support::TestResult result;
+
+    ReadBufferPool& pool = ReadBufferPool::instance();
+
+    {
+        char* first = pool.acquire(16384);
+        char* second = pool.acquire(16384);
+
+        result.expectTrue(first != nullptr && second != nullptr && first != second, "every lease gets its own buffer");
+        result.expectTrue(pool.getStats().leased == 2 && pool.getStats().leasedBytes == 2 * 16384, "leases are accounted");
+        result.expectTrue(pool.getStats().allocated == 2 && pool.getStats().reused == 0, "an empty pool allocates");
+
+        pool.release(second, 16384);
+        result.expectTrue(pool.getStats().leased == 1 && pool.getStats().idle == 1 && pool.getStats().idleBytes == 16384,
+                          "a released buffer becomes idle");
+
+        char* third = pool.acquire(16384);
+        result.expectTrue(third == second && pool.getStats().reused == 1, "an idle buffer of the same block size is reused");
+
+        char* other = pool.acquire(4096);
+        result.expectTrue(other != second && pool.getStats().allocated == 3, "buffers are not shared between block sizes");
+
+        pool.release(first, 16384);
+        pool.release(third, 16384);
+        pool.release(other, 4096);
+
+        result.expectTrue(pool.getStats().leased == 0 && pool.getStats().idle == 3 && pool.getStats().peakLeased == 3,
+                          "all buffers are back in the pool");
+    }
+
+    {
+        // Idle memory above the high watermark is trimmed down to the low watermark, largest buffers first
+        pool.setWatermarks(2 * 16384, 4 * 16384);
+        result.expectTrue(pool.getStats().idleBytes <= 4 * 16384, "lowering the watermarks keeps the pool below the high watermark");
+
+        std::vector<char*> buffers;
+        for (std::size_t i = 0; i < 8; i++) {
+            buffers.push_back(pool.acquire(16384));
+        }
+        for (char* buffer : buffers) {
+            pool.release(buffer, 16384);
+        }
+
+        result.expectTrue(pool.getStats().idleBytes <= 4 * 16384, "idle memory never stays above the high watermark");
+        result.expectTrue(pool.getStats().trimmed > 0, "trimmed buffers are accounted");
+
+        pool.setWatermarks(0, 0);
+        result.expectTrue(pool.getStats().idle == 0 && pool.getStats().idleBytes == 0, "zero watermarks keep no idle buffers");
+
+        pool.setWatermarks(8 * 16384, 4 * 16384);
+        result.expectTrue(pool.getLowWatermark() == 4 * 16384 && pool.getHighWatermark() == 4 * 16384,
+                          "the low watermark is capped at the high watermark");
+
+        pool.setWatermarks(ReadBufferPool::defaultLowWatermark, ReadBufferPool::defaultHighWatermark);
+    }
+
+    {
+        char* mainBuffer = pool.acquire(16384);
+        pool.release(mainBuffer, 16384);
+
+        bool separate = false;
+        std::thread([&separate]() {
+            separate = ReadBufferPool::instance().getStats().idle == 0 && ReadBufferPool::instance().getStats().allocated == 0;
+        }).join();
+
+        result.expectTrue(separate, "every event loop thread has its own pool");
+    }
+
+    return result.processResult();
+}
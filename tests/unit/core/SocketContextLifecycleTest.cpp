@@ -12,6 +12,7 @@
 #include <nlohmann/json.hpp>
 #include <optional>
 #include <ostream>
+#include <span>
 #include <string>
 #include <utility>
 #include <vector>
@@ -107,6 +108,14 @@ namespace {
             return 0;
         }
 
+        std::span<const char> peekFromPeer() const override {
+            return {};
+        }
+
+        std::size_t consumeFromPeer(std::size_t) override {
+            return 0;
+        }
+
         void shutdownRead() override {
         }
 
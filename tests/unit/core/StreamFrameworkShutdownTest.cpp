@@ -246,6 +246,10 @@ namespace {
             return 1024;
         }
 
+        bool getReadPersistentInterest() const {
+            return false;
+        }
+
         std::size_t getWriteBlockSize() const {
             return 256;
         }
@@ -143,6 +143,9 @@ namespace {
         std::size_t getReadBlockSize() const {
             return 1024;
         }
+        bool getReadPersistentInterest() const {
+            return false;
+        }
         std::size_t getWriteBlockSize() const {
             return 1024;
         }
@@ -0,0 +1,169 @@
+/*
+ * SNode.C - A Slim Toolkit for Network Communication
+ * Copyright (C) Volker Christian <me@vchrist.at>
+ *               2020, 2021, 2022, 2023, 2024, 2025, 2026
+ *
+ * SPDX-License-Identifier: LGPL-3.0-or-later OR MIT
+ */
+
+#include "core/socket/stream/tls/SessionCache.h"
+#include "support/TestResult.h"
+
+#include <openssl/bio.h>
+#include <openssl/evp.h>
+#include <openssl/ssl.h>
+#include <openssl/x509.h>
+
+using core::socket::stream::tls::SessionCache;
+
+namespace {
+
+    const unsigned char sessionIdContext[] = "session-cache-test";
+
+    X509* makeCert(EVP_PKEY* pkey) {
+        X509* cert = X509_new();
+        ASN1_INTEGER_set(X509_get_serialNumber(cert), 1);
+        X509_gmtime_adj(X509_get_notBefore(cert), 0);
+        X509_gmtime_adj(X509_get_notAfter(cert), 60 * 60);
+        X509_set_pubkey(cert, pkey);
+        X509_NAME* name = X509_get_subject_name(cert);
+        X509_NAME_add_entry_by_txt(name, "CN", MBSTRING_ASC, reinterpret_cast<const unsigned char*>("snodec-test"), -1, -1, 0);
+        X509_set_issuer_name(cert, name);
+        X509_sign(cert, pkey, EVP_sha256());
+        return cert;
+    }
+
+    // One listener: every context carries the same certificate and session id context, thus sessions may move between them
+    SSL_CTX* makeServerCtx(EVP_PKEY* pkey, X509* cert, bool tickets, long ticketKeyRotation) {
+        SSL_CTX* ctx = SSL_CTX_new(TLS_server_method());
+        SSL_CTX_use_certificate(ctx, cert);
+        SSL_CTX_use_PrivateKey(ctx, pkey);
+        SSL_CTX_set_session_id_context(ctx, sessionIdContext, sizeof(sessionIdContext));
+        if (!tickets) {
+            SSL_CTX_set_options(ctx, SSL_OP_NO_TICKET);
+        }
+        SessionCache::instance().attach(ctx, 2, 300, ticketKeyRotation);
+        return ctx;
+    }
+
+    // Handshakes over a memory BIO pair and returns the client's session for the next attempt
+    SSL_SESSION* connect(SSL_CTX* clientCtx, SSL_CTX* serverCtx, SSL_SESSION* resume, bool& resumed) {
+        SSL* client = SSL_new(clientCtx);
+        SSL* server = SSL_new(serverCtx);
+        BIO* clientBio = nullptr;
+        BIO* serverBio = nullptr;
+        BIO_new_bio_pair(&clientBio, 0, &serverBio, 0);
+        SSL_set_bio(client, clientBio, clientBio);
+        SSL_set_bio(server, serverBio, serverBio);
+        SSL_set_connect_state(client);
+        SSL_set_accept_state(server);
+        if (resume != nullptr) {
+            SSL_set_session(client, resume);
+        }
+
+        bool clientDone = false;
+        bool serverDone = false;
+        for (int i = 0; i < 100 && (!clientDone || !serverDone); ++i) {
+            clientDone = clientDone || SSL_do_handshake(client) == 1;
+            serverDone = serverDone || SSL_do_handshake(server) == 1;
+        }
+
+        // TLSv1.3 tickets arrive after the handshake
+        char byte = 0;
+        SSL_read(client, &byte, 1);
+
+        resumed = clientDone && serverDone && SSL_session_reused(server) == 1;
+        SSL_SESSION* session = clientDone && serverDone ? SSL_get1_session(client) : nullptr;
+
+        // Closed cleanly, otherwise OpenSSL drops the session from the cache
+        SSL_set_shutdown(client, SSL_SENT_SHUTDOWN | SSL_RECEIVED_SHUTDOWN);
+        SSL_set_shutdown(server, SSL_SENT_SHUTDOWN | SSL_RECEIVED_SHUTDOWN);
+        SSL_free(client);
+        SSL_free(server);
+
+        return session;
+    }
+
+} // namespace
+
+int main() {
+    tests::support::TestResult result;
+
+    EVP_PKEY* pkey = EVP_EC_gen("P-256");
+    X509* cert = makeCert(pkey);
+
+    SessionCache& sessionCache = SessionCache::instance();
+
+    {
+        SSL_CTX* clientCtx = SSL_CTX_new(TLS_client_method());
+        SSL_CTX_set_max_proto_version(clientCtx, TLS1_2_VERSION);
+        SSL_CTX* serverCtx = makeServerCtx(pkey, cert, false, 0);
+        SSL_CTX* otherServerCtx = makeServerCtx(pkey, cert, false, 0);
+
+        bool resumed = true;
+        SSL_SESSION* first = connect(clientCtx, serverCtx, nullptr, resumed);
+        result.expectTrue(first != nullptr && !resumed, "session id: the first handshake is a full one");
+        result.expectEqual(1, static_cast<int>(sessionCache.getStats().sessions), "session id: the new session is cached");
+
+        SSL_SESSION_free(connect(clientCtx, otherServerCtx, first, resumed));
+        result.expectTrue(resumed, "session id: another context resumes from the shared cache");
+        result.expectEqual(1, static_cast<int>(sessionCache.getStats().hits), "session id: the resumption is a cache hit");
+
+        SSL_SESSION_free(connect(clientCtx, serverCtx, nullptr, resumed));
+        SSL_SESSION_free(connect(clientCtx, serverCtx, nullptr, resumed));
+        result.expectEqual(2, static_cast<int>(sessionCache.getStats().sessions), "session id: the cache holds at most its capacity");
+        result.expectEqual(1, static_cast<int>(sessionCache.getStats().evicted), "session id: the least recently used session is evicted");
+
+        SSL_SESSION_free(connect(clientCtx, serverCtx, first, resumed));
+        result.expectTrue(!resumed, "session id: an evicted session needs a full handshake");
+        result.expectTrue(sessionCache.getStats().misses >= 1, "session id: the evicted session is a cache miss");
+
+        SSL_SESSION_free(first);
+        SSL_CTX_free(otherServerCtx);
+        SSL_CTX_free(serverCtx);
+        SSL_CTX_free(clientCtx);
+    }
+
+    sessionCache.flush();
+    result.expectEqual(0, static_cast<int>(sessionCache.getStats().sessions), "flush empties the cache");
+
+    {
+        SSL_CTX* clientCtx = SSL_CTX_new(TLS_client_method());
+        SSL_CTX* serverCtx = makeServerCtx(pkey, cert, true, 3600);
+        SSL_CTX* otherServerCtx = makeServerCtx(pkey, cert, true, 3600);
+
+        bool resumed = true;
+        SSL_SESSION* ticket = connect(clientCtx, serverCtx, nullptr, resumed);
+        result.expectTrue(ticket != nullptr && SSL_SESSION_is_resumable(ticket) == 1 && !resumed, "ticket: the full handshake issues a ticket");
+        result.expectEqual(0, static_cast<int>(sessionCache.getStats().sessions), "ticket: stateless sessions are not cached");
+
+        SSL_SESSION_free(connect(clientCtx, otherServerCtx, ticket, resumed));
+        result.expectTrue(resumed, "ticket: another context decrypts the ticket with the shared key");
+
+        const int rotations = static_cast<int>(sessionCache.getStats().ticketKeyRotations);
+        sessionCache.rotateTicketKeys();
+        result.expectEqual(rotations + 1, static_cast<int>(sessionCache.getStats().ticketKeyRotations), "ticket: rotation is counted");
+
+        SSL_SESSION_free(connect(clientCtx, serverCtx, ticket, resumed));
+        result.expectTrue(resumed, "ticket: the previous key still resumes");
+
+        sessionCache.rotateTicketKeys();
+        SSL_SESSION_free(connect(clientCtx, serverCtx, ticket, resumed));
+        result.expectTrue(!resumed, "ticket: a key rotated out twice forces a full handshake");
+
+        SSL_SESSION_free(ticket);
+        SSL_CTX_free(otherServerCtx);
+        SSL_CTX_free(serverCtx);
+        SSL_CTX_free(clientCtx);
+    }
+
+    sessionCache.countHandshake(false);
+    sessionCache.countHandshake(true);
+    result.expectTrue(sessionCache.getStats().fullHandshakes == 1 && sessionCache.getStats().resumedHandshakes == 1,
+                      "full and resumed handshakes are counted apart");
+
+    X509_free(cert);
+    EVP_PKEY_free(pkey);
+
+    return result.processResult();
+}
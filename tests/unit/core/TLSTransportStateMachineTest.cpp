@@ -3,8 +3,10 @@
 #include "core/EventMultiplexer.h"
 #include "core/socket/SocketAddress.h"
 #include "core/socket/stream/SocketContext.h"
+#include "core/socket/stream/WritePuffer.h"
 #include "core/socket/stream/tls/SocketConnection.hpp"
 #include "core/socket/stream/tls/detail/TLSLifecycleTestAccess.h"
+#include "core/socket/stream/tls/ssl_utils.h"
 #include "net/config/ConfigInstance.h"
 #include "tests/support/TestResult.h"
 
@@ -174,6 +176,9 @@ namespace {
         std::size_t getReadBlockSize() const {
             return readBlockSize;
         }
+        bool getReadPersistentInterest() const {
+            return false;
+        }
         std::size_t getWriteBlockSize() const {
             return 1024;
         }
@@ -1329,6 +1334,112 @@ namespace {
         }
     }
 
+    void kernelTlsOffload(TestResult& result) {
+        resetTlsTestState();
+        {
+            TestFixture f;
+            makeTlsActive(f);
+            result.expectTrue(!f.connection->canSendFileToPeer(), "kTLS: user space records can not take file ranges");
+            TLSLifecycleTestAccess::enableKernelTls(*f.connection, true);
+            result.expectTrue(f.connection->canSendFileToPeer(), "kTLS: kernel records take file ranges");
+            f.connection->sendToPeer("one", 3);
+            f.connection->sendToPeer("-two", 4);
+            TLSLifecycleTestAccess::triggerWriteEvent(*f.connection);
+            result.expectEqual(0, TLSLifecycleTestAccess::writerCounters().operationCalls, "kTLS: writes bypass SSL_write");
+            char raw[16] = {};
+            const ssize_t rawBytes = ::recv(f.pipeFd.writeFd(), raw, sizeof(raw), MSG_DONTWAIT);
+            result.expectTrue(rawBytes == 7 && std::string(raw, raw + rawBytes) == "one-two", "kTLS: queued slabs leave in one send");
+            TLSLifecycleTestAccess::stopSSL(*f.connection);
+            result.expectTrue(!f.connection->canSendFileToPeer(), "kTLS: detaching SSL ends the send offload");
+        }
+
+        resetTlsTestState();
+        {
+            TestFixture f(false);
+            makeTlsActive(f);
+            TLSLifecycleTestAccess::enableKernelTls(*f.connection, false);
+            TLSLifecycleTestAccess::enqueueShutdownResult(-1, SSL_ERROR_WANT_READ);
+            TLSLifecycleTestAccess::onReadShutdown(*f.connection);
+            result.expectEqual(
+                1, TLSLifecycleTestAccess::shutdownIntent(*f.connection), "kTLS: close_notify closes the transport instead of plaintext");
+            TLSShutdown* helper = TLSLifecycleTestAccess::lastShutdown();
+            TLSLifecycleTestAccess::enqueueShutdownResult(1, SSL_ERROR_NONE);
+            if (helper != nullptr) {
+                TLSLifecycleTestAccess::readEvent(helper);
+            }
+            releaseDisabledEvents();
+        }
+    }
+
+    void idleMemory(TestResult& result) {
+        resetTlsTestState();
+        {
+            TestFixture f;
+            makeTlsActive(f);
+            const std::size_t retained = f.connection->getBytesHeld();
+            result.expectTrue(retained > 0, "idle memory: record buffers are held by default");
+            SSL_set_mode(f.connection->getSSL(), SSL_MODE_RELEASE_BUFFERS);
+            result.expectEqual(0, static_cast<int>(f.connection->getBytesHeld()), "idle memory: an idle connection holds no buffer");
+            f.connection->sendToPeer("one", 3);
+            result.expectTrue(f.connection->getBytesHeld() >= core::socket::stream::WritePuffer::slabSize,
+                              "idle memory: queued data holds its slab and record buffer");
+        }
+
+        core::socket::stream::tls::SslConfig sslConfig(false);
+        sslConfig.releaseBuffers = true;
+        SSL_CTX* ctx = core::socket::stream::tls::ssl_ctx_new(sslConfig);
+        result.expectTrue(ctx != nullptr && (SSL_CTX_get_mode(ctx) & SSL_MODE_RELEASE_BUFFERS) != 0,
+                          "idle memory: the context releases record buffers when configured");
+        core::socket::stream::tls::ssl_ctx_free(ctx);
+    }
+
+    void recordSizing(TestResult& result) {
+        resetTlsTestState();
+        {
+            TestFixture f;
+            TlsPair pair;
+            result.expectTrue(pair.handshake(), "records: memory BIO peer handshake completes");
+            SSL_set_mode(pair.client, SSL_MODE_ENABLE_PARTIAL_WRITE | SSL_MODE_ACCEPT_MOVING_WRITE_BUFFER);
+            TLSLifecycleTestAccess::replaceSSL(*f.connection, pair.client);
+            pair.client = nullptr;
+            result.expectTrue(TLSLifecycleTestAccess::transitionTo(*f.connection, 3), "records: enters TlsActive");
+
+            const auto payload = std::make_shared<const std::string>(std::size_t{1024 * 1024}, 'x');
+            for (std::size_t offset = 0; offset < 1000; offset += 200) {
+                f.connection->sendToPeer(payload, payload->data() + offset, 200);
+            }
+
+            // The fixture caps each write at 1024 bytes, below the small record size
+            std::vector<char> peerIn(32768);
+            TLSLifecycleTestAccess::triggerWriteEvent(*f.connection);
+            result.expectEqual(1, TLSLifecycleTestAccess::writerCounters().operationCalls, "records: five fragments leave in one SSL_write");
+            result.expectEqual(
+                1000, SSL_read(pair.server, peerIn.data(), static_cast<int>(peerIn.size())), "records: five fragments share one record");
+            result.expectTrue(f.connection->getRecordStats().records == 1 && f.connection->getRecordStats().flushes == 1 &&
+                                  f.connection->getRecordStats().lastFlushRecords == 1,
+                              "records: the flush is accounted with its record count");
+            result.expectEqual(1400,
+                               static_cast<int>(TLSLifecycleTestAccess::recordSize(*f.connection)),
+                               "records: a fresh connection sends small records");
+
+            for (std::size_t offset = 0; offset < payload->size(); offset += 16384) {
+                f.connection->sendToPeer(payload, payload->data() + offset, 16384);
+            }
+            for (int i = 0; i < 2000 && TLSLifecycleTestAccess::queuedWriteBytes(*f.connection) > 0; ++i) {
+                TLSLifecycleTestAccess::triggerWriteEvent(*f.connection);
+                while (SSL_read(pair.server, peerIn.data(), static_cast<int>(peerIn.size())) > 0) {
+                }
+            }
+            result.expectEqual(
+                0, static_cast<int>(TLSLifecycleTestAccess::queuedWriteBytes(*f.connection)), "records: the bulk transfer drains");
+            result.expectEqual(16384,
+                               static_cast<int>(TLSLifecycleTestAccess::recordSize(*f.connection)),
+                               "records: a streaming connection grows to full records");
+            result.expectTrue(f.connection->getRecordStats().flushes == 2 && f.connection->getRecordStats().lastFlushRecords == 1024,
+                              "records: the bulk flush counts every record");
+        }
+    }
+
     void realHandoff(TestResult& result) {
         resetTlsTestState();
         {
@@ -1505,6 +1616,9 @@ int main() {
     handshakeCallbackReentrancy(result);
     staleWriteGate(result);
     writerOrderingFinalProof(result);
+    kernelTlsOffload(result);
+    idleMemory(result);
+    recordSizing(result);
     handoffBuffer(result);
     transitionMatrix(result);
     realHandoff(result);
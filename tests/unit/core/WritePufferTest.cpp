@@ -0,0 +1,183 @@
+/*
+ * SNode.C - A Slim Toolkit for Network Communication
+ * Copyright (C) Volker Christian <me@vchrist.at>
+ *               2020, 2021, 2022, 2023, 2024, 2025, 2026
+ *
+ * SPDX-License-Identifier: LGPL-3.0-or-later OR MIT
+ */
+
+#include "core/socket/stream/WritePuffer.h"
+#include "support/TestResult.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <sys/uio.h>
+#include <vector>
+
+using core::socket::stream::WritePuffer;
+
+namespace {
+
+    std::string gathered(const WritePuffer& writePuffer, std::size_t iovMax, std::size_t maxLen) {
+        iovec iov[WritePuffer::maxIovecs];
+        const int iovCount = writePuffer.gather(iov, iovMax, maxLen);
+
+        std::string data;
+        for (int i = 0; i < iovCount; i++) {
+            data.append(static_cast<const char*>(iov[i].iov_base), iov[i].iov_len);
+        }
+
+        return data;
+    }
+
+    std::string pattern(std::size_t len, std::size_t offset) {
+        std::string data(len, '\0');
+        for (std::size_t i = 0; i < len; i++) {
+            data[i] = static_cast<char>('a' + ((offset + i) % 26));
+        }
+
+        return data;
+    }
+
+} // namespace
+
+int main() {
+    tests::support::TestResult result;
+
+    {
+        WritePuffer writePuffer;
+        result.expectTrue(writePuffer.empty() && writePuffer.size() == 0, "new puffer is empty");
+        result.expectEqual(0, static_cast<int>(gathered(writePuffer, WritePuffer::maxIovecs, 1024).size()), "empty puffer gathers nothing");
+    }
+
+    {
+        // Chunks straddling slab boundaries
+        const std::string data = pattern(3 * WritePuffer::slabSize + 123, 0);
+
+        WritePuffer writePuffer;
+        for (std::size_t offset = 0; offset < data.size(); offset += 1000) {
+            writePuffer.append(data.data() + offset, std::min<std::size_t>(1000, data.size() - offset));
+        }
+
+        result.expectTrue(writePuffer.size() == data.size(), "size counts every appended byte");
+        result.expectTrue(gathered(writePuffer, WritePuffer::maxIovecs, data.size()) == data, "gather returns the data in order");
+
+        iovec iov[WritePuffer::maxIovecs];
+        result.expectEqual(4, writePuffer.gather(iov, WritePuffer::maxIovecs, data.size()), "one iovec per slab");
+        result.expectEqual(2, writePuffer.gather(iov, 2, data.size()), "gather honours the iovec limit");
+        result.expectTrue(gathered(writePuffer, WritePuffer::maxIovecs, 5000) == data.substr(0, 5000), "gather honours the byte limit");
+
+        writePuffer.consume(WritePuffer::slabSize + 7);
+        result.expectTrue(writePuffer.size() == data.size() - WritePuffer::slabSize - 7, "consume shrinks the size");
+        result.expectTrue(gathered(writePuffer, WritePuffer::maxIovecs, data.size()) == data.substr(WritePuffer::slabSize + 7),
+                          "partially consumed slab continues at the right byte");
+
+        writePuffer.append("xyz", 3);
+        result.expectTrue(gathered(writePuffer, WritePuffer::maxIovecs, data.size() + 3) == data.substr(WritePuffer::slabSize + 7) + "xyz",
+                          "appending after consume keeps the order");
+
+        writePuffer.consume(writePuffer.size() + 100);
+        result.expectTrue(writePuffer.empty(), "consuming everything empties the puffer");
+
+        writePuffer.append("abc", 3);
+        result.expectTrue(gathered(writePuffer, WritePuffer::maxIovecs, 3) == "abc", "emptied puffer is usable again");
+
+        writePuffer.clear();
+        result.expectTrue(writePuffer.empty(), "clear drops queued data");
+    }
+
+    {
+        // Shared payloads are queued by reference and interleave with copied data in order
+        const std::shared_ptr<const std::string> payload = std::make_shared<const std::string>(pattern(64 * 1024, 3));
+
+        WritePuffer writePuffer;
+        writePuffer.append("head", 4);
+        writePuffer.append(payload, payload->data(), payload->size());
+        writePuffer.append("tail", 4);
+
+        iovec iov[WritePuffer::maxIovecs];
+        const int iovCount = writePuffer.gather(iov, WritePuffer::maxIovecs, writePuffer.size());
+
+        result.expectEqual(3, iovCount, "copied data after a reference starts a new slab");
+        result.expectTrue(iovCount > 1 && iov[1].iov_base == payload->data(), "shared payload is sent from the caller's buffer");
+        result.expectTrue(gathered(writePuffer, WritePuffer::maxIovecs, writePuffer.size()) == "head" + *payload + "tail",
+                          "references and copies keep their order");
+        result.expectTrue(payload.use_count() == 2, "queued reference keeps the payload alive");
+
+        writePuffer.consume(4 + 1000);
+        result.expectTrue(gathered(writePuffer, WritePuffer::maxIovecs, 10) == payload->substr(1000, 10),
+                          "partially written reference continues at the right byte");
+
+        writePuffer.consume(payload->size() - 1000);
+        result.expectTrue(payload.use_count() == 1, "written reference releases the payload");
+        result.expectTrue(gathered(writePuffer, WritePuffer::maxIovecs, writePuffer.size()) == "tail", "data behind the reference is intact");
+    }
+
+    {
+        // Fan-out of one payload to many connections
+        constexpr std::size_t connectionCount = 10000;
+        const std::shared_ptr<const std::string> payload = std::make_shared<const std::string>(pattern(64 * 1024, 0));
+
+        const std::chrono::steady_clock::time_point startedAt = std::chrono::steady_clock::now();
+
+        std::vector<WritePuffer> writePuffers(connectionCount);
+        for (WritePuffer& writePuffer : writePuffers) {
+            writePuffer.append(payload, payload->data(), payload->size());
+        }
+
+        const std::chrono::microseconds elapsed =
+            std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - startedAt);
+
+        std::printf("WritePufferTest: %zu KiB payload queued for %zu connections in %lld us\n",
+                    payload->size() / 1024,
+                    connectionCount,
+                    static_cast<long long>(elapsed.count()));
+
+        result.expectTrue(payload.use_count() == static_cast<long>(connectionCount) + 1, "fan-out shares a single payload");
+    }
+
+    {
+        // A slow peer: a large backlog drained by small partial writes. A flat vector erasing at the front is quadratic here
+        constexpr std::size_t backlog = 32 * 1024 * 1024;
+        constexpr std::size_t appendLen = 1024;
+        constexpr std::size_t writeLen = 1400;
+
+        const std::string chunk = pattern(appendLen, 0);
+
+        const std::chrono::steady_clock::time_point startedAt = std::chrono::steady_clock::now();
+
+        WritePuffer writePuffer;
+        for (std::size_t queued = 0; queued < backlog; queued += appendLen) {
+            writePuffer.append(chunk.data(), chunk.size());
+        }
+
+        bool intact = true;
+        std::size_t written = 0;
+        iovec iov[WritePuffer::maxIovecs];
+        while (!writePuffer.empty()) {
+            const int iovCount = writePuffer.gather(iov, WritePuffer::maxIovecs, writeLen);
+            intact = intact && iovCount > 0 && static_cast<const char*>(iov[0].iov_base)[0] == chunk[written % appendLen];
+
+            const std::size_t len = std::min(writeLen, writePuffer.size());
+            writePuffer.consume(len);
+            written += len;
+        }
+
+        const std::chrono::milliseconds elapsed =
+            std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - startedAt);
+
+        std::printf("WritePufferTest: %zu MiB queued and drained in %zu byte writes in %lld ms\n",
+                    backlog / (1024 * 1024),
+                    writeLen,
+                    static_cast<long long>(elapsed.count()));
+
+        result.expectTrue(intact && written == backlog, "large backlog drains intact");
+        result.expectTrue(elapsed < std::chrono::seconds(2), "draining a large backlog is linear");
+    }
+
+    return result.processResult();
+}
@@ -22,6 +22,7 @@
 #include <map>
 #include <memory>
 #include <optional>
+#include <span>
 #include <string>
 #include <utility>
 #include <vector>
@@ -70,6 +71,17 @@ namespace {
             return toRead;
         }
 
+        std::span<const char> peekFromPeer() const override {
+            return {input.data() + offset, input.size() - offset};
+        }
+
+        std::size_t consumeFromPeer(std::size_t len) override {
+            const std::size_t consumed = std::min(len, input.size() - offset);
+            offset += consumed;
+
+            return consumed;
+        }
+
         void shutdownRead() override {
         }
 
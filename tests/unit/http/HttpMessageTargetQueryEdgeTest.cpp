@@ -16,6 +16,7 @@
 #include <cstddef>
 #include <cstring>
 #include <map>
+#include <span>
 #include <string>
 #include <utility>
 
@@ -51,6 +52,12 @@ namespace {
             }
             return toRead;
         }
+        std::span<const char> peekFromPeer() const override { return {input.data() + offset, input.size() - offset}; }
+        std::size_t consumeFromPeer(std::size_t len) override {
+            const std::size_t consumed = std::min(len, input.size() - offset);
+            offset += consumed;
+            return consumed;
+        }
 
         void shutdownRead() override {}
         void shutdownWrite() override {}
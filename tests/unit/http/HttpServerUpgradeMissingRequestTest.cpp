@@ -6,6 +6,7 @@
 #include "web/http/server/Response.h"
 #include "web/http/server/SocketContext.h"
 
+#include <span>
 #include <string>
 
 namespace {
@@ -35,6 +36,12 @@ namespace {
         std::size_t readFromPeer(char*, std::size_t) override {
             return 0;
         }
+        std::span<const char> peekFromPeer() const override {
+            return {};
+        }
+        std::size_t consumeFromPeer(std::size_t) override {
+            return 0;
+        }
         void shutdownRead() override {
         }
         void shutdownWrite() override {
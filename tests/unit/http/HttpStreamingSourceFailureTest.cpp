@@ -14,6 +14,7 @@
 #include <cstdint>
 #include <cstring>
 #include <memory>
+#include <span>
 #include <string>
 #include <string_view>
 #include <vector>
@@ -80,6 +81,16 @@ namespace {
             return copied;
         }
 
+        std::span<const char> peekFromPeer() const override {
+            return {request.data() + requestOffset, request.size() - requestOffset};
+        }
+
+        std::size_t consumeFromPeer(std::size_t length) override {
+            const std::size_t consumed = std::min(length, request.size() - requestOffset);
+            requestOffset += consumed;
+            return consumed;
+        }
+
         void shutdownRead() override {
         }
 
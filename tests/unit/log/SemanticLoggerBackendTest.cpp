@@ -9,6 +9,7 @@
 #include <chrono>
 #include <filesystem>
 #include <fstream>
+#include <span>
 #include <string>
 #include <system_error>
 #include <utility>
@@ -97,6 +98,12 @@ namespace {
         std::size_t readFromPeer(char*, std::size_t) override {
             return 0;
         }
+        std::span<const char> peekFromPeer() const override {
+            return {};
+        }
+        std::size_t consumeFromPeer(std::size_t) override {
+            return 0;
+        }
         void shutdownRead() override {
         }
         void shutdownWrite() override {
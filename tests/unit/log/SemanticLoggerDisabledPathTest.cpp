@@ -10,6 +10,7 @@
 #include <filesystem>
 #include <fstream>
 #include <ostream>
+#include <span>
 #include <string>
 #include <system_error>
 #include <vector>
@@ -95,6 +96,12 @@ namespace {
         std::size_t readFromPeer(char*, std::size_t) override {
             return 0;
         }
+        std::span<const char> peekFromPeer() const override {
+            return {};
+        }
+        std::size_t consumeFromPeer(std::size_t) override {
+            return 0;
+        }
         void shutdownRead() override {
         }
         void shutdownWrite() override {
@@ -14,6 +14,7 @@
 #include "tests/support/TestResult.h"
 
 #include <chrono>
+#include <span>
 #include <string>
 #include <type_traits>
 #include <utility>
@@ -53,6 +54,12 @@ namespace {
         std::size_t readFromPeer(char*, std::size_t) override {
             return 0;
         }
+        std::span<const char> peekFromPeer() const override {
+            return {};
+        }
+        std::size_t consumeFromPeer(std::size_t) override {
+            return 0;
+        }
         void shutdownRead() override {
         }
         void shutdownWrite() override {
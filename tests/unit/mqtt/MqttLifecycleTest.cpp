@@ -15,6 +15,7 @@
 #include <cstdint>
 #include <memory>
 #include <nlohmann/json.hpp>
+#include <span>
 #include <string>
 #include <string_view>
 #include <utility>
@@ -54,6 +55,14 @@ namespace {
             return 0;
         }
 
+        std::span<const char> peekFromPeer() const override {
+            return {};
+        }
+
+        std::size_t consumeFromPeer(std::size_t) override {
+            return 0;
+        }
+
         void shutdownRead() override {
         }
 